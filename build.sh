@@ -22,6 +22,85 @@ else
     echo "========================================"
 fi
 
+# Check for STREAM argument: plan the model for incremental stream inference
+PLAN_OPT="--patch auto"
+if [[ "$*" == *"STREAM"* ]]; then
+    PLAN_OPT="--delta 2"
+    echo "STREAM enabled - input and first 2 conv outputs kept resident for TINYMAIX_RUN_FLAG_STREAM"
+fi
+
+# Check for SFN argument: TinyMaix partition as SFN model on the SFN SPM backend (direct calls,
+# isolation level 1, echo service off as it is an IPC model partition)
+SFN_OPT="-DTFM_PARTITION_ECHO_SERVICE=ON"
+NS_SFN_OPT=""
+if [[ "$*" == *"SFN"* ]]; then
+    SFN_OPT="-DTFM_TINYMAIX_SFN=ON -DCONFIG_TFM_SPM_BACKEND=SFN -DCONFIG_TFM_SPM_BACKEND_IPC=OFF -DTFM_ISOLATION_LEVEL=1 -DTFM_PARTITION_ECHO_SERVICE=OFF"
+    NS_SFN_OPT="-DTFM_TINYMAIX_SFN=ON"
+    echo "SFN enabled - TinyMaix service called directly by the SPM, no partition thread"
+fi
+
+# Check for PRELOAD argument: builtin model decrypted, loaded and warmed at partition init
+PRELOAD_OPT=""
+if [[ "$*" == *"PRELOAD"* ]]; then
+    PRELOAD_OPT="-DTFM_TINYMAIX_PRELOAD=ON"
+    echo "PRELOAD enabled - builtin model loaded and warmed up at partition init"
+fi
+
+# Check for AB_SLOTS argument: double-buffered model slots, a model load is swapped in once validated
+AB_OPT=""
+if [[ "$*" == *"AB_SLOTS"* ]]; then
+    AB_OPT="-DTFM_TINYMAIX_AB_SLOTS=ON"
+    echo "AB_SLOTS enabled - models hot-swapped through a spare slot storage"
+fi
+
+# Check for QUEUE argument: secure request queue, RUNs batched per model and served by priority class
+QUEUE_OPT=""
+if [[ "$*" == *"QUEUE"* ]]; then
+    QUEUE_OPT="-DTFM_TINYMAIX_QUEUE=ON"
+    echo "QUEUE enabled - RUN requests queued, batched and served by priority class"
+fi
+
+# Check for LOG_DEBUG / LOG_INFO arguments: TinyMaix partition log level (default: INFO, NONE in release
+# builds), LOG_SAMPLE: request path logged for every 16th request only
+LOG_OPT=""
+if [[ "$*" == *"LOG_DEBUG"* ]]; then
+    LOG_OPT="-DTFM_TINYMAIX_LOG_LEVEL=DEBUG"
+    echo "LOG_DEBUG enabled - TinyMaix partition logs every request and load step"
+elif [[ "$*" == *"LOG_INFO"* ]]; then
+    LOG_OPT="-DTFM_TINYMAIX_LOG_LEVEL=INFO"
+    echo "LOG_INFO enabled - TinyMaix partition logs loads, preload and errors"
+fi
+if [[ "$*" == *"LOG_SAMPLE"* ]]; then
+    LOG_OPT="${LOG_OPT} -DTFM_TINYMAIX_LOG_SAMPLE=16"
+    echo "LOG_SAMPLE enabled - TinyMaix request path logged for every 16th request"
+fi
+
+# Check for STACK argument: static stack usage report of the secure partitions after the SPE build
+STACK_OPT=""
+if [[ "$*" == *"STACK"* ]]; then
+    STACK_OPT="-DTFM_TINYML_STACK_USAGE=ON"
+    echo "STACK enabled - partitions built with -fstack-usage -fcallgraph-info"
+fi
+
+# Check for CRYPTO_TRACE argument: log crypto heap/operation peaks and the algorithms used on the secure UART,
+# feed that log to tools/tinymaix_crypto_config.py for spe/config/config_tinyml_min.h
+CRYPTO_OPT=""
+if [[ "$*" == *"CRYPTO_TRACE"* ]]; then
+    CRYPTO_OPT="-DTFM_TINYML_CRYPTO_TRACE=ON"
+    echo "CRYPTO_TRACE enabled - Crypto partition logs [Crypto Trace] usage lines"
+fi
+
+# Check for CRYPTO_MIN argument: build with the right-sized crypto config generated from a trace
+if [[ "$*" == *"CRYPTO_MIN"* ]]; then
+    if [ ! -f "${PROJECT_ROOT}/spe/config/config_tinyml_min.h" ]; then
+        echo "CRYPTO_MIN needs spe/config/config_tinyml_min.h, generate it from a CRYPTO_TRACE log:"
+        echo "  python3 tools/tinymaix_crypto_config.py --log uart.log --template spe/config/config_tinyml.h --output spe/config/config_tinyml_min.h"
+        exit 1
+    fi
+    CRYPTO_OPT="${CRYPTO_OPT} -DTINYML_CONFIG_HEADER=${PROJECT_ROOT}/spe/config/config_tinyml_min.h"
+    echo "CRYPTO_MIN enabled - SPE built with spe/config/config_tinyml_min.h"
+fi
+
 # Clean previous build artifacts
 echo "Cleaning previous build directories..."
 #if clean option is enabled, uncomment the following lines
@@ -47,10 +126,21 @@ mkdir -p "${BUILD_DIR}/nspe"
 cd "${PROJECT_ROOT}"
 
 
+echo ""
+echo "TinyMaix activation memory planning..."
+echo "======================================"
+python3 tools/tinymaix_mem_planner.py --input models/mnist_valid_q.h --output models/mnist_valid_q_planned.h --mem-header models/tinymaix_model_mem.h ${PLAN_OPT} --fuse auto
+python3 tools/tinymaix_aot.py --input models/mnist_valid_q_planned.h --output models/tinymaix_model_aot.c --header models/tinymaix_model_aot.h
+
+echo ""
+echo "TinyMaix host tests..."
+echo "======================"
+bash tools/host/tm_host_test.sh
+
 echo ""
 echo "TinyMaix Model encryption using Test Key..."
 echo "==========================================="
-python3 tools/tinymaix_model_encryptor.py --input models/mnist_valid_q.h --output models/encrypted_mnist_model_psa.bin --key-file models/model_key_psa.bin --generate-c-header
+python3 tools/tinymaix_model_encryptor.py --input models/mnist_valid_q_planned.h --output models/encrypted_mnist_model_psa.bin --key-file models/model_key_psa.bin --generate-c-header
 
 
 echo ""
@@ -67,14 +157,27 @@ cmake -S ./spe -B "${BUILD_DIR}/spe" \
   -DCONFIG_TFM_SOURCE_PATH="${PROJECT_ROOT}/pico2w-trusted-firmware-m" \
   -DTFM_NS_REG_TEST=OFF \
   -DTFM_S_REG_TEST=OFF \
-  -DTFM_PARTITION_ECHO_SERVICE=ON \
   -DTFM_PARTITION_TINYMAIX_INFERENCE=ON \
+  ${SFN_OPT} \
+  ${PRELOAD_OPT} \
+  ${AB_OPT} \
+  ${QUEUE_OPT} \
+  ${LOG_OPT} \
+  ${STACK_OPT} \
+  ${CRYPTO_OPT} \
   ${DEV_MODE_OPT}
 
 echo ""
 echo "Installing SPE build artifacts..."
 cmake --build "${BUILD_DIR}/spe" -- -j8 install
 
+if [ -n "${STACK_OPT}" ]; then
+    echo ""
+    echo "Secure partition stack usage..."
+    echo "==============================="
+    cmake --build "${BUILD_DIR}/spe/build-spe" --target tinymaix_stack_usage
+fi
+
 echo ""
 echo "Building NSPE (Non-Secure Processing Environment)..."
 echo "====================================================="
@@ -84,6 +187,10 @@ cmake -S ./nspe -B "${BUILD_DIR}/nspe" \
     -DPICO_BOARD=pico2_w \
     -DCONFIG_SPE_PATH="${BUILD_DIR}/spe/api_ns" \
     -DTFM_TOOLCHAIN_FILE="${BUILD_DIR}/spe/api_ns/cmake/toolchain_ns_GNUARM.cmake" \
+    ${NS_SFN_OPT} \
+    ${PRELOAD_OPT} \
+    ${AB_OPT} \
+    ${QUEUE_OPT} \
     ${DEV_MODE_OPT}
 
 cmake --build "${BUILD_DIR}/nspe" -- -j8
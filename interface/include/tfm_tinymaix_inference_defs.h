@@ -17,13 +17,170 @@ extern "C" {
 #ifdef DEV_MODE
 #define TINYMAIX_IPC_GET_MODEL_KEY       (0x1004U)
 #endif
+#define TINYMAIX_IPC_GET_PROFILE         (0x1005U)  /* Profiling build (TFM_TINYMAIX_PROFILE) only */
+#define TINYMAIX_IPC_GET_QUEUE_STATS     (0x1006U)  /* Request queue build (TFM_TINYMAIX_QUEUE) only */
+#define TINYMAIX_IPC_RESUME_INFERENCE    (0x1007U)  /* Continue a run suspended by its time budget */
+#define TINYMAIX_IPC_GET_STATS           (0x1008U)  /* Service counters and tick histograms */
+
+/* Model slots of the service (tfm_tinymaix_load_params_t.slot) */
+#define TINYMAIX_SLOT_MAIN               (0U)  /* Classifier, used by every run */
+#define TINYMAIX_SLOT_GATE               (1U)  /* Cascade gate, runs first with TINYMAIX_RUN_FLAG_CASCADE */
+#define TINYMAIX_SLOT_CNT                (2U)
+
+/* Optional load parameters, passed as in_vec[1] of TINYMAIX_IPC_LOAD_ENCRYPTED_MODEL */
+typedef struct {
+    uint32_t slot;               /* TINYMAIX_SLOT_*, default main */
+} tfm_tinymaix_load_params_t;
+
+/* Run flags for TINYMAIX_IPC_RUN_INFERENCE (tfm_tinymaix_run_params_t.flags) */
+#define TINYMAIX_RUN_FLAG_ARGMAX_ONLY    (1U << 0)  /* Skip trailing softmax/dequant, return top-1 class only */
+#define TINYMAIX_RUN_FLAG_CASCADE        (1U << 1)  /* Gate model first, main model only below gate_threshold */
+#define TINYMAIX_RUN_FLAG_STREAM         (1U << 2)  /* Main model: frame of a stream, recompute changed rows only */
+
+/* Priority classes of queued runs (tfm_tinymaix_run_params_t.priority), served alarm first, telemetry last */
+#define TINYMAIX_PRIO_NORMAL             (0U)  /* Default */
+#define TINYMAIX_PRIO_ALARM              (1U)  /* Ahead of every other queued run */
+#define TINYMAIX_PRIO_TELEMETRY          (2U)  /* Behind every other queued run */
+#define TINYMAIX_PRIO_CNT                (3U)
+
+/* Optional per-request run parameters, passed as in_vec[1] of TINYMAIX_IPC_RUN_INFERENCE */
+typedef struct {
+    uint32_t flags;              /* TINYMAIX_RUN_FLAG_* */
+    float gate_threshold;        /* TINYMAIX_RUN_FLAG_CASCADE: gate top-1 probability that skips the main model */
+    uint16_t stream_tolerance;   /* TINYMAIX_RUN_FLAG_STREAM: input change (quantised units) treated as unchanged */
+    uint16_t stream_max_percent; /* TINYMAIX_RUN_FLAG_STREAM: changed tiles above this percent run in full, 0: 50 */
+    uint32_t priority;           /* TINYMAIX_PRIO_*, orders the request queue (TFM_TINYMAIX_QUEUE) */
+    uint32_t budget;             /* service ticks (TIMER0, 1 MHz) the run may take before it yields after
+                                  * a layer, 0: no limit */
+} tfm_tinymaix_run_params_t;
+
+/* Parameters of TINYMAIX_IPC_RESUME_INFERENCE, passed as in_vec[0] */
+typedef struct {
+    uint32_t token;              /* tfm_tinymaix_run_info_t.resume_token of the suspended run */
+    uint32_t budget;             /* service ticks for this part of the run, 0: run to the end */
+} tfm_tinymaix_resume_params_t;
+
+/* Stage that decided the class (tfm_tinymaix_run_info_t.stage) */
+#define TINYMAIX_STAGE_MAIN              (0U)
+#define TINYMAIX_STAGE_GATE              (1U)
+
+/* Optional run result details, returned in out_vec[1] of TINYMAIX_IPC_RUN_INFERENCE */
+typedef struct {
+    uint32_t stage;              /* TINYMAIX_STAGE_* */
+    float gate_confidence;       /* gate top-1 probability, 0 without cascade */
+    float confidence;            /* main model top-1 probability (dequantised output), 0 with
+                                  * TINYMAIX_RUN_FLAG_ARGMAX_ONLY or when the gate decided */
+    uint16_t stream_tiles;       /* TINYMAIX_RUN_FLAG_STREAM: input row tiles compared with the previous frame */
+    uint16_t stream_changed;     /* TINYMAIX_RUN_FLAG_STREAM: tiles that changed */
+    uint32_t stream_full;        /* TINYMAIX_RUN_FLAG_STREAM: 1 if the whole model ran (first frame, many changes) */
+    uint16_t queue_depth;        /* queue build: RUN requests queued when its batch started, itself included,
+                                  * NS dispatcher: prioritised runs waiting when it was dispatched */
+    uint16_t queue_batch;        /* queue build: requests of the batch it ran in */
+    uint32_t queue_wait;         /* queue build: ticks from arrival to its run (tick_hz of the queue stats) */
+    uint32_t queue_ahead;        /* queue build: runs served between its arrival and its run,
+                                  * NS dispatcher: runs dispatched between its arrival and its dispatch */
+    uint32_t resume_token;       /* budgeted run suspended (PSA_OPERATION_INCOMPLETE): pass to resume, else 0 */
+    uint32_t resume_layer;       /* budgeted run suspended: next layer to run */
+} tfm_tinymaix_run_info_t;
+
+/* Queue counters of one priority class (tfm_tinymaix_queue_stats_t.prio) */
+typedef struct {
+    uint32_t served;             /* RUN requests served from the queue */
+    uint32_t ahead_max;          /* most runs served ahead of one request */
+    uint32_t ahead_total;        /* sum of the runs served ahead */
+    uint32_t wait_max;           /* longest wait, ticks */
+    uint64_t wait_total;         /* sum of all waits, ticks */
+} tfm_tinymaix_queue_prio_t;
+
+/* Request queue counters since boot, returned by TINYMAIX_IPC_GET_QUEUE_STATS */
+typedef struct {
+    uint32_t tick_hz;            /* ticks per second of the waits (TIMER0), 0: waits not timed (timer stopped) */
+    uint32_t capacity;           /* queue slots (TFM_TINYMAIX_QUEUE_DEPTH) */
+    uint32_t depth;              /* RUN requests queued now */
+    uint32_t depth_max;          /* most RUN requests queued at once */
+    uint32_t full;               /* batches started with the queue full and more requests waiting in the SPM */
+    uint32_t batches;            /* batches served */
+    uint32_t batch_max;          /* largest batch */
+    tfm_tinymaix_queue_prio_t prio[TINYMAIX_PRIO_CNT];  /* index TINYMAIX_PRIO_* */
+} tfm_tinymaix_queue_stats_t;
+
+/* Flags of TINYMAIX_IPC_GET_STATS (optional uint32_t in in_vec[0]) */
+#define TINYMAIX_STATS_FLAG_RESET        (1U << 0)  /* Zero the counters after reading them */
+
+/* Error causes (tfm_tinymaix_stats_t.errors) */
+enum {
+    TINYMAIX_STATS_ERR_PARAM = 0,    /* invalid request: sizes, slot, parameters */
+    TINYMAIX_STATS_ERR_STATE,        /* no model loaded, no gate model, stale resume token */
+    TINYMAIX_STATS_ERR_UNSUPPORTED,  /* message or run mode not in this build or model */
+    TINYMAIX_STATS_ERR_DECRYPT,      /* key derivation, decryption, padding or package header */
+    TINYMAIX_STATS_ERR_MODEL,        /* decrypted model rejected by tm_load, out of arena */
+    TINYMAIX_STATS_ERR_INFERENCE,    /* model run failed */
+    TINYMAIX_STATS_ERR_OTHER,
+    TINYMAIX_STATS_ERR_CNT
+};
+
+/* Tick histograms (tfm_tinymaix_stats_t.hist) */
+enum {
+    TINYMAIX_STATS_HIST_DECRYPT = 0, /* package decryption of a load */
+    TINYMAIX_STATS_HIST_PREPROCESS,  /* image to model input */
+    TINYMAIX_STATS_HIST_RUN,         /* one model run (gate, main, each part of a budgeted run) */
+    TINYMAIX_STATS_HIST_REQUEST,     /* RUN/RESUME request end to end, queue wait included */
+    TINYMAIX_STATS_HIST_CNT
+};
+
+/* log2 bins: bin 0 counts 0 ticks, bin i [2^(i-1), 2^i) ticks, the last bin everything above */
+#define TINYMAIX_STATS_HIST_BINS         (32U)
+/* Arena banks reported (one per slot storage with A/B slots, else only bank 0) */
+#define TINYMAIX_STATS_ARENA_BANKS       (TINYMAIX_SLOT_CNT + 1U)
+
+/* Service counters since boot or the last reset, returned by TINYMAIX_IPC_GET_STATS */
+typedef struct {
+    uint32_t tick_hz;            /* ticks per second of the histograms (TIMER0), 0: not timed (timer stopped) */
+    uint32_t requests;           /* messages handled and the preload, connects and stats reads not counted */
+    uint32_t loads;              /* models loaded (preload included) */
+    uint32_t inferences;         /* RUN/RESUME requests answered with a class */
+    uint32_t suspends;           /* budgeted runs suspended */
+    uint32_t errors[TINYMAIX_STATS_ERR_CNT];             /* failed requests, index TINYMAIX_STATS_ERR_* */
+    uint32_t arena_size;         /* bytes per arena bank */
+    uint32_t arena_high_water[TINYMAIX_STATS_ARENA_BANKS];  /* highest use per bank, bytes */
+    uint64_t bytes_decrypted;    /* model bytes out of successful decryptions */
+    uint32_t hist[TINYMAIX_STATS_HIST_CNT][TINYMAIX_STATS_HIST_BINS];  /* index TINYMAIX_STATS_HIST_* */
+} tfm_tinymaix_stats_t;
+
+/* Kernel phases of tfm_tinymaix_profile_t.phase_ticks (TM_PERF_* marks in tm_layers.c) */
+enum {
+    TINYMAIX_PROF_SBUF = 0,      /* conv input gather into sbuf (im2col) */
+    TINYMAIX_PROF_DOTP,          /* dot products */
+    TINYMAIX_PROF_POST,          /* bias, requant, activation */
+    TINYMAIX_PROF_VALID,         /* conv output pixels without padding */
+    TINYMAIX_PROF_PAD,           /* conv output pixels touching padding */
+    TINYMAIX_PROF_CONV,          /* whole conv kernels */
+    TINYMAIX_PROF_PWCONV,        /* whole pointwise conv kernels */
+    TINYMAIX_PROF_DWCONV,        /* whole depthwise conv kernels */
+    TINYMAIX_PROF_PHASE_CNT
+};
+
+#define TINYMAIX_PROFILE_MAX_LAYERS      (16)
+
+/* Profile of the last inference, returned by TINYMAIX_IPC_GET_PROFILE */
+typedef struct {
+    uint32_t tick_hz;            /* ticks per second (CPU cycles on target) */
+    uint32_t runs;               /* inferences profiled since boot */
+    uint32_t total_ticks;        /* whole run */
+    uint32_t phase_ticks[TINYMAIX_PROF_PHASE_CNT];
+    uint32_t layer_cnt;          /* valid entries below */
+    uint32_t layer_type[TINYMAIX_PROFILE_MAX_LAYERS];   /* tm_layer_type_t */
+    uint32_t layer_ticks[TINYMAIX_PROFILE_MAX_LAYERS];  /* since the previous layer callback */
+} tfm_tinymaix_profile_t;
 
 /* TinyMaix status codes */
 typedef enum {
     TINYMAIX_STATUS_SUCCESS = 0,
+    TINYMAIX_STATUS_INCOMPLETE = 1,         /* Run suspended by its time budget, resume it */
     TINYMAIX_STATUS_ERROR_INVALID_PARAM = -1,
     TINYMAIX_STATUS_ERROR_MODEL_LOAD_FAILED = -3,
     TINYMAIX_STATUS_ERROR_INFERENCE_FAILED = -4,
+    TINYMAIX_STATUS_ERROR_NOT_SUPPORTED = -5,
     TINYMAIX_STATUS_ERROR_GENERIC = -100
 } tfm_tinymaix_status_t;
 
@@ -34,6 +191,58 @@ tfm_tinymaix_status_t tfm_tinymaix_run_inference(int* predicted_class);
 /* TODO : Add function to run inference with custom image data */
 tfm_tinymaix_status_t tfm_tinymaix_run_inference_with_data(const uint8_t* image_data, size_t image_size, int* predicted_class);
 
+/* Run inference with per-request parameters (image_data may be NULL to use the built-in test image) */
+tfm_tinymaix_status_t tfm_tinymaix_run_inference_ex(const uint8_t* image_data, size_t image_size,
+                                                    const tfm_tinymaix_run_params_t* params,
+                                                    int* predicted_class);
+
+/* Load an encrypted model package into a slot (NULL encrypted_model: builtin model) */
+tfm_tinymaix_status_t tfm_tinymaix_load_encrypted_model_slot(uint32_t slot, const uint8_t* encrypted_model,
+                                                             size_t model_size);
+
+/* Cascade run: the gate decides alone when its confidence reaches gate_threshold, info may be NULL */
+tfm_tinymaix_status_t tfm_tinymaix_run_cascade(const uint8_t* image_data, size_t image_size,
+                                               float gate_threshold, uint32_t flags,
+                                               int* predicted_class, tfm_tinymaix_run_info_t* info);
+
+/* Stream run: reuse the main model's rows the frame did not change since the previous
+ * stream frame (NOT_SUPPORTED unless the model is planned with --delta), info may be NULL */
+tfm_tinymaix_status_t tfm_tinymaix_run_stream(const uint8_t* image_data, size_t image_size,
+                                              uint16_t tolerance, uint32_t flags,
+                                              int* predicted_class, tfm_tinymaix_run_info_t* info);
+
+/* Profile of the last inference (NOT_SUPPORTED unless built with TFM_TINYMAIX_PROFILE) */
+tfm_tinymaix_status_t tfm_tinymaix_get_profile(tfm_tinymaix_profile_t* profile);
+
+/* Run in a priority class of the request queue (TINYMAIX_PRIO_*), info may be NULL */
+tfm_tinymaix_status_t tfm_tinymaix_run_priority(const uint8_t* image_data, size_t image_size,
+                                                uint32_t priority, uint32_t flags,
+                                                int* predicted_class, tfm_tinymaix_run_info_t* info);
+
+/* Set up the NS run dispatcher of a queue build on TrustZone, once before threads run
+ * tfm_tinymaix_run_priority() (NOT_SUPPORTED without the dispatcher) */
+tfm_tinymaix_status_t tfm_tinymaix_queue_init(void);
+
+/* Hold prioritised runs in the NS dispatcher (1) or dispatch them again (0), the run
+ * already in the service finishes (NOT_SUPPORTED without the dispatcher) */
+tfm_tinymaix_status_t tfm_tinymaix_queue_hold(uint32_t hold);
+
+/* Run with a time budget in service ticks (TIMER0, NOT_SUPPORTED if the timer does not run).
+ * INCOMPLETE: suspended, continue with tfm_tinymaix_resume(info->resume_token) */
+tfm_tinymaix_status_t tfm_tinymaix_run_budget(const uint8_t* image_data, size_t image_size,
+                                              uint32_t budget, uint32_t flags,
+                                              int* predicted_class, tfm_tinymaix_run_info_t* info);
+
+/* Continue a suspended run with a new budget (0: to the end), same results as tfm_tinymaix_run_budget */
+tfm_tinymaix_status_t tfm_tinymaix_resume(uint32_t token, uint32_t budget,
+                                          int* predicted_class, tfm_tinymaix_run_info_t* info);
+
+/* Request queue counters (NOT_SUPPORTED unless built with TFM_TINYMAIX_QUEUE) */
+tfm_tinymaix_status_t tfm_tinymaix_get_queue_stats(tfm_tinymaix_queue_stats_t* stats);
+
+/* Service counters and histograms, flags TINYMAIX_STATS_FLAG_*; stats may be NULL to only reset */
+tfm_tinymaix_status_t tfm_tinymaix_get_stats(tfm_tinymaix_stats_t* stats, uint32_t flags);
+
 #ifdef DEV_MODE
 /* Debug function to get HUK-derived model key (DEV_MODE only) */
 tfm_tinymaix_status_t tfm_tinymaix_get_model_key(uint8_t* key_buffer, size_t key_buffer_size);
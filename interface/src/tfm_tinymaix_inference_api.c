@@ -1,6 +1,26 @@
 #include "psa/client.h"
 #include "tfm_tinymaix_inference_defs.h"
 
+/*
+ * NS run dispatcher (request queue build on TrustZone). The NS interface
+ * lock lets one NS call into the secure side at a time, so the secure queue
+ * never holds more than one RUN of the NS threads and cannot order them.
+ * tfm_tinymaix_run_priority() runs are ordered here instead: one is in the
+ * service, the others wait by class, and the most urgent class goes next,
+ * in arrival order within a class. With the NS mailbox of a multi-core
+ * target calls do reach the service together and the secure queue orders
+ * and batches them itself.
+ */
+#if defined(TINYMAIX_QUEUE) && !defined(TFM_NS_MAILBOX_API)
+#define TINYMAIX_NS_DISPATCH
+#include "os_wrapper/mutex.h"
+#include "os_wrapper/thread.h"
+#endif
+
+#ifndef PSA_OPERATION_INCOMPLETE
+#define PSA_OPERATION_INCOMPLETE ((psa_status_t)-248)   /* psa/crypto_values.h, budgeted run suspended */
+#endif
+
 tfm_tinymaix_status_t tfm_tinymaix_load_encrypted_model()
 {
     psa_status_t status;
@@ -67,6 +87,566 @@ tfm_tinymaix_status_t tfm_tinymaix_run_inference_with_data(const uint8_t* image_
     return TINYMAIX_STATUS_SUCCESS;
 }
 
+tfm_tinymaix_status_t tfm_tinymaix_run_inference_ex(const uint8_t* image_data, size_t image_size,
+                                                    const tfm_tinymaix_run_params_t* params,
+                                                    int* predicted_class)
+{
+    psa_status_t status;
+    psa_handle_t handle;
+    int result = -1;
+    
+    if (!predicted_class || (image_data == NULL && image_size != 0)) {
+        return TINYMAIX_STATUS_ERROR_INVALID_PARAM;
+    }
+    
+    /* Connect to service */
+    handle = psa_connect(TFM_TINYMAIX_INFERENCE_SID, 1);
+    if (handle <= 0) {
+        return TINYMAIX_STATUS_ERROR_GENERIC;
+    }
+    
+    psa_invec in_vec[] = {
+        {.base = image_data, .len = image_size},
+        {.base = params, .len = params ? sizeof(*params) : 0}
+    };
+    
+    psa_outvec out_vec[] = {
+        {.base = &result, .len = sizeof(result)}
+    };
+    
+    status = psa_call(handle, TINYMAIX_IPC_RUN_INFERENCE, in_vec, 2, out_vec, 1);
+    
+    psa_close(handle);
+    
+    if (status != PSA_SUCCESS || result < 0) {
+        return TINYMAIX_STATUS_ERROR_INFERENCE_FAILED;
+    }
+    
+    *predicted_class = result;
+    return TINYMAIX_STATUS_SUCCESS;
+}
+
+tfm_tinymaix_status_t tfm_tinymaix_load_encrypted_model_slot(uint32_t slot, const uint8_t* encrypted_model,
+                                                             size_t model_size)
+{
+    psa_status_t status;
+    psa_handle_t handle;
+    uint32_t result = 1;
+    tfm_tinymaix_load_params_t params = {
+        .slot = slot
+    };
+    
+    if (slot >= TINYMAIX_SLOT_CNT || (encrypted_model == NULL && model_size != 0)) {
+        return TINYMAIX_STATUS_ERROR_INVALID_PARAM;
+    }
+    
+    /* Connect to service */
+    handle = psa_connect(TFM_TINYMAIX_INFERENCE_SID, 1);
+    if (handle <= 0) {
+        return TINYMAIX_STATUS_ERROR_GENERIC;
+    }
+    
+    psa_invec in_vec[] = {
+        {.base = encrypted_model, .len = model_size},
+        {.base = &params, .len = sizeof(params)}
+    };
+    
+    psa_outvec out_vec[] = {
+        {.base = &result, .len = sizeof(result)}
+    };
+    
+    status = psa_call(handle, TINYMAIX_IPC_LOAD_ENCRYPTED_MODEL, in_vec, 2, out_vec, 1);
+    
+    psa_close(handle);
+    
+    if (status != PSA_SUCCESS || result != 0) {
+        return TINYMAIX_STATUS_ERROR_MODEL_LOAD_FAILED;
+    }
+    
+    return TINYMAIX_STATUS_SUCCESS;
+}
+
+tfm_tinymaix_status_t tfm_tinymaix_run_cascade(const uint8_t* image_data, size_t image_size,
+                                               float gate_threshold, uint32_t flags,
+                                               int* predicted_class, tfm_tinymaix_run_info_t* info)
+{
+    psa_status_t status;
+    psa_handle_t handle;
+    int result = -1;
+    tfm_tinymaix_run_info_t run_info;
+    tfm_tinymaix_run_params_t params = {
+        .flags = flags | TINYMAIX_RUN_FLAG_CASCADE,
+        .gate_threshold = gate_threshold
+    };
+    
+    if (!predicted_class || (image_data == NULL && image_size != 0)) {
+        return TINYMAIX_STATUS_ERROR_INVALID_PARAM;
+    }
+    
+    /* Connect to service */
+    handle = psa_connect(TFM_TINYMAIX_INFERENCE_SID, 1);
+    if (handle <= 0) {
+        return TINYMAIX_STATUS_ERROR_GENERIC;
+    }
+    
+    psa_invec in_vec[] = {
+        {.base = image_data, .len = image_size},
+        {.base = &params, .len = sizeof(params)}
+    };
+    
+    psa_outvec out_vec[] = {
+        {.base = &result, .len = sizeof(result)},
+        {.base = &run_info, .len = sizeof(run_info)}
+    };
+    
+    status = psa_call(handle, TINYMAIX_IPC_RUN_INFERENCE, in_vec, 2, out_vec, 2);
+    
+    psa_close(handle);
+    
+    if (status != PSA_SUCCESS || result < 0) {
+        return TINYMAIX_STATUS_ERROR_INFERENCE_FAILED;
+    }
+    
+    *predicted_class = result;
+    if (info) {
+        *info = run_info;
+    }
+    return TINYMAIX_STATUS_SUCCESS;
+}
+
+tfm_tinymaix_status_t tfm_tinymaix_run_stream(const uint8_t* image_data, size_t image_size,
+                                              uint16_t tolerance, uint32_t flags,
+                                              int* predicted_class, tfm_tinymaix_run_info_t* info)
+{
+    psa_status_t status;
+    psa_handle_t handle;
+    int result = -1;
+    tfm_tinymaix_run_info_t run_info;
+    tfm_tinymaix_run_params_t params = {
+        .flags = flags | TINYMAIX_RUN_FLAG_STREAM,
+        .stream_tolerance = tolerance
+    };
+    
+    if (!predicted_class || (image_data == NULL && image_size != 0)) {
+        return TINYMAIX_STATUS_ERROR_INVALID_PARAM;
+    }
+    
+    /* Connect to service */
+    handle = psa_connect(TFM_TINYMAIX_INFERENCE_SID, 1);
+    if (handle <= 0) {
+        return TINYMAIX_STATUS_ERROR_GENERIC;
+    }
+    
+    psa_invec in_vec[] = {
+        {.base = image_data, .len = image_size},
+        {.base = &params, .len = sizeof(params)}
+    };
+    
+    psa_outvec out_vec[] = {
+        {.base = &result, .len = sizeof(result)},
+        {.base = &run_info, .len = sizeof(run_info)}
+    };
+    
+    status = psa_call(handle, TINYMAIX_IPC_RUN_INFERENCE, in_vec, 2, out_vec, 2);
+    
+    psa_close(handle);
+    
+    if (status == PSA_ERROR_NOT_SUPPORTED) {
+        return TINYMAIX_STATUS_ERROR_NOT_SUPPORTED;
+    }
+    if (status != PSA_SUCCESS || result < 0) {
+        return TINYMAIX_STATUS_ERROR_INFERENCE_FAILED;
+    }
+    
+    *predicted_class = result;
+    if (info) {
+        *info = run_info;
+    }
+    return TINYMAIX_STATUS_SUCCESS;
+}
+
+tfm_tinymaix_status_t tfm_tinymaix_get_profile(tfm_tinymaix_profile_t* profile)
+{
+    psa_status_t status;
+    psa_handle_t handle;
+    
+    if (!profile) {
+        return TINYMAIX_STATUS_ERROR_INVALID_PARAM;
+    }
+    
+    /* Connect to service */
+    handle = psa_connect(TFM_TINYMAIX_INFERENCE_SID, 1);
+    if (handle <= 0) {
+        return TINYMAIX_STATUS_ERROR_GENERIC;
+    }
+    
+    psa_outvec out_vec[] = {
+        {.base = profile, .len = sizeof(*profile)}
+    };
+    
+    status = psa_call(handle, TINYMAIX_IPC_GET_PROFILE, NULL, 0, out_vec, 1);
+    
+    psa_close(handle);
+    
+    if (status == PSA_ERROR_NOT_SUPPORTED) {
+        return TINYMAIX_STATUS_ERROR_NOT_SUPPORTED;
+    }
+    if (status != PSA_SUCCESS) {
+        return TINYMAIX_STATUS_ERROR_GENERIC;
+    }
+    
+    return TINYMAIX_STATUS_SUCCESS;
+}
+
+#ifdef TINYMAIX_NS_DISPATCH
+#define TINYMAIX_DISPATCH_FLAG           (1U << 24)  /* thread flag handing the service to a waiter */
+
+/* A thread waiting in the dispatcher, on its own stack */
+typedef struct tinymaix_waiter {
+    struct tinymaix_waiter* next;
+    void* thread;
+    uint32_t served;             /* dispatches before its arrival, then runs dispatched ahead of it */
+    uint32_t depth;              /* runs waiting when it was dispatched, itself included */
+} tinymaix_waiter_t;
+
+static struct {
+    void* lock;                  /* guards the dispatcher */
+    tinymaix_waiter_t* head[TINYMAIX_PRIO_CNT];
+    tinymaix_waiter_t* tail[TINYMAIX_PRIO_CNT];
+    uint32_t waiting;
+    uint32_t busy;               /* a run is in the service */
+    uint32_t hold;
+    uint32_t served;             /* runs dispatched since init */
+} g_dispatch;
+
+/* Dispatch order of the classes, most urgent first */
+static const uint8_t g_dispatch_order[TINYMAIX_PRIO_CNT] = {
+    TINYMAIX_PRIO_ALARM, TINYMAIX_PRIO_NORMAL, TINYMAIX_PRIO_TELEMETRY
+};
+
+/* Hand the service to the next waiter if it is free, lock held */
+static void dispatch_next(void)
+{
+    tinymaix_waiter_t* w;
+
+    if (g_dispatch.busy || g_dispatch.hold) {
+        return;
+    }
+    for (uint32_t i = 0; i < TINYMAIX_PRIO_CNT; i++) {
+        uint32_t prio = g_dispatch_order[i];
+
+        w = g_dispatch.head[prio];
+        if (w == NULL) {
+            continue;
+        }
+        g_dispatch.head[prio] = w->next;
+        if (g_dispatch.head[prio] == NULL) {
+            g_dispatch.tail[prio] = NULL;
+        }
+        w->depth = g_dispatch.waiting--;
+        w->served = g_dispatch.served++ - w->served;
+        g_dispatch.busy = 1;
+        os_wrapper_thread_set_flag(w->thread, TINYMAIX_DISPATCH_FLAG);
+        return;
+    }
+}
+
+/* Wait until the dispatcher hands the service to this run */
+static void dispatch_acquire(uint32_t priority, tinymaix_waiter_t* w)
+{
+    os_wrapper_mutex_acquire(g_dispatch.lock, OS_WRAPPER_WAIT_FOREVER);
+    w->next = NULL;
+    w->thread = os_wrapper_thread_get_handle();
+    w->served = g_dispatch.served;
+    if (g_dispatch.tail[priority]) {
+        g_dispatch.tail[priority]->next = w;
+    } else {
+        g_dispatch.head[priority] = w;
+    }
+    g_dispatch.tail[priority] = w;
+    g_dispatch.waiting++;
+    dispatch_next();
+    os_wrapper_mutex_release(g_dispatch.lock);
+    os_wrapper_thread_wait_flag(TINYMAIX_DISPATCH_FLAG, OS_WRAPPER_WAIT_FOREVER);
+}
+
+static void dispatch_release(void)
+{
+    os_wrapper_mutex_acquire(g_dispatch.lock, OS_WRAPPER_WAIT_FOREVER);
+    g_dispatch.busy = 0;
+    dispatch_next();
+    os_wrapper_mutex_release(g_dispatch.lock);
+}
+#endif
+
+tfm_tinymaix_status_t tfm_tinymaix_queue_init(void)
+{
+#ifdef TINYMAIX_NS_DISPATCH
+    if (g_dispatch.lock == NULL) {
+        g_dispatch.lock = os_wrapper_mutex_create();
+        if (g_dispatch.lock == NULL) {
+            return TINYMAIX_STATUS_ERROR_GENERIC;
+        }
+    }
+    return TINYMAIX_STATUS_SUCCESS;
+#else
+    return TINYMAIX_STATUS_ERROR_NOT_SUPPORTED;
+#endif
+}
+
+tfm_tinymaix_status_t tfm_tinymaix_queue_hold(uint32_t hold)
+{
+#ifdef TINYMAIX_NS_DISPATCH
+    if (g_dispatch.lock == NULL) {
+        return TINYMAIX_STATUS_ERROR_GENERIC;
+    }
+    os_wrapper_mutex_acquire(g_dispatch.lock, OS_WRAPPER_WAIT_FOREVER);
+    g_dispatch.hold = hold;
+    dispatch_next();
+    os_wrapper_mutex_release(g_dispatch.lock);
+    return TINYMAIX_STATUS_SUCCESS;
+#else
+    (void)hold;
+    return TINYMAIX_STATUS_ERROR_NOT_SUPPORTED;
+#endif
+}
+
+tfm_tinymaix_status_t tfm_tinymaix_run_priority(const uint8_t* image_data, size_t image_size,
+                                                uint32_t priority, uint32_t flags,
+                                                int* predicted_class, tfm_tinymaix_run_info_t* info)
+{
+    psa_status_t status;
+    psa_handle_t handle;
+    int result = -1;
+    tfm_tinymaix_run_info_t run_info;
+    tfm_tinymaix_run_params_t params = {
+        .flags = flags,
+        .priority = priority
+    };
+    
+#ifdef TINYMAIX_NS_DISPATCH
+    tinymaix_waiter_t waiter;
+#endif
+    
+    if (!predicted_class || priority >= TINYMAIX_PRIO_CNT || (image_data == NULL && image_size != 0)) {
+        return TINYMAIX_STATUS_ERROR_INVALID_PARAM;
+    }
+#ifdef TINYMAIX_NS_DISPATCH
+    if (g_dispatch.lock == NULL) {
+        return TINYMAIX_STATUS_ERROR_GENERIC;   /* tfm_tinymaix_queue_init() not called */
+    }
+    dispatch_acquire(priority, &waiter);
+#endif
+    
+    /* Connect to service */
+    handle = psa_connect(TFM_TINYMAIX_INFERENCE_SID, 1);
+    if (handle <= 0) {
+        status = PSA_ERROR_CONNECTION_REFUSED;
+    } else {
+        psa_invec in_vec[] = {
+            {.base = image_data, .len = image_size},
+            {.base = &params, .len = sizeof(params)}
+        };
+        
+        psa_outvec out_vec[] = {
+            {.base = &result, .len = sizeof(result)},
+            {.base = &run_info, .len = sizeof(run_info)}
+        };
+        
+        status = psa_call(handle, TINYMAIX_IPC_RUN_INFERENCE, in_vec, 2, out_vec, 2);
+        
+        psa_close(handle);
+    }
+#ifdef TINYMAIX_NS_DISPATCH
+    dispatch_release();
+    run_info.queue_depth = (uint16_t)waiter.depth;
+    run_info.queue_ahead = waiter.served;
+#endif
+    
+    if (handle <= 0) {
+        return TINYMAIX_STATUS_ERROR_GENERIC;
+    }
+    if (status != PSA_SUCCESS || result < 0) {
+        return TINYMAIX_STATUS_ERROR_INFERENCE_FAILED;
+    }
+    
+    *predicted_class = result;
+    if (info) {
+        *info = run_info;
+    }
+    return TINYMAIX_STATUS_SUCCESS;
+}
+
+/* Outcome of a budgeted run or resume: class on success, run details also when suspended */
+static tfm_tinymaix_status_t budget_result(psa_status_t status, int result,
+                                          const tfm_tinymaix_run_info_t* run_info,
+                                          int* predicted_class, tfm_tinymaix_run_info_t* info)
+{
+    if (status == PSA_OPERATION_INCOMPLETE) {
+        if (info) {
+            *info = *run_info;
+        }
+        return TINYMAIX_STATUS_INCOMPLETE;
+    }
+    if (status == PSA_ERROR_NOT_SUPPORTED) {
+        return TINYMAIX_STATUS_ERROR_NOT_SUPPORTED;
+    }
+    if (status != PSA_SUCCESS || result < 0) {
+        return TINYMAIX_STATUS_ERROR_INFERENCE_FAILED;
+    }
+    
+    *predicted_class = result;
+    if (info) {
+        *info = *run_info;
+    }
+    return TINYMAIX_STATUS_SUCCESS;
+}
+
+tfm_tinymaix_status_t tfm_tinymaix_run_budget(const uint8_t* image_data, size_t image_size,
+                                              uint32_t budget, uint32_t flags,
+                                              int* predicted_class, tfm_tinymaix_run_info_t* info)
+{
+    psa_status_t status;
+    psa_handle_t handle;
+    int result = -1;
+    tfm_tinymaix_run_info_t run_info;
+    tfm_tinymaix_run_params_t params = {
+        .flags = flags,
+        .budget = budget
+    };
+    
+    if (!predicted_class || (image_data == NULL && image_size != 0)) {
+        return TINYMAIX_STATUS_ERROR_INVALID_PARAM;
+    }
+    
+    /* Connect to service */
+    handle = psa_connect(TFM_TINYMAIX_INFERENCE_SID, 1);
+    if (handle <= 0) {
+        return TINYMAIX_STATUS_ERROR_GENERIC;
+    }
+    
+    psa_invec in_vec[] = {
+        {.base = image_data, .len = image_size},
+        {.base = &params, .len = sizeof(params)}
+    };
+    
+    psa_outvec out_vec[] = {
+        {.base = &result, .len = sizeof(result)},
+        {.base = &run_info, .len = sizeof(run_info)}
+    };
+    
+    status = psa_call(handle, TINYMAIX_IPC_RUN_INFERENCE, in_vec, 2, out_vec, 2);
+    
+    psa_close(handle);
+    
+    return budget_result(status, result, &run_info, predicted_class, info);
+}
+
+tfm_tinymaix_status_t tfm_tinymaix_resume(uint32_t token, uint32_t budget,
+                                          int* predicted_class, tfm_tinymaix_run_info_t* info)
+{
+    psa_status_t status;
+    psa_handle_t handle;
+    int result = -1;
+    tfm_tinymaix_run_info_t run_info;
+    tfm_tinymaix_resume_params_t params = {
+        .token = token,
+        .budget = budget
+    };
+    
+    if (!predicted_class || token == 0) {
+        return TINYMAIX_STATUS_ERROR_INVALID_PARAM;
+    }
+    
+    /* Connect to service */
+    handle = psa_connect(TFM_TINYMAIX_INFERENCE_SID, 1);
+    if (handle <= 0) {
+        return TINYMAIX_STATUS_ERROR_GENERIC;
+    }
+    
+    psa_invec in_vec[] = {
+        {.base = &params, .len = sizeof(params)}
+    };
+    
+    psa_outvec out_vec[] = {
+        {.base = &result, .len = sizeof(result)},
+        {.base = &run_info, .len = sizeof(run_info)}
+    };
+    
+    status = psa_call(handle, TINYMAIX_IPC_RESUME_INFERENCE, in_vec, 1, out_vec, 2);
+    
+    psa_close(handle);
+    
+    return budget_result(status, result, &run_info, predicted_class, info);
+}
+
+tfm_tinymaix_status_t tfm_tinymaix_get_queue_stats(tfm_tinymaix_queue_stats_t* stats)
+{
+    psa_status_t status;
+    psa_handle_t handle;
+    
+    if (!stats) {
+        return TINYMAIX_STATUS_ERROR_INVALID_PARAM;
+    }
+    
+    /* Connect to service */
+    handle = psa_connect(TFM_TINYMAIX_INFERENCE_SID, 1);
+    if (handle <= 0) {
+        return TINYMAIX_STATUS_ERROR_GENERIC;
+    }
+    
+    psa_outvec out_vec[] = {
+        {.base = stats, .len = sizeof(*stats)}
+    };
+    
+    status = psa_call(handle, TINYMAIX_IPC_GET_QUEUE_STATS, NULL, 0, out_vec, 1);
+    
+    psa_close(handle);
+    
+    if (status == PSA_ERROR_NOT_SUPPORTED) {
+        return TINYMAIX_STATUS_ERROR_NOT_SUPPORTED;
+    }
+    if (status != PSA_SUCCESS) {
+        return TINYMAIX_STATUS_ERROR_GENERIC;
+    }
+    
+    return TINYMAIX_STATUS_SUCCESS;
+}
+
+tfm_tinymaix_status_t tfm_tinymaix_get_stats(tfm_tinymaix_stats_t* stats, uint32_t flags)
+{
+    psa_status_t status;
+    psa_handle_t handle;
+    
+    if (!stats && !(flags & TINYMAIX_STATS_FLAG_RESET)) {
+        return TINYMAIX_STATUS_ERROR_INVALID_PARAM;
+    }
+    
+    /* Connect to service */
+    handle = psa_connect(TFM_TINYMAIX_INFERENCE_SID, 1);
+    if (handle <= 0) {
+        return TINYMAIX_STATUS_ERROR_GENERIC;
+    }
+    
+    psa_invec in_vec[] = {
+        {.base = &flags, .len = sizeof(flags)}
+    };
+    
+    psa_outvec out_vec[] = {
+        {.base = stats, .len = stats ? sizeof(*stats) : 0}
+    };
+    
+    status = psa_call(handle, TINYMAIX_IPC_GET_STATS, in_vec, 1, out_vec, 1);
+    
+    psa_close(handle);
+    
+    if (status != PSA_SUCCESS) {
+        return TINYMAIX_STATUS_ERROR_GENERIC;
+    }
+    
+    return TINYMAIX_STATUS_SUCCESS;
+}
+
 #ifdef DEV_MODE
 tfm_tinymaix_status_t tfm_tinymaix_get_model_key(uint8_t* key_buffer, size_t key_buffer_size)
 {
@@ -5,159 +5,159 @@
 
 /* Encrypted model data (2444 bytes) */
 const uint8_t encrypted_mdl_data_data[] = {
-    0x54, 0x4d, 0x41, 0x58, 0x03, 0x00, 0x00, 0x00, 0x68, 0x09, 0x00, 0x00, 0xea, 0x64, 0x06, 0xa9,
-    0xa5, 0x5e, 0xce, 0x4b, 0x35, 0xec, 0x21, 0x5b, 0x49, 0x05, 0x9d, 0xfd, 0xa3, 0xce, 0x61, 0x81,
-    0xfe, 0x26, 0x87, 0xe9, 0xee, 0x65, 0x24, 0xd4, 0x74, 0x62, 0x19, 0x40, 0x94, 0xa5, 0xf1, 0x4c,
-    0xc0, 0x1b, 0xc6, 0x24, 0xd6, 0x35, 0xae, 0xfe, 0xcd, 0xc1, 0x71, 0x2b, 0x92, 0x01, 0x0c, 0x91,
-    0xfa, 0x95, 0xd1, 0x48, 0x33, 0xe1, 0x6d, 0xf6, 0x9c, 0x22, 0x9a, 0x14, 0xd3, 0xec, 0x45, 0x81,
-    0x16, 0xdc, 0x85, 0x97, 0xe2, 0x6a, 0x01, 0xde, 0x99, 0xa5, 0x21, 0x52, 0x37, 0x8e, 0x4f, 0xff,
-    0x62, 0x86, 0x30, 0x71, 0xb2, 0x50, 0x6c, 0x46, 0xf8, 0xdb, 0x2d, 0x5f, 0x49, 0xc8, 0x2d, 0xf9,
-    0xe5, 0xf8, 0xc5, 0xdf, 0xb5, 0xa0, 0x4b, 0x1c, 0xc1, 0x6f, 0x61, 0x02, 0xec, 0xed, 0xec, 0x0d,
-    0x68, 0xde, 0x1f, 0x7f, 0xd1, 0x41, 0x1c, 0xb8, 0xc8, 0x64, 0x2f, 0x2b, 0xee, 0x3e, 0x8f, 0xdb,
-    0x84, 0xdb, 0xec, 0x01, 0x2b, 0xba, 0x2f, 0x24, 0xc9, 0x3e, 0x91, 0x51, 0xe4, 0xb8, 0xc0, 0xc7,
-    0xd4, 0x5d, 0x28, 0x75, 0x7a, 0x38, 0xc8, 0x03, 0xaa, 0xdb, 0x07, 0x2c, 0x08, 0xda, 0xd5, 0x23,
-    0xf7, 0x59, 0xe7, 0x35, 0x99, 0xec, 0x92, 0xaf, 0x1b, 0x26, 0x2f, 0xce, 0xd7, 0x8f, 0x56, 0xab,
-    0x73, 0x40, 0x51, 0x1e, 0xfc, 0x89, 0x94, 0xb3, 0xdd, 0xca, 0xe2, 0x1e, 0x55, 0x9f, 0x15, 0x33,
-    0xd2, 0x45, 0x6b, 0x68, 0xd6, 0x9b, 0xd3, 0x3d, 0x52, 0xc6, 0x45, 0x69, 0xd1, 0x0e, 0x88, 0x5d,
-    0xe4, 0x39, 0x9c, 0x10, 0x5b, 0xb0, 0x77, 0x6d, 0xae, 0xbb, 0x40, 0x96, 0xa0, 0x9f, 0x52, 0x9e,
-    0x73, 0x78, 0xdb, 0x3b, 0x79, 0x6e, 0x8e, 0x61, 0x77, 0xc7, 0xbb, 0xb8, 0x00, 0x19, 0xc8, 0x99,
-    0x45, 0xa4, 0xc8, 0xb9, 0xbb, 0x2c, 0x14, 0xd5, 0x5a, 0x72, 0x4a, 0xbc, 0x8b, 0xf0, 0x73, 0x72,
-    0x6b, 0xe1, 0x71, 0x68, 0xcf, 0xd6, 0x0f, 0xef, 0xe2, 0xa1, 0x91, 0xa8, 0xcc, 0x4f, 0xff, 0x57,
-    0xa5, 0x3b, 0x32, 0x10, 0x76, 0x25, 0xf5, 0x32, 0x96, 0x7c, 0xc5, 0x2d, 0x89, 0xa9, 0xbe, 0xd7,
-    0x2b, 0x44, 0xf8, 0x19, 0xaa, 0xec, 0xb1, 0x55, 0x48, 0x66, 0x74, 0x12, 0x09, 0x5d, 0x75, 0x58,
-    0xf1, 0x01, 0x64, 0x42, 0x3c, 0x7c, 0x26, 0x8f, 0x2a, 0x80, 0x40, 0xf0, 0xab, 0x7e, 0x3b, 0x31,
-    0x48, 0x16, 0xb9, 0xd5, 0x35, 0x01, 0xa1, 0x3f, 0xaf, 0x33, 0x29, 0x02, 0xe7, 0xbd, 0x6f, 0x45,
-    0x0f, 0x83, 0x30, 0x35, 0x27, 0xe7, 0x1d, 0x04, 0x92, 0xfb, 0xcd, 0xea, 0x47, 0x92, 0x00, 0x4b,
-    0x24, 0x01, 0x2b, 0x24, 0x7a, 0x21, 0xa2, 0x85, 0x02, 0xb7, 0x40, 0x78, 0x3a, 0x8c, 0xf3, 0xa0,
-    0xe5, 0xf1, 0x09, 0x86, 0x22, 0xb7, 0x98, 0x18, 0xf0, 0x70, 0xbd, 0x40, 0xf4, 0x1d, 0xb4, 0x82,
-    0x74, 0x26, 0x9e, 0x2d, 0x43, 0x2b, 0xcd, 0x2b, 0x80, 0xfa, 0x75, 0xa6, 0x38, 0x02, 0x7e, 0x20,
-    0x92, 0x64, 0xa9, 0x79, 0xc0, 0x51, 0xe8, 0x29, 0x0d, 0x25, 0x57, 0xd3, 0x1b, 0x30, 0xd1, 0x86,
-    0xeb, 0x25, 0xb0, 0x77, 0x3b, 0x9e, 0xb9, 0xb4, 0xda, 0x8a, 0x15, 0x47, 0x7d, 0x49, 0x9f, 0x94,
-    0xe0, 0x32, 0x6f, 0xac, 0xd7, 0x01, 0x05, 0xee, 0xfd, 0xa4, 0x08, 0x7c, 0xc6, 0x06, 0x7d, 0x49,
-    0x69, 0x5a, 0xaa, 0x7a, 0xb8, 0x99, 0x33, 0x22, 0xf0, 0x88, 0xe2, 0xfc, 0x17, 0x7b, 0x25, 0xdb,
-    0x9e, 0x6a, 0x20, 0xe3, 0x09, 0x79, 0x5f, 0xa4, 0x0a, 0x04, 0xea, 0xa2, 0x34, 0x69, 0x50, 0x73,
-    0xa4, 0xe3, 0x99, 0x0f, 0xc3, 0xd8, 0x68, 0x0b, 0x48, 0x17, 0x82, 0x5d, 0x8e, 0x44, 0x81, 0xc9,
-    0x1d, 0x4c, 0xf2, 0x6b, 0x84, 0x25, 0xb9, 0x9e, 0xb8, 0x73, 0xd3, 0xf9, 0x7b, 0x7f, 0x3c, 0x2f,
-    0x8f, 0xe2, 0xe0, 0x1c, 0x83, 0x2c, 0xb0, 0x4a, 0x61, 0x09, 0x98, 0x40, 0x82, 0x93, 0x7b, 0x10,
-    0xb2, 0x5d, 0x04, 0x91, 0x11, 0xf9, 0x1f, 0x95, 0x04, 0x63, 0xf7, 0x0c, 0xe1, 0x0a, 0x70, 0xd5,
-    0x08, 0x03, 0x2c, 0x17, 0x35, 0xa2, 0xbb, 0xd3, 0x08, 0x21, 0x72, 0x3d, 0xa4, 0xe8, 0x33, 0x77,
-    0x3a, 0xd3, 0xb9, 0xcf, 0xee, 0xaf, 0xa7, 0x3c, 0xa8, 0xc8, 0x74, 0x2f, 0x4e, 0xa2, 0x8b, 0x25,
-    0xdd, 0xe1, 0x34, 0x9c, 0xa1, 0x05, 0xc4, 0x16, 0xeb, 0x59, 0xe2, 0xd6, 0xbf, 0xea, 0x93, 0x13,
-    0x87, 0x30, 0x23, 0x11, 0x37, 0x0a, 0xfb, 0x71, 0xa9, 0xa0, 0xa4, 0x6b, 0xbb, 0xf4, 0x3b, 0xa3,
-    0xdc, 0xed, 0xb6, 0x4a, 0x1a, 0x4a, 0xae, 0x5b, 0xf9, 0xa9, 0xab, 0xbf, 0x4a, 0xe7, 0x18, 0xb3,
-    0xc5, 0xac, 0x1c, 0xe4, 0x8b, 0x0f, 0xf3, 0x6f, 0x05, 0x1a, 0x07, 0x29, 0xc7, 0x19, 0x1e, 0x70,
-    0x07, 0x70, 0xb1, 0xc0, 0x0a, 0xae, 0xa8, 0xbb, 0x57, 0xdc, 0x0c, 0x68, 0xd6, 0xb1, 0x3b, 0xbb,
-    0x28, 0x6c, 0x8c, 0x90, 0x38, 0x96, 0x62, 0x53, 0x48, 0xe2, 0x2a, 0x43, 0x0c, 0xeb, 0x6c, 0x08,
-    0xe6, 0xca, 0xaa, 0x70, 0xad, 0x98, 0x5e, 0x59, 0x55, 0x5b, 0xb4, 0xed, 0xf0, 0x4c, 0x39, 0x93,
-    0x8a, 0x0a, 0xc5, 0x19, 0xa2, 0x45, 0xb9, 0x69, 0x5b, 0x5d, 0xa9, 0xe2, 0x0d, 0x8c, 0x1e, 0x6a,
-    0x0e, 0x9e, 0x65, 0x6e, 0xde, 0x1b, 0x74, 0xa0, 0xbc, 0x49, 0xed, 0x4a, 0x22, 0x51, 0x11, 0x33,
-    0x03, 0xc6, 0xc1, 0x21, 0x6f, 0x7e, 0x8f, 0x9e, 0x83, 0x38, 0x44, 0x86, 0x20, 0x8a, 0xe8, 0xf2,
-    0x6a, 0x5e, 0x65, 0xf4, 0x4d, 0xf2, 0xa6, 0xbf, 0xff, 0x67, 0x1b, 0xd2, 0x36, 0x58, 0xcc, 0x54,
-    0xfc, 0x5a, 0x26, 0xb6, 0x4d, 0x0d, 0x0f, 0xa8, 0x32, 0xd8, 0x75, 0x60, 0xac, 0xc6, 0xf5, 0xe0,
-    0x3e, 0x3c, 0xd9, 0xdd, 0x36, 0xa3, 0x09, 0x3f, 0x1f, 0xaa, 0xbb, 0xb8, 0xdc, 0x10, 0x82, 0xb7,
-    0x6a, 0x8a, 0x3a, 0x6b, 0xcf, 0xc3, 0x4d, 0x95, 0x11, 0x0e, 0x82, 0xcf, 0x5e, 0x27, 0x5d, 0x18,
-    0x39, 0x6c, 0x08, 0x36, 0x6c, 0x0d, 0x7e, 0x31, 0x2d, 0xd6, 0xcb, 0x54, 0x1f, 0x06, 0x29, 0xf2,
-    0xd5, 0xd9, 0x13, 0x46, 0xa3, 0xc6, 0x4f, 0xe1, 0xd5, 0xe6, 0x6a, 0x4c, 0xf9, 0x77, 0x61, 0x10,
-    0xbb, 0x79, 0x8e, 0x08, 0x90, 0xa9, 0xd3, 0x7c, 0x48, 0x6d, 0x9d, 0x6d, 0x20, 0x17, 0x58, 0xe9,
-    0xfc, 0x22, 0xd1, 0x22, 0x58, 0xec, 0xd0, 0x05, 0x8c, 0xab, 0x89, 0xd4, 0x31, 0xdd, 0x67, 0xe9,
-    0x93, 0x85, 0x72, 0xb7, 0x58, 0x9d, 0x27, 0x09, 0xe8, 0x07, 0xdb, 0x57, 0x96, 0x2f, 0x29, 0x26,
-    0x9c, 0x7e, 0xd2, 0x96, 0xdc, 0x41, 0x03, 0xa4, 0xe7, 0x14, 0x59, 0x02, 0x44, 0x2f, 0xd1, 0x40,
-    0xa1, 0xe1, 0x1a, 0xa7, 0xd8, 0x85, 0xcc, 0xcc, 0x13, 0xa0, 0x80, 0x6f, 0x04, 0xbc, 0x28, 0x5d,
-    0xd8, 0x3a, 0xa0, 0xaa, 0xc0, 0x1d, 0xbf, 0x22, 0x06, 0x65, 0xc9, 0xce, 0x1e, 0x78, 0xe3, 0xa8,
-    0xeb, 0xf6, 0xde, 0xa1, 0xf1, 0x25, 0x18, 0xe3, 0xd2, 0x43, 0xa1, 0x32, 0xf4, 0x05, 0x7d, 0x1e,
-    0x38, 0xc3, 0xa9, 0x06, 0xc2, 0xe7, 0xfe, 0x1b, 0x3d, 0x75, 0xe7, 0x34, 0x27, 0x90, 0x37, 0xed,
-    0xf7, 0x77, 0x86, 0xca, 0x8c, 0x41, 0x26, 0x1a, 0xa2, 0x95, 0xc7, 0xdf, 0x45, 0x39, 0x69, 0xcc,
-    0x39, 0xa5, 0x93, 0x82, 0xab, 0xf3, 0x5d, 0x82, 0x25, 0x6c, 0x8c, 0xf5, 0x32, 0x2f, 0x05, 0x19,
-    0xe5, 0xae, 0x04, 0xf7, 0xf5, 0xed, 0x8e, 0x6a, 0x5c, 0xfe, 0x82, 0xcc, 0x4d, 0xc4, 0x67, 0x1e,
-    0xf3, 0x6c, 0xf4, 0xe3, 0x1a, 0xd6, 0x49, 0x5a, 0xc1, 0xd7, 0xc9, 0xae, 0x21, 0xd8, 0x8b, 0x5f,
-    0xc0, 0xb7, 0x0e, 0x4c, 0xf3, 0xe0, 0xff, 0x34, 0x76, 0x2a, 0x5b, 0xd8, 0xfd, 0x96, 0x1d, 0x27,
-    0x23, 0x94, 0x40, 0xf4, 0xdf, 0x7c, 0x75, 0x56, 0x31, 0xe3, 0x0d, 0xfa, 0xa3, 0xa7, 0xe4, 0x96,
-    0x1d, 0x86, 0x62, 0xd0, 0xfc, 0xc2, 0xb4, 0x00, 0x0e, 0x07, 0x81, 0xcc, 0xc5, 0xe9, 0x1b, 0x32,
-    0xaf, 0x73, 0xa0, 0xa9, 0xc6, 0x1b, 0x66, 0x3a, 0x87, 0x11, 0x28, 0xf5, 0x15, 0xee, 0xa6, 0xdb,
-    0x14, 0xf5, 0x24, 0xdb, 0xc1, 0xcc, 0x3a, 0x6e, 0x9f, 0xfd, 0x20, 0xaa, 0x6a, 0x83, 0x97, 0x77,
-    0xe7, 0x7d, 0xa0, 0xb6, 0x0c, 0x92, 0x31, 0x4d, 0x14, 0xfb, 0x97, 0xc7, 0xff, 0xf9, 0x86, 0xda,
-    0x6a, 0x55, 0x54, 0x8d, 0x5f, 0x76, 0xb8, 0x63, 0x9c, 0x30, 0xda, 0x3f, 0x31, 0x92, 0x20, 0xcd,
-    0x74, 0xdd, 0xeb, 0xd7, 0x3a, 0x18, 0x4f, 0x63, 0x77, 0x05, 0xc6, 0xc8, 0x3c, 0xa9, 0x82, 0x4a,
-    0x22, 0x51, 0xb4, 0x51, 0x45, 0xdb, 0x3a, 0x2c, 0xf6, 0x8f, 0x6d, 0xeb, 0x75, 0xa8, 0x1d, 0x4f,
-    0x5d, 0xbf, 0xe3, 0x14, 0x04, 0x3a, 0xf8, 0x25, 0xbb, 0xdb, 0xb4, 0x1e, 0xdc, 0x9b, 0xde, 0xd9,
-    0xb9, 0xaf, 0xf9, 0x9c, 0x35, 0xc0, 0x4d, 0xd6, 0x05, 0xf0, 0x4b, 0x73, 0x7d, 0xfd, 0x3e, 0x63,
-    0x82, 0x99, 0xe1, 0x20, 0x8f, 0xc5, 0x87, 0x6a, 0x3f, 0xaf, 0x62, 0xf0, 0x22, 0xff, 0xf1, 0x5b,
-    0xae, 0xef, 0x32, 0xd9, 0x72, 0xf3, 0x27, 0x95, 0x7b, 0xc7, 0x31, 0x00, 0xe3, 0x50, 0x7a, 0x07,
-    0x46, 0xd2, 0xce, 0x45, 0x3d, 0xa5, 0x86, 0x23, 0xd7, 0x69, 0x6c, 0x52, 0x83, 0x55, 0xf8, 0x25,
-    0x97, 0xcf, 0x3d, 0x88, 0x66, 0x3b, 0xab, 0x79, 0x97, 0x07, 0xf7, 0x90, 0x43, 0x5e, 0xb5, 0xf0,
-    0x05, 0x45, 0x57, 0xe0, 0x4f, 0xbe, 0xbd, 0x57, 0xab, 0xc8, 0x0d, 0x88, 0x19, 0xfd, 0xad, 0x76,
-    0x21, 0x01, 0xff, 0x83, 0x76, 0x2d, 0xb8, 0xb7, 0xa2, 0xbf, 0x41, 0x5f, 0xcc, 0xee, 0x11, 0x1f,
-    0x86, 0x0b, 0x41, 0xdc, 0x42, 0x2d, 0x0e, 0xb7, 0xc2, 0xef, 0x56, 0x57, 0xc6, 0x78, 0x85, 0xbf,
-    0x92, 0xfc, 0x5d, 0xb1, 0xb7, 0x5d, 0xe6, 0x60, 0x46, 0xa9, 0x31, 0xfa, 0x50, 0xce, 0x4d, 0xec,
-    0x9b, 0xbf, 0xcc, 0x79, 0x79, 0x8f, 0xd9, 0x3a, 0x00, 0x17, 0x14, 0xed, 0x9c, 0x0c, 0x26, 0x24,
-    0x01, 0xba, 0xae, 0xa8, 0x55, 0xcb, 0x54, 0xde, 0xaf, 0x06, 0x49, 0xe4, 0x96, 0x04, 0x77, 0xcb,
-    0xef, 0xcf, 0x58, 0x80, 0x20, 0x83, 0x64, 0x46, 0x56, 0x4d, 0xd4, 0x2b, 0x63, 0xbd, 0x92, 0xef,
-    0x97, 0xb1, 0x61, 0x0a, 0xa9, 0xea, 0x64, 0xbf, 0x30, 0x6b, 0x2d, 0x55, 0x80, 0xad, 0x51, 0x54,
-    0x0d, 0x2f, 0x97, 0x34, 0x08, 0xc4, 0x8b, 0xf4, 0x31, 0x76, 0xa0, 0xa1, 0x1d, 0x21, 0x05, 0x36,
-    0x04, 0xfd, 0x69, 0x93, 0x08, 0x31, 0x0f, 0x7e, 0x4a, 0xe7, 0x7d, 0x01, 0xe4, 0xdb, 0x81, 0x1b,
-    0xe1, 0x75, 0xaf, 0x08, 0xaf, 0x7b, 0xa1, 0x9f, 0x20, 0xdb, 0xef, 0x67, 0x32, 0x01, 0xc3, 0xc1,
-    0x64, 0x95, 0x75, 0x06, 0x1b, 0xff, 0xe0, 0xe5, 0xb5, 0x36, 0x40, 0x7a, 0x71, 0xea, 0x5c, 0x97,
-    0x01, 0x9b, 0xc8, 0x2b, 0x9a, 0x43, 0x57, 0x81, 0x7b, 0x23, 0xb8, 0x8b, 0xa7, 0x17, 0xbb, 0x43,
-    0x35, 0xd8, 0x30, 0xef, 0x78, 0x6f, 0x32, 0xbc, 0xc7, 0x3c, 0xb3, 0xa4, 0xd6, 0x49, 0xa4, 0x09,
-    0x90, 0x68, 0xd9, 0x29, 0xd7, 0x40, 0x47, 0x45, 0xee, 0x1c, 0x3f, 0x96, 0xce, 0x16, 0xbf, 0x7d,
-    0x65, 0xa4, 0x5a, 0xf3, 0x28, 0x43, 0xeb, 0x6c, 0x7d, 0xe5, 0xb9, 0xba, 0xd8, 0xc7, 0x82, 0x20,
-    0x07, 0x6c, 0xc3, 0xe6, 0x08, 0x59, 0x6e, 0x47, 0xd9, 0x5e, 0xbc, 0xa5, 0x88, 0x8e, 0xaa, 0xef,
-    0x22, 0xa6, 0xcb, 0xa4, 0x6d, 0x15, 0x5d, 0x67, 0xab, 0x23, 0x32, 0x7e, 0xe1, 0x9d, 0xb8, 0xb1,
-    0x7f, 0x9a, 0x8c, 0xb8, 0x5f, 0xc4, 0x7b, 0xce, 0x72, 0x2d, 0x60, 0x0b, 0xfa, 0x9e, 0x38, 0xa5,
-    0x81, 0x90, 0x43, 0x0d, 0x13, 0x24, 0xc9, 0xc2, 0x66, 0x07, 0xd1, 0xd4, 0xae, 0x99, 0x69, 0x86,
-    0xb6, 0xa8, 0x71, 0x7d, 0x89, 0xcf, 0xd9, 0x36, 0x99, 0x56, 0xb6, 0x1e, 0x99, 0xa5, 0xe4, 0x1f,
-    0x48, 0x40, 0x1a, 0xdd, 0xb9, 0xdd, 0x4a, 0x16, 0x81, 0x3b, 0x63, 0x29, 0xb5, 0x2e, 0x8b, 0x8f,
-    0x83, 0xa1, 0x7c, 0x0b, 0x66, 0x82, 0x52, 0xa3, 0x80, 0xb8, 0x32, 0x86, 0xcc, 0xd8, 0x42, 0xf5,
-    0x3b, 0x23, 0x9c, 0xa5, 0x47, 0x31, 0x2e, 0x55, 0x35, 0xaa, 0x10, 0x20, 0x30, 0x55, 0x85, 0x83,
-    0xa5, 0xa6, 0xc1, 0x23, 0xa5, 0x86, 0x3d, 0xb4, 0x05, 0xf4, 0x18, 0x9c, 0xd6, 0xbf, 0x72, 0x9d,
-    0x13, 0x07, 0xd7, 0x44, 0x5d, 0x51, 0xd8, 0x23, 0x08, 0xdb, 0xb9, 0x49, 0xd1, 0x67, 0xe2, 0xd5,
-    0x86, 0xd4, 0x8d, 0xc6, 0x48, 0xa4, 0xbd, 0x3a, 0x0d, 0xcd, 0xd6, 0xf4, 0xde, 0x13, 0xd6, 0x01,
-    0x2f, 0x9c, 0x2c, 0x1c, 0x18, 0xcf, 0xa5, 0x78, 0xd5, 0x88, 0x29, 0x00, 0x9a, 0x1b, 0x6c, 0xa3,
-    0x9c, 0x05, 0x9f, 0x87, 0xce, 0x6a, 0x6e, 0x52, 0x0e, 0x56, 0x49, 0x15, 0x60, 0xa1, 0x4c, 0x57,
-    0x6a, 0x83, 0x31, 0x01, 0xb2, 0x78, 0xe5, 0x61, 0xd1, 0x5b, 0x92, 0x78, 0x90, 0xf9, 0x61, 0xca,
-    0x04, 0x6b, 0xc2, 0xe5, 0x85, 0x33, 0xc7, 0x2b, 0x76, 0x58, 0xba, 0x14, 0xc7, 0xdb, 0xb2, 0xb9,
-    0x25, 0x5d, 0x6d, 0xd4, 0x5e, 0x82, 0xee, 0x7e, 0x95, 0x51, 0xa9, 0x54, 0xf1, 0xb0, 0xfb, 0x71,
-    0xa2, 0x00, 0x12, 0x74, 0x9c, 0xa7, 0xe0, 0x2e, 0x2f, 0x14, 0x82, 0xb4, 0xb9, 0x85, 0x1d, 0x60,
-    0xf1, 0x51, 0xb4, 0x28, 0x2d, 0x12, 0x2c, 0x1d, 0x9f, 0x5c, 0x26, 0x7e, 0x70, 0x74, 0x16, 0xff,
-    0xaa, 0xee, 0x88, 0x36, 0xab, 0x3f, 0x5e, 0xe3, 0x34, 0xc2, 0x17, 0xf0, 0xb1, 0xfa, 0x12, 0x09,
-    0x0e, 0x92, 0x3d, 0x26, 0x8b, 0xd6, 0x4b, 0x39, 0xbb, 0x3d, 0x8a, 0xc0, 0xa4, 0xd2, 0x22, 0x9b,
-    0xc3, 0x7e, 0xe6, 0xc8, 0xf2, 0xaf, 0xfe, 0xd0, 0x0d, 0xf3, 0x1d, 0x47, 0xa7, 0x55, 0x40, 0x89,
-    0xec, 0x3e, 0x92, 0xa6, 0x3a, 0x45, 0x62, 0xbf, 0x45, 0x30, 0x8b, 0x98, 0x1e, 0xf9, 0x84, 0x1d,
-    0x1d, 0x9f, 0xf4, 0x67, 0xd4, 0x93, 0x07, 0xbe, 0xc0, 0xf0, 0xff, 0x22, 0xdb, 0x3d, 0xa6, 0x45,
-    0x2b, 0x1a, 0x98, 0x89, 0xf5, 0xa0, 0x3f, 0x02, 0xce, 0xb1, 0x71, 0xbe, 0x04, 0xe5, 0x4c, 0x43,
-    0x2f, 0x05, 0x59, 0x8c, 0xa6, 0xec, 0xe9, 0x0d, 0x59, 0x6f, 0xe3, 0x44, 0x68, 0x21, 0xbc, 0xa3,
-    0xb6, 0x94, 0xd2, 0x21, 0x41, 0x36, 0x61, 0xd4, 0xbc, 0x53, 0xbc, 0x89, 0x40, 0x5b, 0xa4, 0x4f,
-    0x78, 0x87, 0x91, 0xa1, 0x30, 0xd5, 0x6e, 0xc3, 0xe0, 0xc8, 0xd7, 0xbd, 0xe8, 0xe1, 0xbf, 0xd4,
-    0x8d, 0xc9, 0xc3, 0x96, 0x70, 0xcd, 0x39, 0x1f, 0x0f, 0xfe, 0x71, 0xae, 0x7c, 0x87, 0x0e, 0x2c,
-    0x39, 0xc5, 0x94, 0x9b, 0x9c, 0x92, 0xb9, 0x87, 0xfe, 0xf3, 0x7f, 0xa3, 0x91, 0x68, 0xde, 0x98,
-    0x74, 0xd8, 0xdf, 0xbd, 0x42, 0x01, 0x35, 0x4d, 0x0b, 0x79, 0x9e, 0xf0, 0x43, 0xb7, 0xae, 0xf4,
-    0x33, 0xad, 0x71, 0x1f, 0xbe, 0x1e, 0x7d, 0xee, 0xc4, 0x9c, 0x27, 0x03, 0x1c, 0xf7, 0xa3, 0x25,
-    0xc2, 0x0e, 0x49, 0x1e, 0xcf, 0x7f, 0x95, 0xd1, 0xc9, 0xa9, 0x33, 0x05, 0x38, 0x36, 0x70, 0x85,
-    0x95, 0xc1, 0xba, 0x95, 0x6b, 0xd9, 0x3a, 0x5e, 0x87, 0x0a, 0xd1, 0x29, 0x81, 0x28, 0x8c, 0xc8,
-    0xea, 0xc4, 0x50, 0x41, 0x70, 0xb3, 0x13, 0x66, 0xcc, 0x11, 0xea, 0x3c, 0xa1, 0x60, 0xae, 0x9e,
-    0xd7, 0x6c, 0xb0, 0x6c, 0xc7, 0xcf, 0x07, 0x45, 0xff, 0xc0, 0xe5, 0x47, 0xf8, 0x02, 0x2a, 0x70,
-    0xd5, 0x84, 0x14, 0x92, 0x02, 0x7e, 0xa6, 0x09, 0x79, 0xbd, 0x47, 0xf0, 0xe2, 0x38, 0x33, 0xb6,
-    0xe7, 0x80, 0x72, 0x56, 0xbf, 0xcb, 0x64, 0xf2, 0x7d, 0x34, 0xcd, 0x75, 0xee, 0x0d, 0xb1, 0xe1,
-    0x92, 0x8e, 0xde, 0x1d, 0x4f, 0xc6, 0x3f, 0x67, 0x95, 0xa0, 0x4f, 0x74, 0x03, 0x05, 0x5e, 0xe2,
-    0xee, 0xbb, 0xdf, 0x8b, 0xd0, 0x53, 0xdc, 0xed, 0xc2, 0x8b, 0x81, 0x3c, 0x47, 0x96, 0x12, 0xa9,
-    0x14, 0x7f, 0xb8, 0x52, 0xc0, 0xde, 0x12, 0x4d, 0x96, 0x70, 0x60, 0x89, 0x80, 0xc9, 0x85, 0xce,
-    0xe5, 0x6b, 0x93, 0x07, 0x44, 0x48, 0xd4, 0x99, 0xb1, 0xed, 0x96, 0x72, 0x23, 0x19, 0xfd, 0x72,
-    0xbd, 0x00, 0x69, 0x36, 0x3c, 0xfb, 0x58, 0x9e, 0x7e, 0xc4, 0xb5, 0xb4, 0x08, 0xf3, 0xa7, 0xec,
-    0x2a, 0xc0, 0x90, 0x9f, 0xc1, 0xb5, 0xe8, 0xc8, 0x9d, 0xde, 0x94, 0xa6, 0xdd, 0x10, 0x10, 0xcc,
-    0xe2, 0x14, 0x9c, 0x5e, 0xa9, 0x18, 0xda, 0x58, 0x75, 0x9d, 0xf4, 0xbf, 0xbd, 0xce, 0x09, 0xbc,
-    0x8b, 0x26, 0xa7, 0x46, 0x59, 0x19, 0x8c, 0xf5, 0xe6, 0xcf, 0xd6, 0xbb, 0x5a, 0x17, 0x5e, 0x0c,
-    0x5e, 0xf3, 0x3a, 0x55, 0x7a, 0xfb, 0x93, 0x66, 0x18, 0xfd, 0x51, 0x3d, 0xdc, 0xba, 0x79, 0x98,
-    0x95, 0x3a, 0x79, 0xbf, 0xee, 0x77, 0x67, 0xfd, 0xc3, 0x07, 0xef, 0x4c, 0x3d, 0x56, 0xbb, 0x5b,
-    0x22, 0x51, 0x8b, 0x47, 0xee, 0x20, 0x1f, 0xef, 0xb4, 0x67, 0xe9, 0x07, 0xec, 0x28, 0x40, 0xd1,
-    0x5d, 0xf5, 0x74, 0xc9, 0xda, 0xbf, 0x04, 0x00, 0xa1, 0xa1, 0x54, 0x4c, 0x0e, 0x9f, 0x35, 0xd6,
-    0x00, 0x74, 0xb2, 0x62, 0x4e, 0x3f, 0x88, 0xa3, 0x23, 0x17, 0xb0, 0x80, 0x94, 0x5a, 0x8c, 0xcb,
-    0x9a, 0x0b, 0x32, 0x77, 0x8d, 0xce, 0x3b, 0x34, 0x2b, 0x76, 0xf0, 0x8c, 0x4e, 0x1d, 0x49, 0xca,
-    0x19, 0x9f, 0x41, 0xf0, 0x99, 0x86, 0x21, 0x56, 0x6e, 0xe1, 0xe9, 0xb2, 0x71, 0x82, 0xa8, 0x05,
-    0xe2, 0xaa, 0x0a, 0x39, 0x76, 0x26, 0x78, 0xaf, 0x58, 0x2c, 0xe0, 0xe0, 0x78, 0x03, 0x5a, 0xba,
-    0x9e, 0x8d, 0x9c, 0x89, 0x38, 0x8b, 0x6c, 0xb9, 0x12, 0x6c, 0x4d, 0xc5, 0x57, 0x24, 0xe6, 0x69,
-    0x47, 0xb3, 0x3e, 0xf5, 0x1f, 0x13, 0xa6, 0x58, 0x99, 0x32, 0x0a, 0xf8, 0x47, 0x05, 0x76, 0x62,
-    0x03, 0xe6, 0xaa, 0xe6, 0xe7, 0x03, 0x46, 0xbb, 0x7e, 0x1b, 0xba, 0x1a, 0xbc, 0xa2, 0xfd, 0xe2,
-    0xee, 0xf3, 0x3b, 0x8a, 0x61, 0x1a, 0xe4, 0xc1, 0x8d, 0x9c, 0x47, 0x38,
+    0x54, 0x4d, 0x41, 0x58, 0x03, 0x00, 0x00, 0x00, 0x68, 0x09, 0x00, 0x00, 0x84, 0xeb, 0xbd, 0xe7,
+    0xb9, 0x32, 0x47, 0xfe, 0xe4, 0x89, 0x38, 0x25, 0xb9, 0xfa, 0x2c, 0x1b, 0x56, 0x5d, 0x95, 0xc9,
+    0x21, 0x2d, 0xdd, 0xab, 0x99, 0xd8, 0xb9, 0x43, 0x62, 0xf9, 0xf1, 0x20, 0xc4, 0xd0, 0xff, 0x9f,
+    0x6d, 0xfa, 0x3f, 0x76, 0xde, 0x27, 0x7f, 0x10, 0x12, 0xef, 0xdb, 0x07, 0x33, 0xf2, 0xa4, 0x0b,
+    0x57, 0xeb, 0x72, 0x07, 0xb7, 0x13, 0x4a, 0x5c, 0xb5, 0x86, 0x81, 0xb5, 0xea, 0x36, 0xcd, 0xe2,
+    0xe2, 0x3a, 0x9b, 0x54, 0xbd, 0x6f, 0xf3, 0x82, 0xf4, 0xf3, 0xdd, 0x0f, 0x18, 0x1b, 0xde, 0x45,
+    0xc9, 0x3e, 0x31, 0x80, 0x1f, 0xbc, 0x72, 0x96, 0x3e, 0x37, 0x31, 0x98, 0x4b, 0xb0, 0xea, 0x25,
+    0xba, 0x0c, 0x64, 0x75, 0xca, 0xa9, 0xeb, 0x47, 0x35, 0x66, 0x8d, 0x1d, 0xaf, 0xf2, 0x1a, 0xcc,
+    0x4a, 0x9b, 0xde, 0x0f, 0x1d, 0x74, 0x52, 0x05, 0xc6, 0x0f, 0xc7, 0x62, 0x0b, 0xef, 0xd3, 0x04,
+    0x69, 0x32, 0xee, 0x85, 0x9a, 0xbd, 0x2b, 0xe6, 0x05, 0xe3, 0x1d, 0xeb, 0x3c, 0x1b, 0xda, 0xf8,
+    0x43, 0x9c, 0x5a, 0xf8, 0x7e, 0x00, 0xec, 0xca, 0xf2, 0x34, 0x5f, 0xce, 0xf2, 0x3c, 0x71, 0x06,
+    0x6d, 0x81, 0xa2, 0x84, 0x7a, 0x0a, 0xdd, 0x41, 0x26, 0xd1, 0x8b, 0xe7, 0x08, 0xbd, 0xbf, 0x25,
+    0x26, 0x75, 0x8a, 0x47, 0xf0, 0x57, 0x05, 0x63, 0x23, 0xfd, 0x17, 0xc6, 0x86, 0x54, 0x32, 0x3b,
+    0xdc, 0xbb, 0x6a, 0xd2, 0xe7, 0x35, 0x80, 0x4c, 0x32, 0x9d, 0x47, 0x42, 0x20, 0x5c, 0xc7, 0x61,
+    0x2a, 0xf8, 0x23, 0x17, 0xde, 0xa0, 0x27, 0x04, 0x26, 0xf0, 0x4a, 0x03, 0xc1, 0x4d, 0x94, 0x1c,
+    0xc7, 0x4b, 0x41, 0x9e, 0xf3, 0xe5, 0x9f, 0x90, 0xf0, 0xa2, 0x0d, 0x1b, 0xbc, 0xb7, 0xfd, 0x9a,
+    0x81, 0x7b, 0xaa, 0x43, 0xb9, 0x6c, 0x67, 0xf2, 0xd8, 0x40, 0x9b, 0xb7, 0x4b, 0xe9, 0x4e, 0xc2,
+    0x55, 0x3d, 0x99, 0x56, 0x3e, 0x54, 0xea, 0x9e, 0xd7, 0xfd, 0x72, 0xfb, 0x83, 0x49, 0x15, 0x4b,
+    0xd9, 0x16, 0x01, 0xa1, 0x3b, 0x15, 0x7b, 0x19, 0xbf, 0x3d, 0x2e, 0xbf, 0xc6, 0x12, 0xe3, 0x4a,
+    0xc0, 0xd7, 0x6e, 0x8a, 0x8a, 0x3f, 0x85, 0x4f, 0x41, 0x0f, 0xc2, 0xb9, 0xde, 0x83, 0x45, 0x61,
+    0x4c, 0x7d, 0xca, 0x61, 0xee, 0x11, 0x63, 0xe1, 0x95, 0x66, 0x63, 0x0a, 0x92, 0xf8, 0x09, 0x1c,
+    0xb9, 0x11, 0xd0, 0x6e, 0xfb, 0x55, 0x27, 0xa4, 0xdc, 0x0a, 0x08, 0x84, 0xf2, 0xe5, 0x36, 0xea,
+    0x2d, 0x9f, 0xe7, 0x77, 0x83, 0x0c, 0x5d, 0xfb, 0x3a, 0x34, 0xce, 0x04, 0x9f, 0xf0, 0xae, 0x0f,
+    0xf0, 0x62, 0x29, 0x2b, 0x94, 0x4a, 0x73, 0xd7, 0x91, 0xbc, 0xfa, 0x92, 0x67, 0xc9, 0x52, 0x9a,
+    0x9d, 0x18, 0xc4, 0x22, 0x3f, 0xc9, 0xc2, 0x1f, 0x5c, 0x72, 0x97, 0xaf, 0xdf, 0xe6, 0x76, 0xef,
+    0xf9, 0x63, 0x54, 0x64, 0x8e, 0x4a, 0xb6, 0x45, 0x08, 0xfc, 0x1e, 0x05, 0x92, 0x5f, 0xeb, 0x8a,
+    0x5c, 0x90, 0x60, 0xcd, 0xb5, 0x28, 0xd6, 0xea, 0xbc, 0x1d, 0x1d, 0x55, 0x8f, 0xee, 0x70, 0x41,
+    0x94, 0x90, 0x9e, 0x38, 0x93, 0x41, 0x6b, 0xe5, 0x06, 0x0f, 0x3f, 0x19, 0x4f, 0x89, 0xe7, 0x49,
+    0xf0, 0x2b, 0x64, 0x36, 0x55, 0xeb, 0xa1, 0x12, 0xd0, 0xe8, 0xd6, 0xcb, 0xc2, 0x48, 0x14, 0xe3,
+    0xf4, 0xa4, 0xd6, 0xe2, 0x7d, 0x61, 0x84, 0x47, 0xfb, 0xfd, 0xff, 0x57, 0x5f, 0x9a, 0x18, 0x1c,
+    0x61, 0x45, 0xfe, 0x23, 0x5b, 0x5b, 0x9a, 0x54, 0x7d, 0x36, 0x3b, 0x51, 0xb1, 0x77, 0x44, 0x61,
+    0x40, 0x34, 0xa7, 0xe0, 0xf7, 0x2c, 0xb3, 0xe8, 0x8d, 0x44, 0xe9, 0x01, 0x4d, 0x74, 0x59, 0xba,
+    0x3d, 0x8f, 0x53, 0x42, 0x21, 0x7c, 0x9e, 0xcd, 0x38, 0x04, 0xe9, 0xb9, 0x9e, 0xbf, 0x7d, 0x24,
+    0xf2, 0x62, 0xa3, 0x76, 0x1c, 0x54, 0x56, 0x03, 0x2f, 0xc8, 0x1a, 0x32, 0x92, 0xd0, 0x88, 0x68,
+    0xea, 0x4e, 0x48, 0x66, 0xe5, 0x05, 0x82, 0x7b, 0x8c, 0x74, 0xb6, 0x3e, 0xa2, 0x50, 0xa5, 0xad,
+    0x2d, 0x9d, 0x1e, 0xee, 0xe3, 0x76, 0xcb, 0x29, 0x89, 0x9a, 0xdf, 0xd2, 0x41, 0x8e, 0x4a, 0x35,
+    0xed, 0x7b, 0xc3, 0xef, 0xaf, 0x1a, 0xbb, 0x8d, 0x4a, 0xfb, 0xd1, 0x72, 0x08, 0xde, 0x29, 0xf1,
+    0x5b, 0xcd, 0x5a, 0xa1, 0x0f, 0xb3, 0x87, 0xef, 0x03, 0xbf, 0xda, 0x8d, 0x50, 0xa3, 0x33, 0x29,
+    0x9d, 0x31, 0x4c, 0xa3, 0xe5, 0xea, 0x52, 0xfc, 0xb7, 0xbc, 0x91, 0xa0, 0x1c, 0xa3, 0x65, 0x16,
+    0xdc, 0xee, 0x14, 0x5b, 0x40, 0x24, 0x92, 0xe8, 0x9d, 0xa7, 0x79, 0x91, 0x42, 0x7f, 0x52, 0xa0,
+    0x49, 0x16, 0x83, 0x3c, 0x8f, 0xd8, 0x50, 0x8c, 0xad, 0x9f, 0xff, 0xad, 0xa6, 0x53, 0x11, 0xf1,
+    0xc6, 0x22, 0x93, 0x36, 0x33, 0x74, 0x2e, 0x64, 0x66, 0x14, 0xa8, 0x48, 0x45, 0x8f, 0x55, 0xd7,
+    0xef, 0x05, 0xdb, 0xd3, 0x39, 0x10, 0x36, 0x83, 0x93, 0x48, 0x23, 0xd6, 0x52, 0x59, 0xb6, 0xf6,
+    0xe1, 0x4c, 0xb6, 0x33, 0x9b, 0x28, 0x28, 0x94, 0x7d, 0xd1, 0x41, 0x83, 0x7e, 0xd5, 0x72, 0x9b,
+    0xb2, 0xeb, 0xe7, 0x57, 0x31, 0x1d, 0x93, 0x90, 0x0b, 0x5e, 0x59, 0x18, 0xc1, 0x99, 0x59, 0x14,
+    0x20, 0x00, 0x5e, 0x17, 0x8a, 0x32, 0x6d, 0xda, 0xf3, 0x07, 0xae, 0x36, 0xed, 0xe5, 0x52, 0x07,
+    0xf9, 0xc4, 0xe3, 0x2e, 0xb3, 0x94, 0xff, 0xc6, 0x55, 0x1a, 0xba, 0x35, 0x11, 0x1a, 0x7b, 0x12,
+    0x48, 0x1c, 0x29, 0x49, 0xda, 0xe4, 0x22, 0x2a, 0x5e, 0xa4, 0x34, 0x0c, 0x36, 0xfc, 0x64, 0xef,
+    0xf5, 0xc7, 0xc7, 0xf4, 0x09, 0x1d, 0x66, 0xd5, 0x38, 0x4d, 0xc2, 0x79, 0x38, 0x2e, 0x6a, 0x90,
+    0xc8, 0xbd, 0x27, 0x50, 0x6a, 0xa1, 0x80, 0xbe, 0xd8, 0xe7, 0x74, 0x43, 0x12, 0x34, 0x89, 0x98,
+    0x8d, 0x2e, 0x23, 0xa4, 0xbd, 0xb1, 0xb9, 0x2d, 0x73, 0x9a, 0x23, 0x61, 0x8e, 0x2e, 0xa8, 0x08,
+    0x5f, 0xfc, 0xb2, 0x45, 0xf5, 0x6f, 0x56, 0xd5, 0xb6, 0xdc, 0x62, 0x16, 0x70, 0x05, 0x85, 0x49,
+    0xb0, 0xf6, 0xce, 0x13, 0xff, 0x20, 0xba, 0x68, 0xdb, 0xad, 0x02, 0xe8, 0x28, 0xc2, 0xd3, 0x92,
+    0x99, 0x42, 0xf0, 0x67, 0x2e, 0x47, 0xdb, 0xd4, 0xce, 0xd5, 0x8f, 0x93, 0xc0, 0xcc, 0x88, 0xdc,
+    0x38, 0xce, 0xf5, 0xbf, 0x0b, 0x0d, 0x44, 0xac, 0xf6, 0xca, 0x30, 0xfb, 0x4e, 0xf5, 0x54, 0xfa,
+    0x00, 0xa9, 0x4d, 0xda, 0xe4, 0x13, 0xc0, 0xf3, 0x83, 0xd5, 0xc7, 0x61, 0xaa, 0x25, 0x11, 0xf0,
+    0x75, 0x57, 0xbd, 0xa1, 0x7b, 0x26, 0xf4, 0x3d, 0x02, 0x1e, 0xbb, 0x11, 0xd6, 0x91, 0x4a, 0xcd,
+    0x4d, 0x5b, 0xb5, 0xff, 0x01, 0xb0, 0x3a, 0x76, 0xac, 0xbb, 0x21, 0x79, 0x0a, 0x13, 0xfb, 0xe3,
+    0x58, 0x22, 0x78, 0x98, 0xf9, 0xf6, 0xd3, 0x2c, 0xeb, 0x6a, 0x68, 0x97, 0x82, 0xeb, 0x3a, 0x4e,
+    0x02, 0x1f, 0xb3, 0xb2, 0xd9, 0x85, 0x76, 0xf5, 0x79, 0x9d, 0xed, 0x83, 0x77, 0xde, 0x5b, 0xa8,
+    0xb7, 0xa2, 0x0a, 0x8f, 0x98, 0xd7, 0xdb, 0xbf, 0xde, 0x75, 0xe3, 0x87, 0x80, 0x48, 0xa9, 0xf7,
+    0x7c, 0x7b, 0xff, 0xf3, 0x0a, 0x4c, 0x12, 0x59, 0x98, 0x43, 0xb4, 0xf1, 0x73, 0x9f, 0xb0, 0xd2,
+    0x5b, 0xcb, 0x32, 0xc0, 0x31, 0x51, 0xe9, 0xf5, 0x9e, 0x72, 0xcb, 0xb3, 0x05, 0x64, 0x3a, 0x5a,
+    0xd6, 0xbc, 0xbe, 0x13, 0xf5, 0x50, 0x72, 0x2d, 0x84, 0xcc, 0xa5, 0xd4, 0x2f, 0x61, 0x47, 0x92,
+    0x4a, 0x4d, 0xc2, 0x40, 0x72, 0x21, 0x5a, 0x85, 0x6c, 0x7a, 0xb1, 0xe8, 0x17, 0xd3, 0xac, 0x5e,
+    0x72, 0xcb, 0xe6, 0x2f, 0x92, 0x94, 0x55, 0xfb, 0x8c, 0x18, 0xba, 0x0e, 0xa3, 0x80, 0x99, 0x46,
+    0xcb, 0x89, 0xf9, 0x84, 0xd3, 0xb9, 0x70, 0x1f, 0x47, 0xaa, 0x80, 0x6b, 0x11, 0x58, 0x1b, 0xd0,
+    0x57, 0xc9, 0x6e, 0x2a, 0x4f, 0xf6, 0x49, 0x17, 0xff, 0xa6, 0x3a, 0x3c, 0x29, 0xd2, 0x01, 0xd6,
+    0xcf, 0x55, 0x66, 0xda, 0x03, 0x40, 0xdc, 0xda, 0xc6, 0xc5, 0x00, 0x5f, 0x2f, 0xaf, 0xda, 0x0e,
+    0x13, 0xce, 0x87, 0x54, 0xb0, 0xf6, 0x48, 0xc8, 0x3f, 0x68, 0xb1, 0xbb, 0xf9, 0xe2, 0xdf, 0x1f,
+    0xbf, 0xb0, 0x52, 0xfd, 0x0a, 0x12, 0x57, 0x60, 0x7b, 0x1b, 0x31, 0x3e, 0xd6, 0x2d, 0x14, 0x7d,
+    0x28, 0x82, 0x87, 0x5a, 0xfd, 0xa7, 0x46, 0x73, 0x9e, 0xdc, 0xc1, 0xe3, 0xb0, 0x5d, 0x06, 0x3f,
+    0xfd, 0x3f, 0x1e, 0xfc, 0xf7, 0x8a, 0x87, 0x1d, 0x93, 0xff, 0xf4, 0xf5, 0x88, 0xa1, 0x92, 0xc2,
+    0xf8, 0xc5, 0xe9, 0x88, 0x38, 0x3c, 0xe8, 0x98, 0x40, 0x62, 0x9f, 0x94, 0x8a, 0xb2, 0xdf, 0xb1,
+    0x40, 0x7b, 0x55, 0xbc, 0xbd, 0x78, 0x2d, 0xec, 0x73, 0x51, 0x17, 0x95, 0x63, 0x29, 0x40, 0xe8,
+    0xb6, 0x87, 0xff, 0xe1, 0xf9, 0xa5, 0x04, 0x21, 0xed, 0xb0, 0x71, 0x16, 0x36, 0xb1, 0xfb, 0x39,
+    0x03, 0x19, 0x3d, 0x40, 0xee, 0xb7, 0xb7, 0x1d, 0x73, 0x70, 0x67, 0xa1, 0x86, 0xbf, 0x11, 0x6f,
+    0xdd, 0x8e, 0x27, 0xce, 0x85, 0x7e, 0xf1, 0x97, 0x2a, 0x88, 0x19, 0x63, 0x00, 0xdb, 0x12, 0x25,
+    0x1e, 0x4c, 0xab, 0x0b, 0xc5, 0x1f, 0x91, 0xf0, 0xdf, 0x24, 0x45, 0xd3, 0x6d, 0x28, 0xe4, 0xad,
+    0x45, 0x01, 0xf3, 0xd7, 0x64, 0xb7, 0x2c, 0x89, 0x88, 0xe8, 0x07, 0x09, 0xaa, 0x8e, 0x33, 0xc0,
+    0x42, 0x08, 0xbe, 0x9f, 0xef, 0xd8, 0x94, 0x2d, 0xf4, 0xb9, 0xa6, 0x98, 0x4c, 0xa1, 0x87, 0x4b,
+    0x86, 0x6b, 0xaa, 0x47, 0x00, 0x22, 0xc0, 0xd4, 0xca, 0x9b, 0x30, 0x4d, 0x03, 0x4c, 0x75, 0x43,
+    0x34, 0x4b, 0x19, 0xd6, 0x86, 0x6a, 0x65, 0x52, 0x15, 0x39, 0xfe, 0x49, 0xb2, 0xe9, 0xb1, 0xf3,
+    0xf9, 0x53, 0x1a, 0xfa, 0x34, 0xb5, 0x32, 0xeb, 0x3e, 0x17, 0xd0, 0x68, 0xd6, 0xe4, 0x26, 0xcb,
+    0x8b, 0xfb, 0xa7, 0xc5, 0xa7, 0x36, 0x4a, 0xe7, 0x40, 0xeb, 0x8d, 0x8f, 0x92, 0x71, 0x88, 0x59,
+    0xa2, 0xda, 0xb4, 0xfc, 0x64, 0x5b, 0x3f, 0x08, 0x39, 0xcf, 0x9f, 0xd6, 0x02, 0xac, 0x34, 0xa6,
+    0xca, 0xd5, 0x51, 0x04, 0x7d, 0xd8, 0x8d, 0xfd, 0x42, 0xf3, 0xa8, 0xb6, 0x62, 0x73, 0x2c, 0x36,
+    0x6c, 0x1f, 0x39, 0x6d, 0x96, 0x6a, 0x49, 0xfd, 0xfb, 0x8a, 0x31, 0x98, 0xae, 0x36, 0xe2, 0xe3,
+    0x11, 0x8d, 0xbf, 0x4a, 0x82, 0xdc, 0x83, 0x7b, 0x52, 0x49, 0xaa, 0x4d, 0xc2, 0x62, 0x31, 0x60,
+    0x8c, 0xe7, 0x65, 0x19, 0x65, 0x92, 0xc5, 0x66, 0x3e, 0xa5, 0x31, 0x28, 0xb5, 0x78, 0x14, 0xcf,
+    0x58, 0x94, 0x9c, 0xf1, 0x12, 0x59, 0x68, 0xbf, 0x4f, 0x5e, 0x7d, 0x62, 0x9f, 0x59, 0x6b, 0xb7,
+    0xd5, 0xa5, 0x5e, 0xba, 0x2f, 0x30, 0x33, 0x67, 0x3c, 0xe2, 0xd8, 0x7d, 0x66, 0xcb, 0x58, 0xf7,
+    0xd5, 0x27, 0xf5, 0x78, 0xac, 0x65, 0x20, 0x23, 0x21, 0x94, 0xe4, 0xf9, 0x1d, 0x6d, 0x70, 0xc9,
+    0x36, 0x8d, 0xb8, 0x02, 0xc7, 0xf8, 0xfd, 0x1b, 0x64, 0xc0, 0x6c, 0x03, 0xe0, 0x64, 0x14, 0x54,
+    0x51, 0xbf, 0xea, 0x98, 0x65, 0x99, 0xd0, 0x80, 0xdf, 0x18, 0x91, 0xec, 0x1f, 0x84, 0x93, 0xa0,
+    0x51, 0x09, 0x94, 0x0f, 0x99, 0x25, 0x97, 0xa1, 0x17, 0x3c, 0xa0, 0x19, 0x4a, 0x71, 0x27, 0x63,
+    0xd5, 0xbc, 0xa7, 0x0e, 0xd8, 0x9b, 0xb4, 0x88, 0x5d, 0xc8, 0x12, 0x1a, 0x9a, 0xb3, 0xe5, 0xa8,
+    0xb7, 0xba, 0xde, 0x7d, 0x16, 0x1d, 0x93, 0xab, 0x25, 0xda, 0x3b, 0xb1, 0x14, 0x25, 0xca, 0xcc,
+    0x79, 0x9e, 0x34, 0xf7, 0x83, 0xd2, 0xfc, 0x5d, 0xb0, 0x37, 0xce, 0xb9, 0x3e, 0xc9, 0x4b, 0xe6,
+    0x18, 0xa5, 0x11, 0xe1, 0x88, 0x66, 0x57, 0x49, 0x91, 0x3c, 0xc7, 0x73, 0xad, 0x4a, 0xae, 0xa3,
+    0x92, 0x18, 0x86, 0x1a, 0x3f, 0x8c, 0x6a, 0x3a, 0xc4, 0xec, 0x9d, 0x41, 0x47, 0x89, 0x7b, 0x65,
+    0x6d, 0xb2, 0x73, 0x73, 0xf3, 0x40, 0x8f, 0x3e, 0x77, 0x13, 0x19, 0x89, 0x9d, 0xd7, 0x9d, 0xcf,
+    0x9b, 0xbb, 0xf6, 0x4e, 0x04, 0x31, 0x87, 0x4d, 0x3a, 0x91, 0x45, 0xf6, 0x3d, 0x87, 0x80, 0xd7,
+    0xb6, 0x3e, 0x7a, 0x37, 0x71, 0xdc, 0xa9, 0xe0, 0xc1, 0x42, 0x44, 0xef, 0x2c, 0x51, 0x49, 0x40,
+    0x0c, 0xe1, 0xb9, 0x62, 0x21, 0x7b, 0x2e, 0x7c, 0xe8, 0xaa, 0x6f, 0x21, 0x88, 0x6e, 0xf1, 0x99,
+    0x0a, 0xcf, 0x67, 0x82, 0xb0, 0x40, 0xed, 0xca, 0xb3, 0x97, 0x02, 0x26, 0x7f, 0xe3, 0xb8, 0x62,
+    0x5b, 0x8f, 0x0c, 0x77, 0x90, 0x6d, 0x01, 0x6a, 0x25, 0x41, 0x42, 0x90, 0x3f, 0xc2, 0x19, 0x20,
+    0x57, 0x5d, 0xae, 0xcb, 0x78, 0xb0, 0x06, 0x7e, 0xe9, 0xd5, 0x59, 0xe3, 0xc8, 0x91, 0xd2, 0x56,
+    0x59, 0xfb, 0xd7, 0xa5, 0x20, 0x61, 0x6f, 0x00, 0x59, 0x7e, 0x93, 0x40, 0xe7, 0x19, 0xc2, 0x20,
+    0xc0, 0x66, 0xe0, 0x41, 0xa7, 0x84, 0x4a, 0x88, 0x17, 0xbf, 0x06, 0xad, 0x29, 0xa7, 0xb7, 0xa5,
+    0xe7, 0xf0, 0xb6, 0x7e, 0xa9, 0x41, 0x54, 0xcd, 0x52, 0x49, 0x59, 0x74, 0x62, 0xe6, 0x2a, 0xcd,
+    0xcc, 0xfa, 0x90, 0x05, 0xcc, 0xcf, 0xa3, 0xcf, 0x3e, 0xff, 0xcf, 0x4d, 0x84, 0x0b, 0x07, 0x2f,
+    0x84, 0x1e, 0x8d, 0x2b, 0xe0, 0x69, 0x48, 0x70, 0x0e, 0xc6, 0x07, 0xdd, 0xd0, 0xde, 0x73, 0xfc,
+    0x4e, 0x1f, 0xf7, 0x00, 0xd3, 0x5b, 0xd3, 0x9c, 0xeb, 0x26, 0x75, 0xbf, 0x73, 0xd3, 0x7e, 0x10,
+    0x4b, 0x09, 0x89, 0x42, 0x22, 0x8c, 0x7c, 0x99, 0x4d, 0x09, 0xbe, 0xf4, 0x5c, 0x8f, 0x04, 0xaa,
+    0x73, 0x4f, 0x5c, 0x01, 0xc1, 0x91, 0x20, 0x15, 0x80, 0xd5, 0xb8, 0x66, 0x95, 0x2a, 0xe9, 0x5f,
+    0x61, 0x37, 0xe7, 0xe7, 0x1b, 0x14, 0xfb, 0x38, 0x33, 0xf7, 0xaa, 0x09, 0x99, 0xbb, 0x26, 0x98,
+    0xe3, 0xa2, 0x83, 0x6a, 0x83, 0x77, 0xff, 0xda, 0x22, 0x43, 0x98, 0x94, 0x47, 0xca, 0xbe, 0x16,
+    0x0f, 0xde, 0xe1, 0xb9, 0xd7, 0x4f, 0x7f, 0x11, 0x30, 0x6b, 0xcb, 0x2d, 0x10, 0x54, 0x16, 0x60,
+    0x3a, 0x83, 0x94, 0x7a, 0x2c, 0x9c, 0xfc, 0xee, 0x98, 0xf1, 0xcc, 0x08, 0x1b, 0x7e, 0x5c, 0xc1,
+    0x61, 0x6d, 0x52, 0xa7, 0x40, 0x52, 0xd0, 0xd0, 0x75, 0xc0, 0xb7, 0xb8, 0xeb, 0xd2, 0xe5, 0x25,
+    0x61, 0x58, 0x1a, 0xa0, 0xb8, 0x67, 0x21, 0x50, 0xd3, 0xda, 0xc0, 0xf5, 0xf4, 0xa5, 0x12, 0x20,
+    0x11, 0x53, 0x17, 0x41, 0xa9, 0xca, 0xd2, 0xac, 0x78, 0x9d, 0x19, 0xd9, 0x29, 0xb7, 0x2e, 0x7c,
+    0x35, 0x3f, 0x7b, 0xef, 0x80, 0x67, 0xbf, 0x7d, 0x0b, 0x2a, 0x42, 0x7b, 0xa3, 0x13, 0x4b, 0xc2,
+    0x64, 0x1d, 0x00, 0x6f, 0xaf, 0x61, 0xdd, 0x33, 0x75, 0x5e, 0xdf, 0x1a, 0x6a, 0xf6, 0xe4, 0x3d,
+    0x94, 0x44, 0xaf, 0xb8, 0x6b, 0x60, 0x00, 0x05, 0x23, 0x08, 0x9d, 0xdb, 0xfb, 0x5f, 0xaf, 0x0a,
+    0xd5, 0x60, 0x75, 0x9b, 0x1c, 0x7f, 0xdc, 0x82, 0x1f, 0x23, 0x88, 0xad, 0x83, 0xe0, 0x6d, 0xb4,
+    0x6c, 0xa0, 0x1d, 0x29, 0x86, 0xf4, 0x7a, 0x23, 0x4f, 0xd8, 0xfb, 0x5b, 0xa1, 0xca, 0xf6, 0x43,
+    0x81, 0x51, 0x68, 0x7a, 0x91, 0x2f, 0x23, 0xd0, 0x22, 0x53, 0xb4, 0x20, 0xe0, 0xbb, 0x12, 0xd8,
+    0x7c, 0x6c, 0x2c, 0xb8, 0xe1, 0x20, 0xb0, 0x33, 0x80, 0x61, 0xd2, 0xcf, 0xe5, 0x1b, 0xf1, 0x2d,
+    0xbe, 0x36, 0xcf, 0xca, 0x2a, 0x9e, 0xeb, 0x71, 0x55, 0xe3, 0x78, 0x0b, 0xfc, 0x59, 0x79, 0x60,
+    0xe8, 0x3b, 0x7d, 0x16, 0x92, 0x06, 0x26, 0x7e, 0x92, 0x02, 0xf6, 0xeb, 0xe6, 0x5f, 0xad, 0x9d,
+    0x17, 0x90, 0xd8, 0x97, 0xa8, 0x33, 0x83, 0x92, 0x8a, 0x6d, 0x7c, 0x9d, 0xfe, 0xe5, 0x80, 0xba,
+    0xe3, 0xd6, 0x5f, 0x00, 0x48, 0xeb, 0x65, 0x40, 0x43, 0xd0, 0xf3, 0x38, 0x2c, 0xe1, 0x81, 0x38,
+    0x54, 0xa5, 0xab, 0x5a, 0x4d, 0x64, 0xd2, 0xcb, 0xc9, 0x07, 0x6c, 0xda, 0xc7, 0xcf, 0x50, 0x96,
+    0x5e, 0x63, 0x2c, 0x1a, 0xb7, 0xf7, 0x3c, 0xb3, 0x5c, 0x41, 0xbb, 0x9f, 0xa6, 0x0e, 0x70, 0x06,
+    0xf8, 0x0a, 0x03, 0x06, 0x27, 0xc8, 0x5f, 0xf5, 0x93, 0xa0, 0xa9, 0x9d, 0x69, 0xc1, 0xc5, 0x92,
+    0xf6, 0x51, 0xd5, 0x2c, 0x30, 0x45, 0x6b, 0x26, 0xcb, 0xc5, 0x54, 0x57, 0x0d, 0x62, 0x6a, 0x4f,
+    0x84, 0xeb, 0x39, 0x8a, 0x68, 0xea, 0x7e, 0x7a, 0xfc, 0xce, 0xfa, 0x0f, 0xad, 0xf5, 0xa0, 0xc8,
+    0x92, 0x78, 0xa9, 0x44, 0x9c, 0x59, 0xc7, 0x93, 0x9c, 0x25, 0xdb, 0x72, 0x78, 0xe9, 0xe7, 0x7b,
+    0x3d, 0x34, 0x60, 0x61, 0x65, 0x08, 0x0a, 0xe7, 0xae, 0x24, 0xfc, 0x45, 0x10, 0xeb, 0x60, 0xd1,
+    0x80, 0x41, 0x32, 0xef, 0x63, 0x36, 0x69, 0x2b, 0xea, 0xcc, 0x7c, 0x1f, 0xcd, 0xfc, 0x6d, 0x3b,
+    0x8e, 0x23, 0x2a, 0x36, 0xe8, 0x15, 0xa3, 0x39, 0xa5, 0xbf, 0xc5, 0x0b, 0xf2, 0x49, 0x4e, 0x38,
+    0xd0, 0xd1, 0x21, 0x0e, 0x2b, 0xf7, 0xdd, 0x33, 0x97, 0xb5, 0x8c, 0x37, 0x88, 0x12, 0x5b, 0xab,
+    0x8b, 0x2c, 0xb0, 0x66, 0x10, 0x37, 0x49, 0x54, 0xbb, 0x83, 0xcf, 0x9b, 0x4f, 0xa4, 0xe2, 0xf9,
+    0x67, 0xd9, 0x26, 0x99, 0x16, 0x65, 0xf6, 0x20, 0x3c, 0x16, 0x21, 0x41, 0x33, 0x65, 0xae, 0x95,
+    0xd9, 0x2a, 0x2f, 0x5b, 0xd9, 0xf3, 0x54, 0x5b, 0x2c, 0xfd, 0x8e, 0x8e, 0xd5, 0xe4, 0xec, 0x27,
+    0xf7, 0x6c, 0x72, 0xee, 0xcd, 0xb5, 0xcd, 0xc3, 0xfa, 0x8f, 0x1e, 0xc3, 0x86, 0x8b, 0xa8, 0xf3,
+    0xb0, 0x8f, 0x7c, 0x97, 0x6c, 0x14, 0xf0, 0x22, 0x18, 0xcc, 0x57, 0x73, 0xb8, 0x5a, 0xe9, 0xa7,
+    0x04, 0x34, 0x54, 0x84, 0xda, 0xea, 0xab, 0xda, 0xf7, 0x59, 0x70, 0x65, 0x03, 0x58, 0x37, 0x52,
+    0x3d, 0x70, 0x5e, 0xcc, 0xaf, 0x81, 0x75, 0x9e, 0x75, 0xc9, 0x00, 0x88, 0x60, 0x1e, 0xf0, 0x22,
+    0xc1, 0xd6, 0xc0, 0x4d, 0x54, 0x82, 0x2a, 0xc1, 0x27, 0x84, 0x41, 0x32, 0x50, 0xff, 0xbc, 0x9f,
+    0x42, 0xe7, 0x5d, 0xd5, 0x17, 0x4a, 0x1c, 0x70, 0x5e, 0xe5, 0xff, 0x8b,
 };
 
 const size_t encrypted_mdl_data_size = sizeof(encrypted_mdl_data_data);
@@ -0,0 +1,348 @@
+/* Auto-generated TinyMAIX ahead-of-time model code */
+/* Generated by tinymaix_aot.py from mnist_valid_q_planned.h, do not edit */
+
+#include "tinymaix.h"
+#include "tinymaix_model_aot.h"
+
+#if TM_MDL_TYPE != TM_MDL_INT8
+#error "AOT model code is generated for INT8 models"
+#endif
+
+//layer callback, same order and arguments as tm_run()
+#define TM_AOT_CB(i, oft) do{ mdl->layer_i = (i); mdl->layer_body = (uint8_t*)bin + (oft); \
+    if(mdl->cb) ((tm_cb_t)mdl->cb)(mdl, (tml_head_t*)(mdl->layer_body)); }while(0)
+
+//conv bias+requant+act, same arithmetic as tm_postprocess_sum()
+#if TM_FASTSCALE
+TM_INLINE mtype_t tm_aot_conv_post(sumtype_t sum, int32_t sc, int32_t os, int act, zptype_t zp)
+{
+    sumtype_t sumf = (sum<<TM_FASTSCALE_SHIFT)/sc;
+    if(act == TM_ACT_RELU || act == TM_ACT_RELU6) sumf = sumf>0?sumf:0;
+    if(act == TM_ACT_RELU6) sumf = sumf>(6<<TM_FASTSCALE_SHIFT)?(6<<TM_FASTSCALE_SHIFT):sumf;
+    return (mtype_t)(((sumf*os)>>(TM_FASTSCALE_SHIFT+TM_FASTSCALE_SHIFT))+zp);
+}
+#else
+TM_INLINE mtype_t tm_aot_conv_post(sumtype_t sum, float sc, float os, int act, zptype_t zp)
+{
+    float sumf = sum*sc;
+    if(act == TM_ACT_RELU || act == TM_ACT_RELU6) sumf = sumf>0?sumf:0;
+    if(act == TM_ACT_RELU6) sumf = sumf>6?6:sumf;
+    return (mtype_t)(sumf*os + zp);
+}
+#endif
+
+static int tm_aot_argmax(const mtype_t* data, int size)
+{
+    int maxi = 0;
+    for(int i=1; i<size; i++) if(data[i] > data[maxi]) maxi = i;
+    return maxi;
+}
+
+/* L0 CONV2D */
+//CONV2D 28x28x1 -> 13x13x4, k3x3 s2x2 pad 0,0,0,0 act 1
+static void tm_aot_l0(const uint8_t* bin, const mtype_t* in, int iy0, mtype_t* out, int oy0, int oy1)
+{
+#if TM_FASTSCALE
+    static const int32_t sc[4] = {
+        (int32_t)(1.0/0x1.94eefa0000000p-7f/0x1.0101020000000p-8f),
+        (int32_t)(1.0/0x1.0f5b0a0000000p-6f/0x1.0101020000000p-8f),
+        (int32_t)(1.0/0x1.8b244c0000000p-8f/0x1.0101020000000p-8f),
+        (int32_t)(1.0/0x1.9193720000000p-7f/0x1.0101020000000p-8f),
+    };
+    const int32_t os = (int32_t)((1<<TM_FASTSCALE_SHIFT)/0x1.09d2620000000p-6f);
+#else
+    static const float sc[4] = {
+        0x1.94eefa0000000p-7f*0x1.0101020000000p-8f,
+        0x1.0f5b0a0000000p-6f*0x1.0101020000000p-8f,
+        0x1.8b244c0000000p-8f*0x1.0101020000000p-8f,
+        0x1.9193720000000p-7f*0x1.0101020000000p-8f,
+    };
+    const float os = 1.f/0x1.09d2620000000p-6f;
+#endif
+    const wtype_t* w = (const wtype_t*)(bin + 160);
+    const btype_t* b = (const btype_t*)(bin + 200);
+    for(int y=oy0; y<oy1; y++){
+        for(int x=0; x<13; x++){
+            for(int c=0; c<4; c++){
+                sumtype_t sum = 0;
+                for(int ky=0; ky<3; ky++){
+                    int iy = y*2-0+ky;
+                    for(int kx=0; kx<3; kx++){
+                        int ix = x*2-0+kx;
+                        for(int i=0; i<1; i++){
+                            sum += in[((iy-iy0)*28+ix)*1+i]*w[(c*1+i)*9+ky*3+kx];
+                        }
+                    }
+                }
+                *out++ = tm_aot_conv_post(sum + b[c], sc[c], os, 1, -128);
+            }
+        }
+    }
+}
+
+/* L1 CONV2D */
+//CONV2D 13x13x4 -> 6x6x8, k3x3 s2x2 pad 0,0,0,0 act 1
+static void tm_aot_l1(const uint8_t* bin, const mtype_t* in, int iy0, mtype_t* out, int oy0, int oy1)
+{
+#if TM_FASTSCALE
+    static const int32_t sc[8] = {
+        (int32_t)(1.0/0x1.15c16c0000000p-8f/0x1.09d2620000000p-6f),
+        (int32_t)(1.0/0x1.6d51c00000000p-9f/0x1.09d2620000000p-6f),
+        (int32_t)(1.0/0x1.927aa00000000p-8f/0x1.09d2620000000p-6f),
+        (int32_t)(1.0/0x1.229e7c0000000p-8f/0x1.09d2620000000p-6f),
+        (int32_t)(1.0/0x1.af3d100000000p-9f/0x1.09d2620000000p-6f),
+        (int32_t)(1.0/0x1.d950440000000p-9f/0x1.09d2620000000p-6f),
+        (int32_t)(1.0/0x1.3e4a3e0000000p-8f/0x1.09d2620000000p-6f),
+        (int32_t)(1.0/0x1.e281e40000000p-9f/0x1.09d2620000000p-6f),
+    };
+    const int32_t os = (int32_t)((1<<TM_FASTSCALE_SHIFT)/0x1.0855400000000p-6f);
+#else
+    static const float sc[8] = {
+        0x1.15c16c0000000p-8f*0x1.09d2620000000p-6f,
+        0x1.6d51c00000000p-9f*0x1.09d2620000000p-6f,
+        0x1.927aa00000000p-8f*0x1.09d2620000000p-6f,
+        0x1.229e7c0000000p-8f*0x1.09d2620000000p-6f,
+        0x1.af3d100000000p-9f*0x1.09d2620000000p-6f,
+        0x1.d950440000000p-9f*0x1.09d2620000000p-6f,
+        0x1.3e4a3e0000000p-8f*0x1.09d2620000000p-6f,
+        0x1.e281e40000000p-9f*0x1.09d2620000000p-6f,
+    };
+    const float os = 1.f/0x1.0855400000000p-6f;
+#endif
+    const wtype_t* w = (const wtype_t*)(bin + 328);
+    const btype_t* b = (const btype_t*)(bin + 616);
+    for(int y=oy0; y<oy1; y++){
+        for(int x=0; x<6; x++){
+            for(int c=0; c<8; c++){
+                sumtype_t sum = 0;
+                for(int ky=0; ky<3; ky++){
+                    int iy = y*2-0+ky;
+                    for(int kx=0; kx<3; kx++){
+                        int ix = x*2-0+kx;
+                        for(int i=0; i<4; i++){
+                            sum += in[((iy-iy0)*13+ix)*4+i]*w[(c*4+i)*9+ky*3+kx];
+                        }
+                    }
+                }
+                *out++ = tm_aot_conv_post(sum + b[c], sc[c], os, 1, -128);
+            }
+        }
+    }
+}
+
+/* L2 CONV2D */
+//CONV2D 6x6x8 -> 2x2x16, k3x3 s2x2 pad 0,0,0,0 act 1
+static void tm_aot_l2(const uint8_t* bin, const mtype_t* in, int iy0, mtype_t* out, int oy0, int oy1)
+{
+#if TM_FASTSCALE
+    static const int32_t sc[16] = {
+        (int32_t)(1.0/0x1.5b27c60000000p-6f/0x1.0855400000000p-6f),
+        (int32_t)(1.0/0x1.d12cc20000000p-7f/0x1.0855400000000p-6f),
+        (int32_t)(1.0/0x1.2db2e20000000p-6f/0x1.0855400000000p-6f),
+        (int32_t)(1.0/0x1.9f43940000000p-7f/0x1.0855400000000p-6f),
+        (int32_t)(1.0/0x1.db36f60000000p-7f/0x1.0855400000000p-6f),
+        (int32_t)(1.0/0x1.49286a0000000p-6f/0x1.0855400000000p-6f),
+        (int32_t)(1.0/0x1.43e9820000000p-6f/0x1.0855400000000p-6f),
+        (int32_t)(1.0/0x1.07cc6c0000000p-6f/0x1.0855400000000p-6f),
+        (int32_t)(1.0/0x1.8ba9260000000p-7f/0x1.0855400000000p-6f),
+        (int32_t)(1.0/0x1.bf042c0000000p-7f/0x1.0855400000000p-6f),
+        (int32_t)(1.0/0x1.adf0720000000p-7f/0x1.0855400000000p-6f),
+        (int32_t)(1.0/0x1.55e1160000000p-6f/0x1.0855400000000p-6f),
+        (int32_t)(1.0/0x1.cc72d00000000p-7f/0x1.0855400000000p-6f),
+        (int32_t)(1.0/0x1.463cb00000000p-6f/0x1.0855400000000p-6f),
+        (int32_t)(1.0/0x1.0c37b00000000p-6f/0x1.0855400000000p-6f),
+        (int32_t)(1.0/0x1.355a700000000p-6f/0x1.0855400000000p-6f),
+    };
+    const int32_t os = (int32_t)((1<<TM_FASTSCALE_SHIFT)/0x1.d0120a0000000p-5f);
+#else
+    static const float sc[16] = {
+        0x1.5b27c60000000p-6f*0x1.0855400000000p-6f,
+        0x1.d12cc20000000p-7f*0x1.0855400000000p-6f,
+        0x1.2db2e20000000p-6f*0x1.0855400000000p-6f,
+        0x1.9f43940000000p-7f*0x1.0855400000000p-6f,
+        0x1.db36f60000000p-7f*0x1.0855400000000p-6f,
+        0x1.49286a0000000p-6f*0x1.0855400000000p-6f,
+        0x1.43e9820000000p-6f*0x1.0855400000000p-6f,
+        0x1.07cc6c0000000p-6f*0x1.0855400000000p-6f,
+        0x1.8ba9260000000p-7f*0x1.0855400000000p-6f,
+        0x1.bf042c0000000p-7f*0x1.0855400000000p-6f,
+        0x1.adf0720000000p-7f*0x1.0855400000000p-6f,
+        0x1.55e1160000000p-6f*0x1.0855400000000p-6f,
+        0x1.cc72d00000000p-7f*0x1.0855400000000p-6f,
+        0x1.463cb00000000p-6f*0x1.0855400000000p-6f,
+        0x1.0c37b00000000p-6f*0x1.0855400000000p-6f,
+        0x1.355a700000000p-6f*0x1.0855400000000p-6f,
+    };
+    const float os = 1.f/0x1.d0120a0000000p-5f;
+#endif
+    const wtype_t* w = (const wtype_t*)(bin + 792);
+    const btype_t* b = (const btype_t*)(bin + 1944);
+    for(int y=oy0; y<oy1; y++){
+        for(int x=0; x<2; x++){
+            for(int c=0; c<16; c++){
+                sumtype_t sum = 0;
+                for(int ky=0; ky<3; ky++){
+                    int iy = y*2-0+ky;
+                    for(int kx=0; kx<3; kx++){
+                        int ix = x*2-0+kx;
+                        for(int i=0; i<8; i++){
+                            sum += in[((iy-iy0)*6+ix)*8+i]*w[(c*8+i)*9+ky*3+kx];
+                        }
+                    }
+                }
+                *out++ = tm_aot_conv_post(sum + b[c], sc[c], os, 1, -128);
+            }
+        }
+    }
+}
+
+//CONV2D + GAP fused, 2 rows of 2x16
+static void tm_aot_l2_gap(const uint8_t* bin, const mtype_t* in, mtype_t* row, mtype_t* out)
+{
+    sumtype_t sum[16] = {0};
+    for(int y=0; y<2; y++){
+        tm_aot_l2(bin, in, 0, row, y, y+1);
+        for(int i=0; i<2; i++)
+            for(int c=0; c<16; c++) sum[c] += row[i*16+c];
+    }
+    for(int c=0; c<16; c++)
+        out[c] = (mtype_t)((sum[c]/4-(-128))*0x1.d0120a0000000p-5f/0x1.6e34420000000p-6f + (-128));
+}
+
+/* L3 GAP */
+//fused into the previous conv
+
+/* L4 FC */
+//FC 16 -> 10, same arithmetic as tml_fc()
+static void tm_aot_l4(const uint8_t* bin, const mtype_t* in, mtype_t* out)
+{
+    const wtype_t* w = (const wtype_t*)(bin + 2160);
+    const btype_t* b = (const btype_t*)(bin + 2320);
+    int packed = ((const tml_fc_t*)(bin + 2056))->w_pack == TML_FC_PACK4;   //tm_load may pack
+    for(int c=0; c<10; c++){
+        sumtype_t sum = 0;
+        if(packed && c < 8) {
+            const wtype_t* k = w + (c/4)*64 + c%4;
+            for(int i=0; i<16; i++) sum += in[i]*k[i*4];
+        } else {
+            for(int i=0; i<16; i++) sum += in[i]*w[c*16+i];
+        }
+        sum += b[c];
+        out[c] = (mtype_t)(sum*0x1.6e34420000000p-6f*0x1.5fc5d20000000p-6f/0x1.360dfa0000000p-3f + (42));
+    }
+}
+
+/* L5 SOFTMAX */
+//library kernel, called from the run functions
+
+//patch based stack: layers 0..1, 1 output rows per band
+//per band and layer: in_row0, out_row0, out_row1
+static const uint16_t tm_aot_bands[6][2][3] = {
+    {{0, 0, 3}, {0, 0, 1}},
+    {{4, 2, 5}, {2, 1, 2}},
+    {{8, 4, 7}, {4, 2, 3}},
+    {{12, 6, 9}, {6, 3, 4}},
+    {{16, 8, 11}, {8, 4, 5}},
+    {{20, 10, 13}, {10, 5, 6}},
+};
+
+static void tm_aot_patch(const uint8_t* bin, uint8_t* buf, const mtype_t* in)
+{
+    for(int r=0; r<6; r++){
+        const uint16_t (*t)[3] = tm_aot_bands[r];
+        tm_aot_l0(bin, in + t[0][0]*28, t[0][0], (mtype_t*)(buf + 1072), t[0][1], t[0][2]);
+        tm_aot_l1(bin, (const mtype_t*)(buf + 1072), t[1][0], (mtype_t*)(buf + 784) + t[1][1]*48, t[1][1], t[1][2]);
+    }
+}
+
+//fingerprinted bytes: layer, start from the layer start, length
+//layer head and parameters, weight scales baked in above
+static const uint32_t tm_aot_fp_spans[14][3] = {
+    {0, 0, 48},
+    {0, 48, 32},
+    {0, 80, 16},
+    {1, 0, 48},
+    {1, 48, 32},
+    {1, 80, 32},
+    {2, 0, 48},
+    {2, 48, 32},
+    {2, 80, 64},
+    {3, 0, 48},
+    {4, 0, 48},
+    {4, 48, 12},
+    {4, 64, 4},
+    {5, 0, 48},
+};
+
+tm_err_t tm_aot_check(tm_mdl_t* mdl)
+{
+    const uint8_t* bin = (const uint8_t*)mdl->b;
+    uint32_t h = 0x811C9DC5u;
+    int s = 0;
+    if(mdl->b->layer_cnt != 6) return TM_ERR_MDLTYPE;
+    for(int i=0; i<46; i++) h = (h ^ bin[i])*0x01000193u;
+    bin = mdl->b->layers_body;
+    for(int l=0; l<6; l++){
+        uint32_t size = ((const tml_head_t*)bin)->size;
+        for(; s<14 && tm_aot_fp_spans[s][0]==(uint32_t)l; s++){
+            const uint32_t* sp = tm_aot_fp_spans[s];
+            if(sp[1] + sp[2] > size) return TM_ERR_MDLTYPE;
+            for(uint32_t i=0; i<sp[2]; i++) h = (h ^ bin[sp[1]+i])*0x01000193u;
+        }
+        bin += size;
+    }
+    return h == 0x67224E43u ? TM_OK : TM_ERR_MDLTYPE;
+}
+
+tm_err_t tm_aot_run(tm_mdl_t* mdl, tm_mat_t* in, tm_mat_t* out)
+{
+    const uint8_t* bin = (const uint8_t*)mdl->b;
+    uint8_t* buf = mdl->buf;
+    tm_err_t res = TM_OK;
+    (void)res;
+    mtype_t fz[2][16];    //fused intermediates
+    tm_aot_patch(bin, buf, in->data);
+    TM_AOT_CB(0, 64);
+    TM_AOT_CB(1, 216);
+    tm_aot_l2_gap(bin, (mtype_t*)(buf + 784), (mtype_t*)(buf + 0), fz[1]);   //fused with L3
+    TM_AOT_CB(2, 648);
+    //L3 done in L2
+    TM_AOT_CB(3, 2008);
+    tm_aot_l4(bin, fz[1], fz[0]);
+    TM_AOT_CB(4, 2056);
+    {
+        tm_mat_t _in = {1, 1, 1, 10, {fz[0]}};
+        tm_mat_t _out = {1, 1, 1, 10, {(mtype_t*)(buf + 0)}};
+        res = tml_softmax(&_in, &_out, 0x1.360dfa0000000p-3f, 42, 0x1.0000000000000p-8f, -128);
+        if(res != TM_OK) return res;
+    }
+    TM_AOT_CB(5, 2360);
+    {
+        mtype_t* o = (mtype_t*)(buf + 0);
+        out[0].dims = 1; out[0].h = 1; out[0].w = 1; out[0].c = 10;
+        float* f = (float*)(TM_ALIGN(o + 10));
+        for(int i=0; i<10; i++) f[i] = ((sumtype_t)o[i]-(-128))*0x1.0000000000000p-8f;
+        out[0].dataf = f;
+    }
+    return TM_OK;
+}
+
+tm_err_t tm_aot_run_argmax(tm_mdl_t* mdl, tm_mat_t* in, int* cls)
+{
+    const uint8_t* bin = (const uint8_t*)mdl->b;
+    uint8_t* buf = mdl->buf;
+    tm_err_t res = TM_OK;
+    (void)res;
+    mtype_t fz[2][16];    //fused intermediates
+    tm_aot_patch(bin, buf, in->data);
+    TM_AOT_CB(0, 64);
+    TM_AOT_CB(1, 216);
+    tm_aot_l2_gap(bin, (mtype_t*)(buf + 784), (mtype_t*)(buf + 0), fz[1]);   //fused with L3
+    TM_AOT_CB(2, 648);
+    //L3 done in L2
+    TM_AOT_CB(3, 2008);
+    tm_aot_l4(bin, fz[1], fz[0]);
+    TM_AOT_CB(4, 2056);
+    *cls = tm_aot_argmax(fz[0], 10);   //softmax is monotonic
+    return TM_OK;
+}
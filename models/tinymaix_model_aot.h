@@ -0,0 +1,17 @@
+/* Auto-generated TinyMAIX ahead-of-time model code */
+/* Generated by tinymaix_aot.py from mnist_valid_q_planned.h, do not edit */
+
+#ifndef __TINYMAIX_MODEL_AOT_H__
+#define __TINYMAIX_MODEL_AOT_H__
+
+#include "tinymaix.h"
+
+/* Model must be loaded with tm_load() first, tm_aot_check() once after load */
+tm_err_t tm_aot_check(tm_mdl_t* mdl);                               /* TM_ERR_MDLTYPE: other model */
+tm_err_t tm_aot_run(tm_mdl_t* mdl, tm_mat_t* in, tm_mat_t* out);    /* same as tm_run() */
+tm_err_t tm_aot_run_argmax(tm_mdl_t* mdl, tm_mat_t* in, int* cls);  /* same as tm_run_argmax() */
+
+#define TM_AOT_BUF_SIZE (1232)
+#define TM_AOT_LAYER_CNT (6)
+
+#endif /* __TINYMAIX_MODEL_AOT_H__ */
@@ -0,0 +1,16 @@
+/* Auto-generated TinyMAIX activation memory plan */
+/* Generated by tinymaix_mem_planner.py from mnist_valid_q.h */
+
+#ifndef __TINYMAIX_MODEL_MEM_H__
+#define __TINYMAIX_MODEL_MEM_H__
+
+/* Exact main buffer (activation arena) size for tm_load() */
+#define TINYMAIX_MDL_BUF_LEN (1232)
+/* Sub buffer size, tm_load() allocates it when non zero */
+#define TINYMAIX_MDL_SUB_LEN (0)
+/* Peak live activation bytes, lower bound for TINYMAIX_MDL_BUF_LEN */
+#define TINYMAIX_MDL_PEAK_LIVE (1232)
+/* Stream frame staging for tm_run_delta(), non zero for a delta planned model */
+#define TINYMAIX_MDL_FRAME_LEN (0)
+
+#endif /* __TINYMAIX_MODEL_MEM_H__ */
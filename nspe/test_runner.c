@@ -27,8 +27,10 @@ void run_all_tests(void* arg)
     LOG_MSG("Starting TF-M Test Suite (Production Mode)...\r\n");
     
     /* Production Mode: Run all tests except DEV_MODE specific ones */
-    /* Test 1: Echo Service */
+    /* Test 1: Echo Service (IPC model, not built with the SFN backend) */
+#ifndef TINYMAIX_SFN
     test_echo_service();
+#endif
     
     /* Test 2: PSA Encryption */
     test_psa_encryption();
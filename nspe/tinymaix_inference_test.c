@@ -5,6 +5,9 @@
 
 #include "tfm_tinymaix_inference_defs.h"
 #include "psa/client.h"
+#include "os_wrapper/tick.h"
+#include "os_wrapper/thread.h"
+#include "os_wrapper/semaphore.h"
 #include "../models/encrypted_mnist_model_psa.h"
 
 /* Labels for MNIST classification (10 classes) */
@@ -82,6 +85,754 @@ void test_tinymaix_basic_functionality(void)
     printf("[TinyMaix Test] ✓ Basic functionality test passed!\n\n");
 }
 
+/* Argmax-only run must predict the same class as the full softmax run */
+void test_tinymaix_argmax_fast_path(void)
+{
+    printf("[TinyMaix Test] ===========================================\n");
+    printf("[TinyMaix Test] Testing Argmax-only Fast Path\n");
+    printf("[TinyMaix Test] ===========================================\n");
+
+    tfm_tinymaix_status_t status;
+    int full_class = -1;
+    int argmax_class = -1;
+    tfm_tinymaix_run_params_t params = {
+        .flags = TINYMAIX_RUN_FLAG_ARGMAX_ONLY
+    };
+
+    printf("[TinyMaix Test] 1. Running full inference (softmax + dequant)...\n");
+    status = tfm_tinymaix_run_inference_ex(NULL, 0, NULL, &full_class);
+    if (status != TINYMAIX_STATUS_SUCCESS) {
+        printf("[TinyMaix Test] ✗ Full inference failed: %d\n", status);
+        return;
+    }
+
+    printf("[TinyMaix Test] 2. Running argmax-only inference...\n");
+    status = tfm_tinymaix_run_inference_ex(NULL, 0, &params, &argmax_class);
+    if (status != TINYMAIX_STATUS_SUCCESS) {
+        printf("[TinyMaix Test] ✗ Argmax-only inference failed: %d\n", status);
+        return;
+    }
+
+    if (full_class != argmax_class) {
+        printf("[TinyMaix Test] ✗ Class mismatch: full=%d, argmax=%d\n", full_class, argmax_class);
+        return;
+    }
+
+    printf("[TinyMaix Test] ✓ Argmax-only class matches full run: %d\n", argmax_class);
+    printf("[TinyMaix Test] ✓ Argmax fast path test passed!\n\n");
+}
+
+/* Cascade: the gate decides alone above the threshold, the main model below it.
+ * The builtin model doubles as gate, so both stages must agree on the class. */
+void test_tinymaix_cascade(void)
+{
+    printf("[TinyMaix Test] ===========================================\n");
+    printf("[TinyMaix Test] Testing Gate + Main Model Cascade\n");
+    printf("[TinyMaix Test] ===========================================\n");
+
+    tfm_tinymaix_status_t status;
+    tfm_tinymaix_run_info_t info;
+    int gate_class = -1;
+    int main_class = -1;
+
+    printf("[TinyMaix Test] 1. Loading builtin model into the gate slot...\n");
+    status = tfm_tinymaix_load_encrypted_model_slot(TINYMAIX_SLOT_GATE, NULL, 0);
+    if (status != TINYMAIX_STATUS_SUCCESS) {
+        /* Default arena only fits the main model (TFM_TINYMAIX_ARENA_SIZE) */
+        printf("[TinyMaix Test] - Gate load failed: %d (arena too small?), skipped\n\n", status);
+        return;
+    }
+
+    printf("[TinyMaix Test] 2. Threshold 0: gate must decide...\n");
+    status = tfm_tinymaix_run_cascade(NULL, 0, 0.0f, 0, &gate_class, &info);
+    if (status != TINYMAIX_STATUS_SUCCESS || info.stage != TINYMAIX_STAGE_GATE) {
+        printf("[TinyMaix Test] ✗ Gate stage run failed: %d (stage %d)\n", status, (int)info.stage);
+        return;
+    }
+
+    printf("[TinyMaix Test] 3. Threshold above 1: main model must decide...\n");
+    status = tfm_tinymaix_run_cascade(NULL, 0, 1.5f, TINYMAIX_RUN_FLAG_ARGMAX_ONLY, &main_class, &info);
+    if (status != TINYMAIX_STATUS_SUCCESS || info.stage != TINYMAIX_STAGE_MAIN) {
+        printf("[TinyMaix Test] ✗ Main stage run failed: %d (stage %d)\n", status, (int)info.stage);
+        return;
+    }
+
+    if (gate_class != main_class) {
+        printf("[TinyMaix Test] ✗ Class mismatch: gate=%d, main=%d\n", gate_class, main_class);
+        return;
+    }
+
+    printf("[TinyMaix Test] ✓ Gate confidence %d/1000, both stages predict %d\n",
+           (int)(info.gate_confidence * 1000), main_class);
+    printf("[TinyMaix Test] ✓ Cascade test passed!\n\n");
+}
+
+/* Model hot-swap: replacing the main model with a package keeps the class,
+ * and a package that fails to load must not take the service down with
+ * A/B slots (TFM_TINYMAIX_AB_SLOTS). Single-buffered slots lose the main
+ * model on a failed load, the builtin one is reloaded then. */
+#define TINYMAIX_SWAP_PACKAGE_MAX   4096    /* TFM_TINYMAIX_MAX_MODEL_SIZE of the service */
+
+void test_tinymaix_hot_swap(void)
+{
+    static uint8_t bad_package[TINYMAIX_SWAP_PACKAGE_MAX];
+    tfm_tinymaix_status_t status;
+    int before = -1;
+    int after = -1;
+
+    printf("[TinyMaix Test] ===========================================\n");
+    printf("[TinyMaix Test] Testing Model Hot-Swap\n");
+    printf("[TinyMaix Test] ===========================================\n");
+
+    status = tfm_tinymaix_run_inference(&before);
+    if (status != TINYMAIX_STATUS_SUCCESS) {
+        printf("[TinyMaix Test] ✗ Inference before swap failed: %d\n", status);
+        return;
+    }
+
+    printf("[TinyMaix Test] 1. Replacing the main model with a client package...\n");
+    status = tfm_tinymaix_load_encrypted_model_slot(TINYMAIX_SLOT_MAIN, encrypted_mdl_data_data,
+                                                    encrypted_mdl_data_size);
+    if (status != TINYMAIX_STATUS_SUCCESS) {
+        printf("[TinyMaix Test] ✗ Package load failed: %d\n", status);
+        return;
+    }
+    status = tfm_tinymaix_run_inference(&after);
+    if (status != TINYMAIX_STATUS_SUCCESS || after != before) {
+        printf("[TinyMaix Test] ✗ Swapped model run: %d, class %d (was %d)\n", status, after, before);
+        return;
+    }
+
+    printf("[TinyMaix Test] 2. Loading a corrupted package...\n");
+    if (encrypted_mdl_data_size > sizeof(bad_package)) {
+        printf("[TinyMaix Test] - Package larger than the test buffer, skipped\n\n");
+        return;
+    }
+    memcpy(bad_package, encrypted_mdl_data_data, encrypted_mdl_data_size);
+    bad_package[0] ^= 0xFF;     /* header magic */
+    status = tfm_tinymaix_load_encrypted_model_slot(TINYMAIX_SLOT_MAIN, bad_package, encrypted_mdl_data_size);
+    if (status == TINYMAIX_STATUS_SUCCESS) {
+        printf("[TinyMaix Test] ✗ Corrupted package accepted\n");
+        return;
+    }
+    status = tfm_tinymaix_run_inference(&after);
+#ifdef TINYMAIX_AB_SLOTS
+    if (status != TINYMAIX_STATUS_SUCCESS || after != before) {
+        printf("[TinyMaix Test] ✗ Active model lost after a failed load: %d\n", status);
+        return;
+    }
+    printf("[TinyMaix Test] ✓ Active model kept serving through the failed load\n");
+#else
+    printf("[TinyMaix Test] - Single-buffered slots: run after the failed load returned %d, reloading\n", status);
+    status = tfm_tinymaix_load_encrypted_model();
+    if (status != TINYMAIX_STATUS_SUCCESS) {
+        printf("[TinyMaix Test] ✗ Reload failed: %d\n", status);
+        return;
+    }
+#endif
+    printf("[TinyMaix Test] ✓ Hot-swap test passed!\n\n");
+}
+
+/* Request queue: with the dispatcher held, one run of each priority class
+ * arrives, least urgent first. Released, they must be served most urgent
+ * first (queue_ahead 0, 1, 2). Then NS threads of the three classes submit
+ * runs at the same time: each must get the right class, and the queue
+ * counters must account for every run. Lines are parsed like the latency
+ * lines. */
+#define TINYMAIX_QUEUE_RUNS         8
+#define TINYMAIX_QUEUE_STACK        2048
+
+typedef struct {
+    const char* name;            /* NS thread, NSID in tfm_nsid_map_table.c */
+    uint32_t priority;           /* TINYMAIX_PRIO_* */
+    void* done;
+    int runs;
+    int expected;
+    int failures;
+    uint32_t ahead;              /* queue_ahead of its last run */
+    uint32_t depth_max;
+    uint32_t batch_max;
+} tinymaix_queue_client_t;
+
+static void tinymaix_queue_client(void* arg)
+{
+    tinymaix_queue_client_t* client = (tinymaix_queue_client_t*)arg;
+    tfm_tinymaix_run_info_t info;
+    tfm_tinymaix_status_t status;
+    int predicted_class = -1;
+
+    for (int i = 0; i < client->runs; i++) {
+        status = tfm_tinymaix_run_priority(NULL, 0, client->priority, TINYMAIX_RUN_FLAG_ARGMAX_ONLY,
+                                           &predicted_class, &info);
+        if (status != TINYMAIX_STATUS_SUCCESS || predicted_class != client->expected) {
+            client->failures++;
+            continue;
+        }
+        if (info.queue_depth > client->depth_max) {
+            client->depth_max = info.queue_depth;
+        }
+        if (info.queue_batch > client->batch_max) {
+            client->batch_max = info.queue_batch;
+        }
+        client->ahead = info.queue_ahead;
+    }
+    os_wrapper_semaphore_release(client->done);
+    os_wrapper_thread_exit();
+}
+
+/* Start a client thread for each class in the given order, runs each */
+static void tinymaix_queue_start(tinymaix_queue_client_t* const order[], int runs,
+                                 uint32_t thread_prio, void* done)
+{
+    for (uint32_t i = 0; i < TINYMAIX_PRIO_CNT; i++) {
+        tinymaix_queue_client_t* client = order[i];
+
+        client->runs = runs;
+        client->failures = 0;
+        if (os_wrapper_thread_new(client->name, TINYMAIX_QUEUE_STACK, tinymaix_queue_client,
+                                  client, thread_prio) == NULL) {
+            printf("[TinyMaix Test] ✗ Thread %s create failed\n", client->name);
+            client->failures = runs;
+            os_wrapper_semaphore_release(done);
+        }
+    }
+}
+
+void test_tinymaix_queue(void)
+{
+    static const char* prio_names[TINYMAIX_PRIO_CNT] = { "normal", "alarm", "telemetry" };
+    static tinymaix_queue_client_t clients[TINYMAIX_PRIO_CNT] = {
+        { .name = "Thread_A", .priority = TINYMAIX_PRIO_ALARM },
+        { .name = "Thread_B", .priority = TINYMAIX_PRIO_NORMAL },
+        { .name = "Thread_C", .priority = TINYMAIX_PRIO_TELEMETRY },
+    };
+    /* Least urgent first, so the dispatcher has to reorder them */
+    static tinymaix_queue_client_t* const arrival[TINYMAIX_PRIO_CNT] = {
+        &clients[2], &clients[1], &clients[0]
+    };
+    static tinymaix_queue_client_t* const start[TINYMAIX_PRIO_CNT] = {
+        &clients[0], &clients[1], &clients[2]
+    };
+    tfm_tinymaix_queue_stats_t before, after;
+    tfm_tinymaix_status_t status;
+    uint32_t thread_prio = 0;
+    uint32_t ordered_runs = 0;
+    int expected = -1;
+    void* done;
+
+    printf("[TinyMaix Test] ===========================================\n");
+    printf("[TinyMaix Test] Testing Request Queue Priority Classes\n");
+    printf("[TinyMaix Test] ===========================================\n");
+
+    status = tfm_tinymaix_run_inference(&expected);
+    if (status != TINYMAIX_STATUS_SUCCESS) {
+        printf("[TinyMaix Test] ✗ Reference inference failed: %d\n", status);
+        return;
+    }
+    status = tfm_tinymaix_get_queue_stats(&before);
+    if (status == TINYMAIX_STATUS_ERROR_NOT_SUPPORTED) {
+        printf("[TinyMaix Test] - Request queue not enabled, skipped\n\n");
+        return;
+    }
+    if (status != TINYMAIX_STATUS_SUCCESS) {
+        printf("[TinyMaix Test] ✗ Get queue stats failed: %d\n", status);
+        return;
+    }
+
+    done = os_wrapper_semaphore_create(TINYMAIX_PRIO_CNT, 0, "tinymaix_queue");
+    if (done == NULL) {
+        printf("[TinyMaix Test] ✗ Semaphore create failed\n");
+        return;
+    }
+    os_wrapper_thread_get_priority(os_wrapper_thread_get_handle(), &thread_prio);
+    for (uint32_t i = 0; i < TINYMAIX_PRIO_CNT; i++) {
+        clients[i].done = done;
+        clients[i].expected = expected;
+    }
+
+    /* Ordering: the clients run above this thread, so each one is waiting
+     * in the held dispatcher before the next one is created */
+    status = tfm_tinymaix_queue_init();
+    if (status == TINYMAIX_STATUS_SUCCESS) {
+        tfm_tinymaix_queue_hold(1);
+        tinymaix_queue_start(arrival, 1, thread_prio + 1, done);
+        tfm_tinymaix_queue_hold(0);
+        for (uint32_t i = 0; i < TINYMAIX_PRIO_CNT; i++) {
+            os_wrapper_semaphore_acquire(done, OS_WRAPPER_WAIT_FOREVER);
+        }
+        for (uint32_t i = 0; i < TINYMAIX_PRIO_CNT; i++) {
+            printf("[TinyMaix Queue] order %s ahead %lu\n", prio_names[clients[i].priority],
+                   (unsigned long)clients[i].ahead);
+            if (clients[i].failures) {
+                printf("[TinyMaix Test] ✗ %s: ordered run failed or misclassified\n", clients[i].name);
+                os_wrapper_semaphore_delete(done);
+                return;
+            }
+            if (clients[i].ahead != i) {
+                printf("[TinyMaix Test] ✗ %s: %lu runs served ahead of it, expected %lu\n",
+                       clients[i].name, (unsigned long)clients[i].ahead, (unsigned long)i);
+                os_wrapper_semaphore_delete(done);
+                return;
+            }
+        }
+        ordered_runs = 1;
+    } else if (status == TINYMAIX_STATUS_ERROR_NOT_SUPPORTED) {
+        printf("[TinyMaix Test] - No NS dispatcher (NS mailbox), ordering left to the service\n");
+    } else {
+        printf("[TinyMaix Test] ✗ Dispatcher init failed: %d\n", status);
+        os_wrapper_semaphore_delete(done);
+        return;
+    }
+
+    tinymaix_queue_start(start, TINYMAIX_QUEUE_RUNS, thread_prio, done);
+    for (uint32_t i = 0; i < TINYMAIX_PRIO_CNT; i++) {
+        os_wrapper_semaphore_acquire(done, OS_WRAPPER_WAIT_FOREVER);
+    }
+    os_wrapper_semaphore_delete(done);
+
+    status = tfm_tinymaix_get_queue_stats(&after);
+    if (status != TINYMAIX_STATUS_SUCCESS) {
+        printf("[TinyMaix Test] ✗ Get queue stats failed: %d\n", status);
+        return;
+    }
+    printf("[TinyMaix Queue] capacity %lu depth_max %lu batches %lu batch_max %lu full %lu tick_hz %lu\n",
+           (unsigned long)after.capacity, (unsigned long)after.depth_max, (unsigned long)after.batches,
+           (unsigned long)after.batch_max, (unsigned long)after.full, (unsigned long)after.tick_hz);
+    for (uint32_t i = 0; i < TINYMAIX_PRIO_CNT; i++) {
+        tinymaix_queue_client_t* client = &clients[i];
+        tfm_tinymaix_queue_prio_t* cls = &after.prio[client->priority];
+        uint32_t served = cls->served - before.prio[client->priority].served;
+
+        printf("[TinyMaix Queue] class %s served %lu ahead_max %lu wait_max %lu depth %lu batch %lu\n",
+               prio_names[client->priority], (unsigned long)served, (unsigned long)cls->ahead_max,
+               (unsigned long)cls->wait_max, (unsigned long)client->depth_max,
+               (unsigned long)client->batch_max);
+        if (client->failures) {
+            printf("[TinyMaix Test] ✗ %s: %d of %d runs failed or misclassified\n", client->name,
+                   client->failures, TINYMAIX_QUEUE_RUNS);
+            return;
+        }
+        if (served != TINYMAIX_QUEUE_RUNS + ordered_runs) {
+            printf("[TinyMaix Test] ✗ %s: queue served %lu runs, expected %lu\n", client->name,
+                   (unsigned long)served, (unsigned long)(TINYMAIX_QUEUE_RUNS + ordered_runs));
+            return;
+        }
+    }
+    printf("[TinyMaix Test] ✓ Request queue test passed!\n\n");
+}
+
+/* Time budget: a run with a one tick budget yields after (nearly) every
+ * layer. Resuming it segment by segment must end in the class of a plain
+ * run, and a new run must drop the suspended one so its token goes stale.
+ * With A/B slots a suspended run survives one hot-swap, not a second. */
+void test_tinymaix_budget(void)
+{
+    printf("[TinyMaix Test] ===========================================\n");
+    printf("[TinyMaix Test] Testing Inference Time Budget\n");
+    printf("[TinyMaix Test] ===========================================\n");
+
+    tfm_tinymaix_run_info_t info;
+    tfm_tinymaix_status_t status;
+    int expected = -1;
+    int predicted_class = -1;
+    uint32_t token, segments = 1;
+
+    status = tfm_tinymaix_run_inference_ex(NULL, 0, NULL, &expected);
+    if (status != TINYMAIX_STATUS_SUCCESS) {
+        printf("[TinyMaix Test] ✗ Reference inference failed: %d\n", status);
+        return;
+    }
+
+    printf("[TinyMaix Test] 1. Running with a 1 tick budget, resuming until done...\n");
+    status = tfm_tinymaix_run_budget(NULL, 0, 1, 0, &predicted_class, &info);
+    if (status == TINYMAIX_STATUS_ERROR_NOT_SUPPORTED) {
+        printf("[TinyMaix Test] - No service timer, budgets not supported, skipped\n\n");
+        return;
+    }
+    while (status == TINYMAIX_STATUS_INCOMPLETE) {
+        segments++;
+        status = tfm_tinymaix_resume(info.resume_token, 1, &predicted_class, &info);
+    }
+    if (status != TINYMAIX_STATUS_SUCCESS || predicted_class != expected) {
+        printf("[TinyMaix Test] ✗ Budgeted run: %d, class %d (expected %d)\n", status, predicted_class, expected);
+        return;
+    }
+    if (segments < 2) {
+        printf("[TinyMaix Test] ✗ Budgeted run never yielded\n");
+        return;
+    }
+    printf("[TinyMaix Test] ✓ Class %d in %lu segments\n", predicted_class, (unsigned long)segments);
+
+    printf("[TinyMaix Test] 2. Suspending, then running again...\n");
+    status = tfm_tinymaix_run_budget(NULL, 0, 1, TINYMAIX_RUN_FLAG_ARGMAX_ONLY, &predicted_class, &info);
+    if (status != TINYMAIX_STATUS_INCOMPLETE) {
+        printf("[TinyMaix Test] ✗ Budgeted run did not suspend: %d\n", status);
+        return;
+    }
+    token = info.resume_token;
+    status = tfm_tinymaix_run_inference(&predicted_class);
+    if (status != TINYMAIX_STATUS_SUCCESS || predicted_class != expected) {
+        printf("[TinyMaix Test] ✗ Run after the suspended one: %d, class %d\n", status, predicted_class);
+        return;
+    }
+    status = tfm_tinymaix_resume(token, 0, &predicted_class, &info);
+    if (status == TINYMAIX_STATUS_SUCCESS || status == TINYMAIX_STATUS_INCOMPLETE) {
+        printf("[TinyMaix Test] ✗ Stale resume token accepted: %d\n", status);
+        return;
+    }
+    printf("[TinyMaix Test] ✓ Stale resume token rejected\n");
+
+#ifdef TINYMAIX_AB_SLOTS
+    printf("[TinyMaix Test] 3. Suspending, hot-swapping the model, resuming...\n");
+    status = tfm_tinymaix_run_budget(NULL, 0, 1, TINYMAIX_RUN_FLAG_ARGMAX_ONLY, &predicted_class, &info);
+    if (status != TINYMAIX_STATUS_INCOMPLETE) {
+        printf("[TinyMaix Test] ✗ Budgeted run did not suspend: %d\n", status);
+        return;
+    }
+    token = info.resume_token;
+    status = tfm_tinymaix_load_encrypted_model();
+    if (status != TINYMAIX_STATUS_SUCCESS) {
+        printf("[TinyMaix Test] ✗ Hot-swap load failed: %d\n", status);
+        return;
+    }
+    status = tfm_tinymaix_resume(token, 0, &predicted_class, &info);
+    if (status != TINYMAIX_STATUS_SUCCESS || predicted_class != expected) {
+        printf("[TinyMaix Test] ✗ Resume after the hot-swap: %d, class %d\n", status, predicted_class);
+        return;
+    }
+    printf("[TinyMaix Test] ✓ Suspended run finished on the swapped out model\n");
+
+    printf("[TinyMaix Test] 4. Suspending, then hot-swapping twice...\n");
+    status = tfm_tinymaix_run_budget(NULL, 0, 1, TINYMAIX_RUN_FLAG_ARGMAX_ONLY, &predicted_class, &info);
+    if (status != TINYMAIX_STATUS_INCOMPLETE) {
+        printf("[TinyMaix Test] ✗ Budgeted run did not suspend: %d\n", status);
+        return;
+    }
+    token = info.resume_token;
+    for (int i = 0; i < 2; i++) {
+        status = tfm_tinymaix_load_encrypted_model();
+        if (status != TINYMAIX_STATUS_SUCCESS) {
+            printf("[TinyMaix Test] ✗ Hot-swap load %d failed: %d\n", i + 1, status);
+            return;
+        }
+    }
+    status = tfm_tinymaix_resume(token, 0, &predicted_class, &info);
+    if (status == TINYMAIX_STATUS_SUCCESS || status == TINYMAIX_STATUS_INCOMPLETE) {
+        printf("[TinyMaix Test] ✗ Resume token survived the load into its storage: %d\n", status);
+        return;
+    }
+    status = tfm_tinymaix_run_inference(&predicted_class);
+    if (status != TINYMAIX_STATUS_SUCCESS || predicted_class != expected) {
+        printf("[TinyMaix Test] ✗ Run after the hot-swaps: %d, class %d\n", status, predicted_class);
+        return;
+    }
+    printf("[TinyMaix Test] ✓ Second load dropped the suspended run\n");
+#endif
+    printf("[TinyMaix Test] ✓ Time budget test passed!\n\n");
+}
+
+/* Service stats: after a reset, a reload of the builtin package, every
+ * inference and a rejected request must show up in the counters, and with a running timer each request in
+ * the end-to-end histogram. Lines are parsed like the profile lines. */
+#define TINYMAIX_STATS_RUNS         4
+
+void test_tinymaix_stats(void)
+{
+    static const char* hist_names[TINYMAIX_STATS_HIST_CNT] = {
+        "decrypt", "preprocess", "run", "request"
+    };
+    static const char* err_names[TINYMAIX_STATS_ERR_CNT] = {
+        "param", "state", "unsupported", "decrypt", "model", "inference", "other"
+    };
+    static tfm_tinymaix_stats_t stats;
+    static uint8_t bad_image[10];
+    tfm_tinymaix_status_t status;
+    uint32_t timed = 0;
+    int predicted_class = -1;
+
+    status = tfm_tinymaix_get_stats(NULL, TINYMAIX_STATS_FLAG_RESET);
+    if (status != TINYMAIX_STATUS_SUCCESS) {
+        printf("[TinyMaix Test] ✗ Stats reset failed: %d\n", status);
+        return;
+    }
+    /* Client package path: decrypted even when the builtin model was preloaded */
+    status = tfm_tinymaix_load_encrypted_model_slot(TINYMAIX_SLOT_MAIN, encrypted_mdl_data_data,
+                                                    encrypted_mdl_data_size);
+    if (status != TINYMAIX_STATUS_SUCCESS) {
+        printf("[TinyMaix Test] ✗ Reload failed: %d\n", status);
+        return;
+    }
+    for (int i = 0; i < TINYMAIX_STATS_RUNS; i++) {
+        status = tfm_tinymaix_run_inference(&predicted_class);
+        if (status != TINYMAIX_STATUS_SUCCESS) {
+            printf("[TinyMaix Test] ✗ Inference %d failed: %d\n", i, status);
+            return;
+        }
+    }
+    /* Neither 0 nor 28x28 bytes: rejected by the service */
+    status = tfm_tinymaix_run_inference_ex(bad_image, sizeof(bad_image), NULL, &predicted_class);
+    if (status == TINYMAIX_STATUS_SUCCESS) {
+        printf("[TinyMaix Test] ✗ Bad image size accepted\n");
+        return;
+    }
+
+    status = tfm_tinymaix_get_stats(&stats, 0);
+    if (status != TINYMAIX_STATUS_SUCCESS) {
+        printf("[TinyMaix Test] ✗ Get stats failed: %d\n", status);
+        return;
+    }
+    printf("[TinyMaix Stats] tick_hz %lu requests %lu loads %lu inferences %lu suspends %lu decrypted %lu\n",
+           (unsigned long)stats.tick_hz, (unsigned long)stats.requests, (unsigned long)stats.loads,
+           (unsigned long)stats.inferences, (unsigned long)stats.suspends,
+           (unsigned long)stats.bytes_decrypted);
+    for (int i = 0; i < TINYMAIX_STATS_ERR_CNT; i++) {
+        printf("[TinyMaix Stats] error %s %lu\n", err_names[i], (unsigned long)stats.errors[i]);
+    }
+    for (uint32_t i = 0; i < TINYMAIX_STATS_ARENA_BANKS; i++) {
+        printf("[TinyMaix Stats] arena %lu %lu %lu\n", (unsigned long)i,
+               (unsigned long)stats.arena_high_water[i], (unsigned long)stats.arena_size);
+    }
+    for (int h = 0; h < TINYMAIX_STATS_HIST_CNT; h++) {
+        for (uint32_t b = 0; b < TINYMAIX_STATS_HIST_BINS; b++) {
+            if (stats.hist[h][b]) {
+                printf("[TinyMaix Stats] hist %s %lu %lu\n", hist_names[h], (unsigned long)b,
+                       (unsigned long)stats.hist[h][b]);
+            }
+        }
+    }
+    for (uint32_t b = 0; b < TINYMAIX_STATS_HIST_BINS; b++) {
+        timed += stats.hist[TINYMAIX_STATS_HIST_REQUEST][b];
+    }
+
+    if (stats.loads != 1 || stats.bytes_decrypted == 0 || stats.inferences != TINYMAIX_STATS_RUNS ||
+        stats.errors[TINYMAIX_STATS_ERR_PARAM] != 1 || stats.requests != TINYMAIX_STATS_RUNS + 2) {
+        printf("[TinyMaix Test] ✗ Counters off: %lu loads, %lu inferences, %lu param errors, %lu requests\n",
+               (unsigned long)stats.loads, (unsigned long)stats.inferences,
+               (unsigned long)stats.errors[TINYMAIX_STATS_ERR_PARAM], (unsigned long)stats.requests);
+        return;
+    }
+    if (stats.tick_hz != 0 && timed != TINYMAIX_STATS_RUNS) {
+        printf("[TinyMaix Test] ✗ %lu requests timed, expected %d\n", (unsigned long)timed, TINYMAIX_STATS_RUNS);
+        return;
+    }
+    printf("[TinyMaix Test] ✓ Stats test passed!\n\n");
+}
+
+/* Stream frames: a repeated frame changes no tile, a small edit only a few,
+ * and the class and dequantised top-1 probability must match a full run of
+ * the same frame. Needs a model planned with --delta, skipped otherwise.
+ * tools/host/tm_host_test.sh checks whole outputs and the resident stack. */
+void test_tinymaix_stream(void)
+{
+    printf("[TinyMaix Test] ===========================================\n");
+    printf("[TinyMaix Test] Testing Incremental Stream Inference\n");
+    printf("[TinyMaix Test] ===========================================\n");
+
+    static uint8_t frame[28*28];
+    tfm_tinymaix_status_t status;
+    tfm_tinymaix_run_info_t info;
+    tfm_tinymaix_run_info_t full_info;
+    int stream_class = -1;
+    int full_class = -1;
+
+    /* Frame 1: a vertical stroke */
+    memset(frame, 0, sizeof(frame));
+    for (int y = 4; y < 24; y++) {
+        memset(&frame[y * 28 + 13], 255, 3);
+    }
+
+    printf("[TinyMaix Test] 1. First frame runs in full...\n");
+    status = tfm_tinymaix_run_stream(frame, sizeof(frame), 0, 0, &stream_class, &info);
+    if (status == TINYMAIX_STATUS_ERROR_NOT_SUPPORTED) {
+        printf("[TinyMaix Test] - Model not planned with --delta, skipped\n\n");
+        return;
+    }
+    if (status != TINYMAIX_STATUS_SUCCESS || !info.stream_full) {
+        printf("[TinyMaix Test] ✗ First frame failed: %d (full %d)\n", status, (int)info.stream_full);
+        return;
+    }
+
+    printf("[TinyMaix Test] 2. Same frame: no tile changed...\n");
+    status = tfm_tinymaix_run_stream(frame, sizeof(frame), 0, 0, &stream_class, &info);
+    if (status != TINYMAIX_STATUS_SUCCESS || info.stream_full || info.stream_changed != 0) {
+        printf("[TinyMaix Test] ✗ Repeated frame failed: %d (changed %d/%d)\n", status,
+               info.stream_changed, info.stream_tiles);
+        return;
+    }
+
+    printf("[TinyMaix Test] 3. Small edit: partial recompute...\n");
+    for (int y = 20; y < 24; y++) {
+        memset(&frame[y * 28 + 8], 255, 6);
+    }
+    status = tfm_tinymaix_run_stream(frame, sizeof(frame), 0, 0, &stream_class, &info);
+    if (status != TINYMAIX_STATUS_SUCCESS || info.stream_full) {
+        printf("[TinyMaix Test] ✗ Edited frame failed: %d (full %d)\n", status, (int)info.stream_full);
+        return;
+    }
+
+    printf("[TinyMaix Test] 4. Full run of the same frame...\n");
+    status = tfm_tinymaix_run_budget(frame, sizeof(frame), 0, 0, &full_class, &full_info);
+    if (status != TINYMAIX_STATUS_SUCCESS || full_class != stream_class) {
+        printf("[TinyMaix Test] ✗ Class mismatch: stream=%d, full=%d\n", stream_class, full_class);
+        return;
+    }
+    if (full_info.confidence != info.confidence) {
+        printf("[TinyMaix Test] ✗ Output mismatch: stream top-1 %d/1000, full %d/1000\n",
+               (int)(info.confidence * 1000), (int)(full_info.confidence * 1000));
+        return;
+    }
+
+    printf("[TinyMaix Test] ✓ %d/%d tiles recomputed, class %d and output match the full run\n",
+           info.stream_changed, info.stream_tiles, stream_class);
+    printf("[TinyMaix Test] ✓ Stream test passed!\n\n");
+}
+
+#ifdef TINYMAIX_PRELOAD
+#define TINYMAIX_FIRST_MODE  "preload"
+#else
+#define TINYMAIX_FIRST_MODE  "cold"
+#endif
+
+/* First request after boot, the wake-classify-sleep path: LOAD of the builtin
+ * model, then one inference, then a second (warm) inference for reference.
+ * Must run before any other TinyMaix call. In a TFM_TINYMAIX_PRELOAD build
+ * the LOAD is a no-op and the run finds warm caches. Lines are compared by
+ * tools/tinymaix_latency_compare.py --cold/--preload */
+void test_tinymaix_first_inference(void)
+{
+    tfm_tinymaix_status_t status;
+    uint32_t start, load_ticks, run_ticks, warm_ticks;
+    int predicted_class = -1;
+
+    start = os_wrapper_get_tick();
+    status = tfm_tinymaix_load_encrypted_model();
+    load_ticks = os_wrapper_get_tick() - start;
+    if (status != TINYMAIX_STATUS_SUCCESS) {
+        printf("[TinyMaix Test] ✗ First model load failed: %d\n", status);
+        return;
+    }
+
+    start = os_wrapper_get_tick();
+    status = tfm_tinymaix_run_inference(&predicted_class);
+    run_ticks = os_wrapper_get_tick() - start;
+    if (status != TINYMAIX_STATUS_SUCCESS) {
+        printf("[TinyMaix Test] ✗ First inference failed: %d\n", status);
+        return;
+    }
+
+    start = os_wrapper_get_tick();
+    status = tfm_tinymaix_run_inference(&predicted_class);
+    warm_ticks = os_wrapper_get_tick() - start;
+    if (status != TINYMAIX_STATUS_SUCCESS) {
+        printf("[TinyMaix Test] ✗ Second inference failed: %d\n", status);
+        return;
+    }
+
+    printf("[TinyMaix First] mode %s load %lu run %lu warm %lu ticks\n", TINYMAIX_FIRST_MODE,
+           (unsigned long)load_ticks, (unsigned long)run_ticks, (unsigned long)warm_ticks);
+    printf("[TinyMaix Test] ✓ First inference measured (%s), class %d\n\n", TINYMAIX_FIRST_MODE,
+           predicted_class);
+}
+
+#define TINYMAIX_LAT_CALLS   1000
+#define TINYMAIX_LAT_RUNS    20
+
+#ifdef TINYMAIX_SFN
+#define TINYMAIX_LAT_MODEL   "sfn"
+#else
+#define TINYMAIX_LAT_MODEL   "ipc"
+#endif
+
+/* Call latency of the service in this build (IPC or SFN partition model).
+ * Null calls time the dispatch round trip on one connection, runs add
+ * connect/close and an argmax inference. Lines are compared by
+ * tools/tinymaix_latency_compare.py */
+void test_tinymaix_call_latency(void)
+{
+    tfm_tinymaix_run_params_t params = {
+        .flags = TINYMAIX_RUN_FLAG_ARGMAX_ONLY
+    };
+    tfm_tinymaix_status_t status;
+    psa_status_t call_status;
+    psa_handle_t handle;
+    uint32_t start, null_ticks, run_ticks;
+    int predicted_class = -1;
+
+    handle = psa_connect(TFM_TINYMAIX_INFERENCE_SID, 1);
+    if (handle <= 0) {
+        printf("[TinyMaix Test] ✗ Connect failed: %d\n", (int)handle);
+        return;
+    }
+    start = os_wrapper_get_tick();
+    for (int i = 0; i < TINYMAIX_LAT_CALLS; i++) {
+        /* Unknown message type: the service replies NOT_SUPPORTED without work */
+        call_status = psa_call(handle, 0, NULL, 0, NULL, 0);
+        if (call_status != PSA_ERROR_NOT_SUPPORTED) {
+            break;
+        }
+    }
+    null_ticks = os_wrapper_get_tick() - start;
+    psa_close(handle);
+    if (call_status != PSA_ERROR_NOT_SUPPORTED) {
+        printf("[TinyMaix Test] ✗ Null call returned %d\n", (int)call_status);
+        return;
+    }
+
+    start = os_wrapper_get_tick();
+    for (int i = 0; i < TINYMAIX_LAT_RUNS; i++) {
+        status = tfm_tinymaix_run_inference_ex(NULL, 0, &params, &predicted_class);
+        if (status != TINYMAIX_STATUS_SUCCESS) {
+            printf("[TinyMaix Test] ✗ Timed inference failed: %d\n", status);
+            return;
+        }
+    }
+    run_ticks = os_wrapper_get_tick() - start;
+
+    printf("[TinyMaix Lat] model %s null %d ticks %lu\n", TINYMAIX_LAT_MODEL,
+           TINYMAIX_LAT_CALLS, (unsigned long)null_ticks);
+    printf("[TinyMaix Lat] model %s run %d ticks %lu\n", TINYMAIX_LAT_MODEL,
+           TINYMAIX_LAT_RUNS, (unsigned long)run_ticks);
+    printf("[TinyMaix Test] ✓ Call latency measured (%s partition)\n\n", TINYMAIX_LAT_MODEL);
+}
+
+/* Dump the layer profile of a full run (TFM_TINYMAIX_PROFILE builds).
+ * Lines are parsed by tools/tinymaix_model_stats.py --profile */
+void test_tinymaix_profile(void)
+{
+    static const char* phase_names[TINYMAIX_PROF_PHASE_CNT] = {
+        "sbuf", "dotp", "post", "valid", "pad", "conv", "pwconv", "dwconv"
+    };
+    tfm_tinymaix_profile_t prof;
+    tfm_tinymaix_status_t status;
+    int predicted_class = -1;
+
+    status = tfm_tinymaix_run_inference_ex(NULL, 0, NULL, &predicted_class);
+    if (status != TINYMAIX_STATUS_SUCCESS) {
+        printf("[TinyMaix Test] ✗ Profiled inference failed: %d\n", status);
+        return;
+    }
+    status = tfm_tinymaix_get_profile(&prof);
+    if (status == TINYMAIX_STATUS_ERROR_NOT_SUPPORTED) {
+        printf("[TinyMaix Test] - Profiling not enabled, skipped\n\n");
+        return;
+    }
+    if (status != TINYMAIX_STATUS_SUCCESS) {
+        printf("[TinyMaix Test] ✗ Get profile failed: %d\n", status);
+        return;
+    }
+
+    printf("[TinyMaix Prof] tick_hz %lu runs %lu total %lu\n", (unsigned long)prof.tick_hz,
+           (unsigned long)prof.runs, (unsigned long)prof.total_ticks);
+    for (int i = 0; i < TINYMAIX_PROF_PHASE_CNT; i++) {
+        printf("[TinyMaix Prof] phase %s %lu\n", phase_names[i], (unsigned long)prof.phase_ticks[i]);
+    }
+    for (uint32_t i = 0; i < prof.layer_cnt; i++) {
+        printf("[TinyMaix Prof] layer %lu %lu %lu\n", (unsigned long)i,
+               (unsigned long)prof.layer_type[i], (unsigned long)prof.layer_ticks[i]);
+    }
+    printf("[TinyMaix Test] ✓ Profile dumped\n\n");
+}
+
 #ifdef DEV_MODE
 /* Test function to get HUK-derived model key (DEV_MODE only) */
 void test_tinymaix_get_model_key(void)
@@ -136,10 +887,41 @@ void test_tinymaix_comprehensive_suite(void)
 
     printf("[TinyMaix Test] Starting TinyMaix encrypted model tests...\n");
     
+    /* First: nothing may touch the service before the first-inference timing */
+    printf("[TinyMaix Test] Running first inference latency test...\n");
+    test_tinymaix_first_inference();
+
     /* Production Mode: Run encrypted model functionality test */
     printf("[TinyMaix Test] Running encrypted model functionality test...\n");
     test_tinymaix_basic_functionality();
     
+    printf("[TinyMaix Test] Running argmax-only fast path test...\n");
+    test_tinymaix_argmax_fast_path();
+    
+    printf("[TinyMaix Test] Running gate/main cascade test...\n");
+    test_tinymaix_cascade();
+
+    printf("[TinyMaix Test] Running model hot-swap test...\n");
+    test_tinymaix_hot_swap();
+
+    printf("[TinyMaix Test] Running request queue test...\n");
+    test_tinymaix_queue();
+
+    printf("[TinyMaix Test] Running time budget test...\n");
+    test_tinymaix_budget();
+
+    printf("[TinyMaix Test] Running service stats test...\n");
+    test_tinymaix_stats();
+
+    printf("[TinyMaix Test] Running incremental stream test...\n");
+    test_tinymaix_stream();
+
+    printf("[TinyMaix Test] Running call latency test...\n");
+    test_tinymaix_call_latency();
+
+    printf("[TinyMaix Test] Running layer profile dump...\n");
+    test_tinymaix_profile();
+
     // printf("[TinyMaix Test] Running encrypted model error handling test...\n");
     // test_tinymaix_error_handling();
 
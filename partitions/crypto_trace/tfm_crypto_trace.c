@@ -0,0 +1,267 @@
+/*
+ * Copyright (c) 2025, Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ */
+
+/*
+ * Crypto partition usage trace (TFM_TINYML_CRYPTO_TRACE builds only).
+ *
+ * Linked into the crypto partition and hooked in with ld --wrap:
+ * - mbedtls_platform_set_calloc_free: the engine heap calloc/free are
+ *   routed through here to report the heap peak (MBEDTLS_MEMORY_DEBUG)
+ * - tfm_crypto_operation_alloc/release: concurrent operations in use
+ * - the PSA core entry points the crypto service calls: algorithms and
+ *   key types that are really used
+ *
+ * Every new peak, algorithm or key type is logged once as a
+ * "[Crypto Trace]" line, read by tools/tinymaix_crypto_config.py.
+ */
+
+#include <stddef.h>
+#include <stdint.h>
+#include "psa/crypto.h"
+#include "mbedtls/platform.h"
+#include "mbedtls/memory_buffer_alloc.h"
+#include "tfm_log_unpriv.h"
+
+/* Wrapped name of a PSA core function, following its SPE renaming (crypto_spe.h) */
+#define TRACE_CAT_(a, b)        a##b
+#define TRACE_CAT(a, b)         TRACE_CAT_(a, b)
+#define WRAP(fn)                TRACE_CAT(__wrap_, fn)
+#define REAL(fn)                TRACE_CAT(__real_, fn)
+
+#define TRACE_SEEN_MAX          (24)
+
+/* API family of a traced algorithm, decides the CRYPTO_*_MODULE_ENABLED set */
+enum {
+    TRACE_HASH = 0,
+    TRACE_MAC,
+    TRACE_CIPHER,
+    TRACE_AEAD,
+    TRACE_KDF,
+    TRACE_KEY,
+    TRACE_RNG,
+};
+static const char* const trace_family[] = { "hash", "mac", "cipher", "aead", "kdf", "key", "rng" };
+
+static void* (*real_calloc)(size_t, size_t);
+static void (*real_free)(void*);
+static size_t heap_peak_reported;
+static uint32_t ops_cur, ops_peak;
+static uint32_t seen[TRACE_SEEN_MAX];
+static uint32_t seen_cnt;
+
+static void trace_heap(void)
+{
+    size_t max_used = 0, max_blocks = 0;
+
+    mbedtls_memory_buffer_alloc_max_get(&max_used, &max_blocks);
+    if (max_used > heap_peak_reported) {
+        heap_peak_reported = max_used;
+        INFO_UNPRIV("[Crypto Trace] heap peak %d blocks %d ops peak %d\n",
+                    (int)max_used, (int)max_blocks, (int)ops_peak);
+    }
+}
+
+/* Log the first use of an algorithm (or key type) in a family */
+static void trace_use(uint32_t family, uint32_t value)
+{
+    uint32_t key = (family << 28) ^ value;
+
+    for (uint32_t i = 0; i < seen_cnt; i++) {
+        if (seen[i] == key) {
+            return;
+        }
+    }
+    if (seen_cnt < TRACE_SEEN_MAX) {
+        seen[seen_cnt++] = key;
+    }
+    INFO_UNPRIV("[Crypto Trace] use %s 0x%08x\n", trace_family[family], (unsigned int)value);
+}
+
+/* Engine heap */
+
+static void* trace_calloc(size_t n, size_t size)
+{
+    void* p = real_calloc(n, size);
+
+    trace_heap();
+    return p;
+}
+
+static void trace_free(void* p)
+{
+    real_free(p);
+}
+
+int REAL(mbedtls_platform_set_calloc_free)(void* (*calloc_func)(size_t, size_t), void (*free_func)(void*));
+int WRAP(mbedtls_platform_set_calloc_free)(void* (*calloc_func)(size_t, size_t), void (*free_func)(void*))
+{
+    real_calloc = calloc_func;
+    real_free = free_func;
+    return REAL(mbedtls_platform_set_calloc_free)(trace_calloc, trace_free);
+}
+
+/* Operation contexts (crypto_alloc.c), the type is passed through unchanged */
+
+psa_status_t REAL(tfm_crypto_operation_alloc)(int type, uint32_t* handle, void** ctx);
+psa_status_t WRAP(tfm_crypto_operation_alloc)(int type, uint32_t* handle, void** ctx)
+{
+    psa_status_t status = REAL(tfm_crypto_operation_alloc)(type, handle, ctx);
+
+    if (status == PSA_SUCCESS && ++ops_cur > ops_peak) {
+        ops_peak = ops_cur;
+        INFO_UNPRIV("[Crypto Trace] ops peak %d\n", (int)ops_peak);
+    }
+    return status;
+}
+
+psa_status_t REAL(tfm_crypto_operation_release)(uint32_t* handle);
+psa_status_t WRAP(tfm_crypto_operation_release)(uint32_t* handle)
+{
+    psa_status_t status = REAL(tfm_crypto_operation_release)(handle);
+
+    if (status == PSA_SUCCESS && ops_cur > 0) {
+        ops_cur--;
+    }
+    return status;
+}
+
+/* PSA core entry points: record the algorithm, then call through */
+
+#define TRACE_OP_SETUP(fn, family, op_t)                                           \
+    psa_status_t REAL(fn)(op_t* op, psa_algorithm_t alg);                          \
+    psa_status_t WRAP(fn)(op_t* op, psa_algorithm_t alg)                           \
+    {                                                                              \
+        trace_use(family, alg);                                                    \
+        return REAL(fn)(op, alg);                                                  \
+    }
+
+#define TRACE_KEY_SETUP(fn, family, op_t)                                          \
+    psa_status_t REAL(fn)(op_t* op, mbedtls_svc_key_id_t key, psa_algorithm_t alg); \
+    psa_status_t WRAP(fn)(op_t* op, mbedtls_svc_key_id_t key, psa_algorithm_t alg) \
+    {                                                                              \
+        trace_use(family, alg);                                                    \
+        return REAL(fn)(op, key, alg);                                             \
+    }
+
+TRACE_OP_SETUP(psa_hash_setup, TRACE_HASH, psa_hash_operation_t)
+TRACE_OP_SETUP(psa_key_derivation_setup, TRACE_KDF, psa_key_derivation_operation_t)
+TRACE_KEY_SETUP(psa_mac_sign_setup, TRACE_MAC, psa_mac_operation_t)
+TRACE_KEY_SETUP(psa_mac_verify_setup, TRACE_MAC, psa_mac_operation_t)
+TRACE_KEY_SETUP(psa_cipher_encrypt_setup, TRACE_CIPHER, psa_cipher_operation_t)
+TRACE_KEY_SETUP(psa_cipher_decrypt_setup, TRACE_CIPHER, psa_cipher_operation_t)
+TRACE_KEY_SETUP(psa_aead_encrypt_setup, TRACE_AEAD, psa_aead_operation_t)
+TRACE_KEY_SETUP(psa_aead_decrypt_setup, TRACE_AEAD, psa_aead_operation_t)
+
+/* Single-part functions */
+
+psa_status_t REAL(psa_hash_compute)(psa_algorithm_t alg, const uint8_t* input, size_t input_length,
+                                    uint8_t* hash, size_t hash_size, size_t* hash_length);
+psa_status_t WRAP(psa_hash_compute)(psa_algorithm_t alg, const uint8_t* input, size_t input_length,
+                                    uint8_t* hash, size_t hash_size, size_t* hash_length)
+{
+    trace_use(TRACE_HASH, alg);
+    return REAL(psa_hash_compute)(alg, input, input_length, hash, hash_size, hash_length);
+}
+
+psa_status_t REAL(psa_mac_compute)(mbedtls_svc_key_id_t key, psa_algorithm_t alg, const uint8_t* input,
+                                   size_t input_length, uint8_t* mac, size_t mac_size, size_t* mac_length);
+psa_status_t WRAP(psa_mac_compute)(mbedtls_svc_key_id_t key, psa_algorithm_t alg, const uint8_t* input,
+                                   size_t input_length, uint8_t* mac, size_t mac_size, size_t* mac_length)
+{
+    trace_use(TRACE_MAC, alg);
+    return REAL(psa_mac_compute)(key, alg, input, input_length, mac, mac_size, mac_length);
+}
+
+psa_status_t REAL(psa_cipher_encrypt)(mbedtls_svc_key_id_t key, psa_algorithm_t alg, const uint8_t* input,
+                                      size_t input_length, uint8_t* output, size_t output_size,
+                                      size_t* output_length);
+psa_status_t WRAP(psa_cipher_encrypt)(mbedtls_svc_key_id_t key, psa_algorithm_t alg, const uint8_t* input,
+                                      size_t input_length, uint8_t* output, size_t output_size,
+                                      size_t* output_length)
+{
+    trace_use(TRACE_CIPHER, alg);
+    return REAL(psa_cipher_encrypt)(key, alg, input, input_length, output, output_size, output_length);
+}
+
+psa_status_t REAL(psa_cipher_decrypt)(mbedtls_svc_key_id_t key, psa_algorithm_t alg, const uint8_t* input,
+                                      size_t input_length, uint8_t* output, size_t output_size,
+                                      size_t* output_length);
+psa_status_t WRAP(psa_cipher_decrypt)(mbedtls_svc_key_id_t key, psa_algorithm_t alg, const uint8_t* input,
+                                      size_t input_length, uint8_t* output, size_t output_size,
+                                      size_t* output_length)
+{
+    trace_use(TRACE_CIPHER, alg);
+    return REAL(psa_cipher_decrypt)(key, alg, input, input_length, output, output_size, output_length);
+}
+
+psa_status_t REAL(psa_aead_encrypt)(mbedtls_svc_key_id_t key, psa_algorithm_t alg, const uint8_t* nonce,
+                                    size_t nonce_length, const uint8_t* additional_data,
+                                    size_t additional_data_length, const uint8_t* plaintext,
+                                    size_t plaintext_length, uint8_t* ciphertext, size_t ciphertext_size,
+                                    size_t* ciphertext_length);
+psa_status_t WRAP(psa_aead_encrypt)(mbedtls_svc_key_id_t key, psa_algorithm_t alg, const uint8_t* nonce,
+                                    size_t nonce_length, const uint8_t* additional_data,
+                                    size_t additional_data_length, const uint8_t* plaintext,
+                                    size_t plaintext_length, uint8_t* ciphertext, size_t ciphertext_size,
+                                    size_t* ciphertext_length)
+{
+    trace_use(TRACE_AEAD, alg);
+    return REAL(psa_aead_encrypt)(key, alg, nonce, nonce_length, additional_data, additional_data_length,
+                                  plaintext, plaintext_length, ciphertext, ciphertext_size, ciphertext_length);
+}
+
+psa_status_t REAL(psa_aead_decrypt)(mbedtls_svc_key_id_t key, psa_algorithm_t alg, const uint8_t* nonce,
+                                    size_t nonce_length, const uint8_t* additional_data,
+                                    size_t additional_data_length, const uint8_t* ciphertext,
+                                    size_t ciphertext_length, uint8_t* plaintext, size_t plaintext_size,
+                                    size_t* plaintext_length);
+psa_status_t WRAP(psa_aead_decrypt)(mbedtls_svc_key_id_t key, psa_algorithm_t alg, const uint8_t* nonce,
+                                    size_t nonce_length, const uint8_t* additional_data,
+                                    size_t additional_data_length, const uint8_t* ciphertext,
+                                    size_t ciphertext_length, uint8_t* plaintext, size_t plaintext_size,
+                                    size_t* plaintext_length)
+{
+    trace_use(TRACE_AEAD, alg);
+    return REAL(psa_aead_decrypt)(key, alg, nonce, nonce_length, additional_data, additional_data_length,
+                                  ciphertext, ciphertext_length, plaintext, plaintext_size, plaintext_length);
+}
+
+/* Key types */
+
+psa_status_t REAL(psa_import_key)(const psa_key_attributes_t* attributes, const uint8_t* data,
+                                  size_t data_length, mbedtls_svc_key_id_t* key);
+psa_status_t WRAP(psa_import_key)(const psa_key_attributes_t* attributes, const uint8_t* data,
+                                  size_t data_length, mbedtls_svc_key_id_t* key)
+{
+    trace_use(TRACE_KEY, psa_get_key_type(attributes));
+    return REAL(psa_import_key)(attributes, data, data_length, key);
+}
+
+psa_status_t REAL(psa_generate_key)(const psa_key_attributes_t* attributes, mbedtls_svc_key_id_t* key);
+psa_status_t WRAP(psa_generate_key)(const psa_key_attributes_t* attributes, mbedtls_svc_key_id_t* key)
+{
+    trace_use(TRACE_KEY, psa_get_key_type(attributes));
+    return REAL(psa_generate_key)(attributes, key);
+}
+
+psa_status_t REAL(psa_key_derivation_output_key)(const psa_key_attributes_t* attributes,
+                                                 psa_key_derivation_operation_t* operation,
+                                                 mbedtls_svc_key_id_t* key);
+psa_status_t WRAP(psa_key_derivation_output_key)(const psa_key_attributes_t* attributes,
+                                                 psa_key_derivation_operation_t* operation,
+                                                 mbedtls_svc_key_id_t* key)
+{
+    trace_use(TRACE_KEY, psa_get_key_type(attributes));
+    return REAL(psa_key_derivation_output_key)(attributes, operation, key);
+}
+
+psa_status_t REAL(psa_generate_random)(uint8_t* output, size_t output_size);
+psa_status_t WRAP(psa_generate_random)(uint8_t* output, size_t output_size)
+{
+    trace_use(TRACE_RNG, 0);
+    return REAL(psa_generate_random)(output, output_size);
+}
@@ -31,6 +31,31 @@ limitations under the License.
 #define TM_STATIC static
 #endif
 
+#ifndef TM_SOFTMAX_LUT_CNT
+#define TM_SOFTMAX_LUT_CNT (0)  //no int8 softmax LUT by default
+#endif
+#ifndef TM_LOAD_NOTE
+#define TM_LOAD_NOTE(...)       //tm_load falls back to a slower path
+#endif
+#ifndef TM_FC_PACK_AT_LOAD
+#define TM_FC_PACK_AT_LOAD (0)  //model bin may be const (flash), don't touch weights
+#endif
+#ifndef TM_PATCH_MAX_LAYERS
+#define TM_PATCH_MAX_LAYERS (4) //max layers in patch based stack
+#endif
+#ifndef TM_FUSE_LAYERS
+#define TM_FUSE_LAYERS (0)      //fuse conv+gap, gap+fc, fc+softmax pairs in tm_run
+#endif
+#ifndef TM_DELTA_RUN
+#define TM_DELTA_RUN (0)        //tm_run_delta: recompute only changed rows of the resident first layers
+#endif
+#ifndef TM_DELTA_TILE_ROWS
+#define TM_DELTA_TILE_ROWS (4)  //input rows per change tile of tm_run_delta
+#endif
+#ifndef TM_DELTA_MAX_ROWS
+#define TM_DELTA_MAX_ROWS (64)  //max tensor height in the delta stack (dirty row maps)
+#endif
+
 /******************************* MARCO ************************************/
 #define TM_MDL_MAGIC 'XIAM'     //mdl magic sign
 #define TM_ALIGN_SIZE   (8)     //8 byte align
@@ -107,6 +132,7 @@ typedef enum{
     TM_ERR_TODO      = 7,
     TM_ERR_MDLTYPE   = 8,
     TM_ERR_KSIZE     = 9,
+    TM_SUSPEND       = 10,  //layer callback: stop after this layer, tm_run_resume continues
 }tm_err_t;
 
 typedef enum{
@@ -159,7 +185,11 @@ typedef struct{
     uint32_t sub_size;      //pingpong buf size;
     uint16_t in_dims[4];    //0:dims; 1:dim0; 2:dim1; 3:dim2
     uint16_t out_dims[4];
-    uint8_t  reserve[28];   //reserve for future
+    uint16_t patch_layers;  //run first patch_layers conv layers patch by patch, 0: off
+    uint16_t patch_rows;    //output rows of last patch layer per patch (set by mem planner)
+    uint32_t fuse_mask;     //bit i: layer i output planned as fused into layer i+1 (set by mem planner)
+    uint16_t delta_layers;  //first delta_layers conv layers keep input and outputs resident for tm_run_delta, 0: off
+    uint8_t  reserve[18];   //reserve for future
     uint8_t  layers_body[0];//oft 64 here
 }tm_mdlbin_t;
 
@@ -172,8 +202,19 @@ typedef struct{
     uint16_t main_alloc;    //is main buf alloc or static
     uint16_t layer_i;       //current layer index
     uint8_t* layer_body;    //current layer body addr
+    uint32_t fuse;          //bit i: layer i output fused into layer i+1, found by tm_load
+    uint32_t delta_ok;      //resident delta stack matches the input at buf offset 0
 }tm_mdl_t;
 
+//tm_run_delta parameters and result
+typedef struct{
+    uint16_t tol;           //in: element change up to tol (quantised units) is ignored
+    uint16_t max_pct;       //in: more than max_pct percent of tiles changed: full run
+    uint16_t tiles;         //out: input row tiles of TM_DELTA_TILE_ROWS rows
+    uint16_t changed;       //out: tiles that changed
+    uint32_t full;          //out: 1 if the whole network ran (first frame, above max_pct)
+}tm_delta_t;
+
 //dims==3, hwc
 //dims==2, 1wc
 //dims==1, 11c
@@ -240,8 +281,9 @@ typedef struct{
     uint32_t ws_oft;        //weight scale oft from this layer start 
     uint32_t w_oft;         //weight oft from this layer start
     uint32_t b_oft;         //bias oft from this layer start
-    uint32_t reserve;       //for 8byte align
+    uint32_t w_pack;        //weight layout, 0: row major; TML_FC_PACK4: interleaved by 4 outputs. for 8byte align
 }tml_fc_t;
+#define TML_FC_PACK4 (4)    //w[o/4][k][o%4], tail (out_c%4) rows stay row major
 
 typedef struct{
     tml_head_t h;
@@ -297,6 +339,11 @@ tm_err_t tm_load  (tm_mdl_t* mdl, const uint8_t* bin, uint8_t*buf, tm_cb_t cb, t
 void     tm_unload(tm_mdl_t* mdl);                                      //remove model
 tm_err_t tm_preprocess(tm_mdl_t* mdl, tm_pp_t pp_type, tm_mat_t* in, tm_mat_t* out);            //preprocess input data
 tm_err_t tm_run   (tm_mdl_t* mdl, tm_mat_t* in, tm_mat_t* out);         //run model
+tm_err_t tm_run_argmax(tm_mdl_t* mdl, tm_mat_t* in, int* cls);          //run model, top-1 class only
+tm_err_t tm_run_resume(tm_mdl_t* mdl, tm_mat_t* out, int* cls);        //continue a suspended tm_run/tm_run_argmax
+#if TM_DELTA_RUN
+tm_err_t tm_run_delta(tm_mdl_t* mdl, tm_mat_t* in, tm_mat_t* out, int* cls, tm_delta_t* d); //run on a new frame, reuse unchanged rows
+#endif
 
 
 /******************************* LAYER FUNCTION ************************************/
@@ -305,9 +352,17 @@ tm_err_t tml_conv2d_dwconv2d(tm_mat_t* in, tm_mat_t* out, wtype_t* w, btype_t* b
     int pad_top, int pad_bottom, int pad_left, int pad_right, int dmul, \
     sctype_t* ws, sctype_t in_s, zptype_t in_zp, sctype_t out_s, zptype_t out_zp);
 tm_err_t tml_gap(tm_mat_t* in, tm_mat_t* out, sctype_t in_s, zptype_t in_zp, sctype_t out_s, zptype_t out_zp);
+void     tml_gap_sum(tm_mat_t* in, sumtype_t* sums);               //sums[c] += channel c of in, for fused producers
+tm_err_t tml_gap_post(sumtype_t* sums, int cnt, tm_mat_t* out, sctype_t in_s, zptype_t in_zp, sctype_t out_s, zptype_t out_zp);
 tm_err_t tml_fc(tm_mat_t* in, tm_mat_t* out,  wtype_t* w, btype_t* b, \
     sctype_t* ws, sctype_t in_s, zptype_t in_zp, sctype_t out_s, zptype_t out_zp);
+tm_err_t tml_fc_pack4(tm_mat_t* in, tm_mat_t* out,  wtype_t* w, btype_t* b, \
+    sctype_t* ws, sctype_t in_s, zptype_t in_zp, sctype_t out_s, zptype_t out_zp);   //w in TML_FC_PACK4 layout
 tm_err_t tml_softmax(tm_mat_t* in, tm_mat_t* out, sctype_t in_s, zptype_t in_zp, sctype_t out_s, zptype_t out_zp);
+#if TM_SOFTMAX_LUT_CNT
+tm_err_t tml_softmax_lut_init(sctype_t in_s, sctype_t out_s);     //build int8 softmax LUT at load time
+void     tml_softmax_lut_deinit(sctype_t in_s, sctype_t out_s);   //release LUT at unload time
+#endif
 tm_err_t tml_reshape(tm_mat_t* in, tm_mat_t* out, sctype_t in_s, zptype_t in_zp, sctype_t out_s, zptype_t out_zp);
 tm_err_t tml_add(tm_mat_t* in0, tm_mat_t* in1, tm_mat_t* out, \
     sctype_t in_s0, zptype_t in_zp0, sctype_t in_s1, zptype_t in_zp1, sctype_t out_s, zptype_t out_zp);
@@ -326,6 +381,7 @@ float TM_WEAK tm_fp8to32(uint8_t fp8);
 
 #define TML_GET_INPUT(mdl,lh)   ((mtype_t*)((mdl)->buf + (lh)->in_oft))
 #define TML_GET_OUTPUT(mdl,lh)  ((mtype_t*)((mdl)->buf + (lh)->out_oft))
+#define TML_IS_NOOP(lh)         ((lh)->type == TML_RESHAPE && !(lh)->is_out && (lh)->in_oft == (lh)->out_oft) //aliases its input, skipped by tm_run
 #if (TM_MDL_TYPE == TM_MDL_INT8)||(TM_MDL_TYPE == TM_MDL_INT16)
     #define TML_DEQUANT(lh, x)       (((sumtype_t)(x)-((lh)->out_zp))*((lh)->out_s))
     #define TM_DEQUANT(i8,s,zp) (((sumtype_t)(i8)-(zp))*(s))
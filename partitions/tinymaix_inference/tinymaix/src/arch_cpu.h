@@ -16,6 +16,14 @@ limitations under the License.
 #include "float.h"
 #include "tinymaix.h"
 
+//pointwise conv register tile, pixels: 1 or 2; output channels: 2 or 4
+#ifndef TM_PW_TILE_PIX
+#define TM_PW_TILE_PIX (2)
+#endif
+#ifndef TM_PW_TILE_CH
+#define TM_PW_TILE_CH  (4)
+#endif
+
 #if (TM_MDL_TYPE != TM_MDL_FP8_143) && (TM_MDL_TYPE != TM_MDL_FP8_152)
 //sum = SUM(Ai*Bi)
 TM_INLINE void tm_dot_prod(mtype_t* sptr, mtype_t* kptr,uint32_t size, sumtype_t* result)
@@ -69,6 +77,113 @@ TM_INLINE  void tm_dot_prod_pack2(mtype_t* sptr, mtype_t* kptr, uint32_t size, s
     return;
 }
 
+TM_INLINE  void tm_dot_prod_pack4(mtype_t* sptr, mtype_t* kptr, uint32_t size, sumtype_t* result)
+{ 
+    sumtype_t sum0 = 0;
+    sumtype_t sum1 = 0;
+    sumtype_t sum2 = 0;
+    sumtype_t sum3 = 0;
+    mtype_t* kptr0 = kptr;
+    mtype_t* kptr1 = kptr+size;
+    mtype_t* kptr2 = kptr+size*2;
+    mtype_t* kptr3 = kptr+size*3;
+
+    uint32_t i = 0;
+    uint32_t cnt = (size>>2)<<2;  //4
+    for(; i+4-1 <cnt; ){
+        sum0 += sptr[i]*kptr0[i]; sum1 += sptr[i]*kptr1[i]; sum2 += sptr[i]*kptr2[i]; sum3 += sptr[i]*kptr3[i]; i++;
+        sum0 += sptr[i]*kptr0[i]; sum1 += sptr[i]*kptr1[i]; sum2 += sptr[i]*kptr2[i]; sum3 += sptr[i]*kptr3[i]; i++;
+        sum0 += sptr[i]*kptr0[i]; sum1 += sptr[i]*kptr1[i]; sum2 += sptr[i]*kptr2[i]; sum3 += sptr[i]*kptr3[i]; i++;
+        sum0 += sptr[i]*kptr0[i]; sum1 += sptr[i]*kptr1[i]; sum2 += sptr[i]*kptr2[i]; sum3 += sptr[i]*kptr3[i]; i++;
+    }
+    for(; i <size; i++){
+        sum0 += sptr[i]*kptr0[i]; 
+        sum1 += sptr[i]*kptr1[i]; 
+        sum2 += sptr[i]*kptr2[i]; 
+        sum3 += sptr[i]*kptr3[i]; 
+    }
+
+    result[0] = sum0;
+    result[1] = sum1;
+    result[2] = sum2;
+    result[3] = sum3;
+    return;
+}
+
+//pointwise conv tile: 2 pixels x 2 channels, kptr rows as pack2
+//result: [pix0 ch0..1, pix1 ch0..1]
+TM_INLINE  void tm_dot_prod_2x2(mtype_t* sptr0, mtype_t* sptr1, mtype_t* kptr, uint32_t size, sumtype_t* result)
+{ 
+    sumtype_t sum00 = 0, sum01 = 0;
+    sumtype_t sum10 = 0, sum11 = 0;
+    mtype_t* kptr0 = kptr;
+    mtype_t* kptr1 = kptr+size;
+
+    for(uint32_t i = 0; i <size; i++){
+        sumtype_t s0 = sptr0[i];
+        sumtype_t s1 = sptr1[i];
+        sumtype_t k0 = kptr0[i];
+        sumtype_t k1 = kptr1[i];
+        sum00 += s0*k0; sum01 += s0*k1; 
+        sum10 += s1*k0; sum11 += s1*k1; 
+    }
+
+    result[0] = sum00; result[1] = sum01;
+    result[2] = sum10; result[3] = sum11;
+    return;
+}
+
+//pointwise conv tile: 2 pixels x 4 channels, each weight loaded once for both pixels
+//result: [pix0 ch0..3, pix1 ch0..3]
+TM_INLINE  void tm_dot_prod_2x4(mtype_t* sptr0, mtype_t* sptr1, mtype_t* kptr, uint32_t size, sumtype_t* result)
+{ 
+    sumtype_t sum00 = 0, sum01 = 0, sum02 = 0, sum03 = 0;
+    sumtype_t sum10 = 0, sum11 = 0, sum12 = 0, sum13 = 0;
+    mtype_t* kptr0 = kptr;
+    mtype_t* kptr1 = kptr+size;
+    mtype_t* kptr2 = kptr+size*2;
+    mtype_t* kptr3 = kptr+size*3;
+
+    for(uint32_t i = 0; i <size; i++){
+        sumtype_t s0 = sptr0[i];
+        sumtype_t s1 = sptr1[i];
+        sumtype_t k  = kptr0[i]; sum00 += s0*k; sum10 += s1*k;
+        k  = kptr1[i]; sum01 += s0*k; sum11 += s1*k;
+        k  = kptr2[i]; sum02 += s0*k; sum12 += s1*k;
+        k  = kptr3[i]; sum03 += s0*k; sum13 += s1*k;
+    }
+
+    result[0] = sum00; result[1] = sum01; result[2] = sum02; result[3] = sum03;
+    result[4] = sum10; result[5] = sum11; result[6] = sum12; result[7] = sum13;
+    return;
+}
+
+//4 sums in one pass over sptr, kptr interleaved by 4 outputs: k0o0,k0o1,k0o2,k0o3,k1o0,...
+TM_INLINE void tm_dot_prod_il4(mtype_t* sptr, mtype_t* kptr, uint32_t size, sumtype_t* result)
+{
+    sumtype_t sum0 = 0;
+    sumtype_t sum1 = 0;
+    sumtype_t sum2 = 0;
+    sumtype_t sum3 = 0;
+
+    uint32_t i = 0;
+    uint32_t cnt = (size>>1)<<1;  //2
+    for(; i+2-1 <cnt; ){
+        sum0 += sptr[i]*kptr[0]; sum1 += sptr[i]*kptr[1]; sum2 += sptr[i]*kptr[2]; sum3 += sptr[i]*kptr[3]; i++;
+        sum0 += sptr[i]*kptr[4]; sum1 += sptr[i]*kptr[5]; sum2 += sptr[i]*kptr[6]; sum3 += sptr[i]*kptr[7]; i++;
+        kptr += 8;
+    }
+    for(; i <size; i++){
+        sum0 += sptr[i]*kptr[0]; sum1 += sptr[i]*kptr[1]; sum2 += sptr[i]*kptr[2]; sum3 += sptr[i]*kptr[3];
+        kptr += 4;
+    }
+    result[0] = sum0;
+    result[1] = sum1;
+    result[2] = sum2;
+    result[3] = sum3;
+    return;
+}
+
 TM_INLINE void tm_dot_prod_gap_3x3x1(mtype_t* sptr, mtype_t* kptr, uint32_t* k_oft, sumtype_t* result)
 {
     *result = sptr[k_oft[0]]*kptr[0] + sptr[k_oft[1]]*kptr[1] + sptr[k_oft[2]]*kptr[2] + \
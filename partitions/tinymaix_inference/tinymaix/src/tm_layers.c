@@ -39,6 +39,26 @@ TM_PERF_REG(t_sbuf);TM_PERF_REG(t_dotp);TM_PERF_REG(t_post);
 TM_PERF_REG(t_valid); TM_PERF_REG(t_pad); 
 TM_PERF_REG(t_conv); TM_PERF_REG(t_pwconv); TM_PERF_REG(t_dwconv); 
 
+/*************************** FIXED POINT **********************************/
+#if TM_MDL_TYPE == TM_MDL_INT8
+//fixed point rescale: x*real ~= (x*mul)>>shift
+//shift is the largest one (<=max_shift) keeping rmax*2^shift < 2^bits
+static int tml_quant_shift(float rmax, int bits, int max_shift)
+{
+    int shift = 0;
+    float lim = (float)(1UL<<bits);
+    if(rmax <= 0 || rmax >= lim) return -1; //can't represent
+    while(shift < max_shift && rmax*2.f < lim) { rmax *= 2.f; shift++; }
+    return shift;
+}
+
+static int32_t tml_quant_mult(float real, int shift)
+{
+    for(int i=0; i<shift; i++) real *= 2.f;
+    return (int32_t)(real + (real >= 0 ? 0.5f : -0.5f));
+}
+#endif
+
 /*************************** TML_CONV2D **********************************/
 TM_STATIC uint32_t k_oft[TM_MAX_KSIZE]; 
 TM_STATIC mtype_t sbuf[TM_MAX_KCSIZE]; 
@@ -91,26 +111,67 @@ tm_err_t TM_WEAK tml_conv2d_dwconv2d(tm_mat_t* in, tm_mat_t* out, wtype_t* w, bt
 #endif
 
     if(maxk==1){ TM_PERF_START(t_pwconv);   //pointwise conv
-        #define BATCH_SIZE 2
-        sumtype_t sums[BATCH_SIZE];
-        for (int y = 0; y < out->h; y++) {
-            for (int x = 0; x < out->w; x++) {
-                mtype_t* sptr = (mtype_t*)TM_MATP(in, sy*y, sx*x, 0);
-                wtype_t* kptr = (wtype_t*)w;
-                int c = 0;
-                for(; c<out->c-BATCH_SIZE+1; ){
-                    for(int bat = 0; bat < BATCH_SIZE; bat+=2)
-                        tm_dot_prod_pack2(sptr, kptr + chi*bat, chi, sums + bat);
-                    tm_postprocess_sum(BATCH_SIZE, sums, b + c, act, outp, SUMSCALE, OUTSCALE, out_zp);
-                    c += BATCH_SIZE;
-                    outp += BATCH_SIZE;
-                    kptr += chi*BATCH_SIZE;//*2;
-                }
-                for(; c<out->c; c++){
-                    tm_dot_prod(sptr, kptr, chi, &sum); //size=maxk*chi //pw maxk==1
-                    tm_postprocess_sum(1, &sum, b + c, act, outp, SUMSCALE, OUTSCALE, out_zp); outp++;
-                    kptr += chi;
-                }
+    #if TM_PW_TILE_CH == 4
+        #define TM_DOT_PROD_PW      tm_dot_prod_pack4
+        #define TM_DOT_PROD_PW_2PIX tm_dot_prod_2x4
+    #elif TM_PW_TILE_CH == 2
+        #define TM_DOT_PROD_PW      tm_dot_prod_pack2
+        #define TM_DOT_PROD_PW_2PIX tm_dot_prod_2x2
+    #else
+        #error "TM_PW_TILE_CH must be 2 or 4"
+    #endif
+        sumtype_t sums[TM_PW_TILE_PIX*TM_PW_TILE_CH];
+        int pix_cnt = out->h*out->w;
+        int p = 0;
+    #if TM_PW_TILE_PIX == 2
+        for(; p+2 <= pix_cnt; p += 2){  //2 pixels share each weight load
+            mtype_t* sptr0 = (mtype_t*)TM_MATP(in, sy*(p/out->w), sx*(p%out->w), 0);
+            mtype_t* sptr1 = (mtype_t*)TM_MATP(in, sy*((p+1)/out->w), sx*((p+1)%out->w), 0);
+            mtype_t* outp1 = outp + cho;
+            wtype_t* kptr = (wtype_t*)w;
+            int c = 0;
+            for(; c<cho-TM_PW_TILE_CH+1; ){
+                TM_PERF_START(t_dotp);
+                TM_DOT_PROD_PW_2PIX(sptr0, sptr1, kptr, chi, sums);
+                TM_PERF_ADD(t_dotp);TM_PERF_START(t_post);
+                tm_postprocess_sum(TM_PW_TILE_CH, sums, b + c, act, outp, SUMSCALE, OUTSCALE, out_zp);
+                tm_postprocess_sum(TM_PW_TILE_CH, sums + TM_PW_TILE_CH, b + c, act, outp1, SUMSCALE, OUTSCALE, out_zp);
+                TM_PERF_ADD(t_post);
+                c += TM_PW_TILE_CH;
+                outp += TM_PW_TILE_CH;
+                outp1 += TM_PW_TILE_CH;
+                kptr += chi*TM_PW_TILE_CH;
+            }
+            for(; c<cho; c++){
+                tm_dot_prod(sptr0, kptr, chi, &sum);
+                tm_postprocess_sum(1, &sum, b + c, act, outp, SUMSCALE, OUTSCALE, out_zp); outp++;
+                tm_dot_prod(sptr1, kptr, chi, &sum);
+                tm_postprocess_sum(1, &sum, b + c, act, outp1, SUMSCALE, OUTSCALE, out_zp); outp1++;
+                kptr += chi;
+            }
+            outp = outp1;
+        }
+    #elif TM_PW_TILE_PIX != 1
+        #error "TM_PW_TILE_PIX must be 1 or 2"
+    #endif
+        for(; p < pix_cnt; p++){
+            mtype_t* sptr = (mtype_t*)TM_MATP(in, sy*(p/out->w), sx*(p%out->w), 0);
+            wtype_t* kptr = (wtype_t*)w;
+            int c = 0;
+            for(; c<cho-TM_PW_TILE_CH+1; ){
+                TM_PERF_START(t_dotp);
+                TM_DOT_PROD_PW(sptr, kptr, chi, sums);
+                TM_PERF_ADD(t_dotp);TM_PERF_START(t_post);
+                tm_postprocess_sum(TM_PW_TILE_CH, sums, b + c, act, outp, SUMSCALE, OUTSCALE, out_zp);
+                TM_PERF_ADD(t_post);
+                c += TM_PW_TILE_CH;
+                outp += TM_PW_TILE_CH;
+                kptr += chi*TM_PW_TILE_CH;
+            }
+            for(; c<cho; c++){
+                tm_dot_prod(sptr, kptr, chi, &sum); //size=maxk*chi //pw maxk==1
+                tm_postprocess_sum(1, &sum, b + c, act, outp, SUMSCALE, OUTSCALE, out_zp); outp++;
+                kptr += chi;
             }
         }
         TM_PERF_ADD(t_pwconv);
@@ -136,7 +197,7 @@ tm_err_t TM_WEAK tml_conv2d_dwconv2d(tm_mat_t* in, tm_mat_t* out, wtype_t* w, bt
             int src_x0 = sx*x - pad_left;
             sumtype_t sum;
             slow_flag = ((src_y0<0)+(src_x0<0)+(src_y0+kh>in->h)+(src_x0+kw>in->w));
-            //TM_PERF_START(t_sbuf);
+            TM_PERF_START(t_sbuf);
             if(!slow_flag) {TM_PERF_START(t_valid); //valid or same valid part
                 mtype_t* sptr_base = (mtype_t*)TM_MATP(in, src_y0, src_x0, 0); //?c/dmul:0
                 mtype_t* sptr = sptr_base; //= (mtype_t*)TM_MATP(in, src_y0, src_x0, 0); //sbuf 不变
@@ -175,20 +236,20 @@ tm_err_t TM_WEAK tml_conv2d_dwconv2d(tm_mat_t* in, tm_mat_t* out, wtype_t* w, bt
                     sptr = sptr_base + (dmul?(cc+1)/dmul:(cc+1));
                 }
             }
-            //TM_PERF_ADD(t_sbuf);
+            TM_PERF_ADD(t_sbuf);
             mtype_t* sptr = sbuf;    //sbuf prepare ok~
             if(maxk*chi==9 && dmul){ //simple opt for 3x3 dwconv
                 for(int c=0; c<out->c; c++){
-                    wtype_t* kptr = (wtype_t*)w + c*chi*maxk;//TM_PERF_START(t_dotp);
-                    tm_dot_prod_3x3x1(sptr, kptr, &sum);//TM_PERF_ADD(t_dotp);TM_PERF_START(t_post);
-                    tm_postprocess_sum(1, &sum, b + c, act, outp, SUMSCALE, OUTSCALE, out_zp); outp++;//TM_PERF_ADD(t_post);
+                    wtype_t* kptr = (wtype_t*)w + c*chi*maxk;TM_PERF_START(t_dotp);
+                    tm_dot_prod_3x3x1(sptr, kptr, &sum);TM_PERF_ADD(t_dotp);TM_PERF_START(t_post);
+                    tm_postprocess_sum(1, &sum, b + c, act, outp, SUMSCALE, OUTSCALE, out_zp); outp++;TM_PERF_ADD(t_post);
                     sptr += maxk; //dwconv need move step
                 }
             }else {
                 for(int c=0; c<out->c; c++){
-                    wtype_t* kptr = (wtype_t*)w + c*chi*maxk;//TM_PERF_START(t_dotp);
-                    tm_dot_prod(sptr, kptr, maxk*chi, &sum);//TM_PERF_ADD(t_dotp);TM_PERF_START(t_post);
-                    tm_postprocess_sum(1, &sum, b + c, act, outp, SUMSCALE, OUTSCALE, out_zp); outp++;//TM_PERF_ADD(t_post);
+                    wtype_t* kptr = (wtype_t*)w + c*chi*maxk;TM_PERF_START(t_dotp);
+                    tm_dot_prod(sptr, kptr, maxk*chi, &sum);TM_PERF_ADD(t_dotp);TM_PERF_START(t_post);
+                    tm_postprocess_sum(1, &sum, b + c, act, outp, SUMSCALE, OUTSCALE, out_zp); outp++;TM_PERF_ADD(t_post);
                     if(dmul) sptr += maxk; //dwconv need move step
                 }
             }
@@ -200,6 +261,16 @@ tm_err_t TM_WEAK tml_conv2d_dwconv2d(tm_mat_t* in, tm_mat_t* out, wtype_t* w, bt
 }
 
 /*************************** TML_GAP **********************************/
+//requant of one channel sum over cnt pixels, shared by tml_gap and fused producers
+TM_INLINE mtype_t tml_gap_q(sumtype_t sum, int cnt, sctype_t in_s, zptype_t in_zp, sctype_t out_s, zptype_t out_zp)
+{
+#if TM_MDL_TYPE == TM_MDL_INT8 || TM_MDL_TYPE == TM_MDL_INT16
+    return (mtype_t)((sum/cnt-in_zp)*in_s/out_s + out_zp); //requant
+#else
+    return (mtype_t)(sum/cnt);
+#endif
+}
+
 tm_err_t TM_WEAK tml_gap(tm_mat_t* in, tm_mat_t* out, sctype_t in_s, zptype_t in_zp, sctype_t out_s, zptype_t out_zp)
 {   TM_DBGT_INIT();
     mtype_t* data;
@@ -212,17 +283,52 @@ tm_err_t TM_WEAK tml_gap(tm_mat_t* in, tm_mat_t* out, sctype_t in_s, zptype_t in
                 data += out->c;
             }
         }
-    #if TM_MDL_TYPE == TM_MDL_INT8 || TM_MDL_TYPE == TM_MDL_INT16
-        out->data[c] = (mtype_t)((sum/((in->h)*(in->w))-in_zp)*in_s/out_s + out_zp); //requant
-    #elif TM_MDL_TYPE == TM_MDL_FP32 || TM_MDL_TYPE == TM_MDL_FP16
-        out->data[c] = (mtype_t)(sum/((in->h)*(in->w)));
+    #if TM_MDL_TYPE == TM_MDL_INT8 || TM_MDL_TYPE == TM_MDL_INT16 || TM_MDL_TYPE == TM_MDL_FP32 || TM_MDL_TYPE == TM_MDL_FP16
+        out->data[c] = tml_gap_q(sum, (in->h)*(in->w), in_s, in_zp, out_s, out_zp);
     //#else //#elif TM_MDL_TYPE == TM_MDL_FP8_143 || TM_MDL_TYPE == TM_MDL_FP8_152
     #endif
     }
     return TM_OK;
 }
 
+//split gap for fused producers: accumulate channel sums of each produced part,
+//then requant once with the total pixel count
+void TM_WEAK tml_gap_sum(tm_mat_t* in, sumtype_t* sums)
+{
+    mtype_t* data = in->data;
+    for(int i=0; i < in->h*in->w; i++){
+        for(int c=0; c < in->c; c++)
+            sums[c] += ((sumtype_t)(data[c]));
+        data += in->c;
+    }
+}
+
+tm_err_t TM_WEAK tml_gap_post(sumtype_t* sums, int cnt, tm_mat_t* out, sctype_t in_s, zptype_t in_zp, sctype_t out_s, zptype_t out_zp)
+{
+    for(int c=0; c <out->c; c++){
+    #if TM_MDL_TYPE == TM_MDL_INT8 || TM_MDL_TYPE == TM_MDL_INT16 || TM_MDL_TYPE == TM_MDL_FP32 || TM_MDL_TYPE == TM_MDL_FP16
+        out->data[c] = tml_gap_q(sums[c], cnt, in_s, in_zp, out_s, out_zp);
+    #endif
+    }
+    return TM_OK;
+}
+
 /*************************** TML_FC **********************************/
+//bias and requant of n outputs
+TM_INLINE void tml_fc_post(int n, sumtype_t* sums, btype_t* b, mtype_t* outp, \
+    sctype_t* ws, sctype_t in_s, sctype_t out_s, zptype_t out_zp)
+{
+    for(int i=0; i<n; i++){
+        sumtype_t sum = sums[i] + b[i];     //fuse with zp
+    #if TM_MDL_TYPE == TM_MDL_INT8 || TM_MDL_TYPE == TM_MDL_INT16
+        outp[i] = (mtype_t)(sum*in_s*ws[0]/out_s + out_zp); //requant
+    #else
+        outp[i] = (mtype_t)(sum);
+    #endif
+    }
+    return;
+}
+
 tm_err_t TM_WEAK tml_fc(tm_mat_t* in, tm_mat_t* out,  wtype_t* w, btype_t* b, \
     sctype_t* ws, sctype_t in_s, zptype_t in_zp, sctype_t out_s, zptype_t out_zp)
 {   TM_DBGT_INIT();
@@ -230,19 +336,126 @@ tm_err_t TM_WEAK tml_fc(tm_mat_t* in, tm_mat_t* out,  wtype_t* w, btype_t* b, \
     for(int c=0; c <out->c; c++){
         sumtype_t sum = 0;
         tm_dot_prod(data, w+c*in->c, in->c, &sum);
-        sum += b[c];    //fuse with zp
-    #if TM_MDL_TYPE == TM_MDL_INT8 || TM_MDL_TYPE == TM_MDL_INT16
-        out->data[c] = (mtype_t)(sum*in_s*ws[0]/out_s + out_zp); //requant
-    #else
-        out->data[c] = (mtype_t)(sum);
-    #endif
+        tml_fc_post(1, &sum, b + c, out->data + c, ws, in_s, out_s, out_zp);
     }
     return TM_OK;
 }
 
+//4 outputs per pass over the input, weights in TML_FC_PACK4 layout
+tm_err_t TM_WEAK tml_fc_pack4(tm_mat_t* in, tm_mat_t* out,  wtype_t* w, btype_t* b, \
+    sctype_t* ws, sctype_t in_s, zptype_t in_zp, sctype_t out_s, zptype_t out_zp)
+{   TM_DBGT_INIT();
+#if (TM_MDL_TYPE == TM_MDL_FP8_143) || (TM_MDL_TYPE == TM_MDL_FP8_152)
+    return TM_ERR_UNSUPPORT;
+#else
+    mtype_t* data = in->data;
+    sumtype_t sums[4];
+    int c = 0;
+    for(; c+4 <= out->c; c+=4){
+        tm_dot_prod_il4(data, w, in->c, sums);
+        tml_fc_post(4, sums, b + c, out->data + c, ws, in_s, out_s, out_zp);
+        w += 4*in->c;
+    }
+    for(; c <out->c; c++){  //tail rows are row major
+        tm_dot_prod(data, w, in->c, sums);
+        tml_fc_post(1, sums, b + c, out->data + c, ws, in_s, out_s, out_zp);
+        w += in->c;
+    }
+    return TM_OK;
+#endif
+}
+
 /*************************** TML_SOFTMAX **********************************/
+#if (TM_MDL_TYPE == TM_MDL_INT8) && TM_SOFTMAX_LUT_CNT
+//int8 softmax: exp(-(max-q)*in_s) from 256 entries LUT (Q16), fixed point normalize
+typedef struct{
+    sctype_t in_s;
+    sctype_t out_s;
+    uint32_t ref;           //loaded softmax layers using this slot
+    uint32_t out_mul;       //(1/out_s) in Q8
+    uint16_t lut[256];      //lut[d] = exp(-d*in_s) in Q16
+}tml_softmax_lut_t;
+TM_STATIC tml_softmax_lut_t softmax_lut[TM_SOFTMAX_LUT_CNT];
+
+static tml_softmax_lut_t* tml_softmax_lut_find(sctype_t in_s, sctype_t out_s)
+{
+    for(int i=0; i<TM_SOFTMAX_LUT_CNT; i++){
+        if(softmax_lut[i].ref && softmax_lut[i].in_s == in_s && softmax_lut[i].out_s == out_s)
+            return &softmax_lut[i];
+    }
+    return NULL;
+}
+
+//exp(-x) for x>=0, load time only: halve until small, taylor, square back
+//(the fast tm_exp approximation is too coarse for the LUT)
+static float tml_exp_neg(float x)
+{
+    int k = 0;
+    while(x > 0.5f && k < 16) { x *= 0.5f; k++; }
+    float t = 1.f, e = 1.f;
+    for(int i=1; i<8; i++) { t *= -x/i; e += t; }
+    while(k--) e *= e;
+    return e;
+}
+
+tm_err_t TM_WEAK tml_softmax_lut_init(sctype_t in_s, sctype_t out_s)
+{
+    tml_softmax_lut_t* t = tml_softmax_lut_find(in_s, out_s);
+    if(t) { t->ref++; return TM_OK; }   //same scales share one LUT
+    for(int i=0; i<TM_SOFTMAX_LUT_CNT; i++){
+        if(softmax_lut[i].ref == 0) { t = &softmax_lut[i]; break; }
+    }
+    if(t == NULL || out_s <= 0) return TM_ERR_OOM;
+    float e1 = tml_exp_neg(in_s);
+    float v  = 65535.f;
+    for(int d=0; d<256; d++){
+        t->lut[d] = (uint16_t)(v + 0.5f);   //lut[0]=65535: sum>=lut[max], lut*inv never overflows
+        v *= e1;
+    }
+    t->out_mul  = (uint32_t)(256.f/out_s + 0.5f);
+    t->in_s     = in_s;
+    t->out_s    = out_s;
+    t->ref      = 1;
+    return TM_OK;
+}
+
+void TM_WEAK tml_softmax_lut_deinit(sctype_t in_s, sctype_t out_s)
+{
+    tml_softmax_lut_t* t = tml_softmax_lut_find(in_s, out_s);
+    if(t) t->ref--;
+    return;
+}
+
+static void tml_softmax_q8(tml_softmax_lut_t* t, tm_mat_t* in, tm_mat_t* out, zptype_t out_zp)
+{
+    mtype_t* din = in->data;
+    int maxq = -128;
+    for(int c=0; c <in->c; c++){
+        if(din[c] > maxq) maxq = din[c];
+    }
+    uint32_t sum = 0;
+    for(int c=0; c <in->c; c++){
+        sum += t->lut[maxq - din[c]];
+    }
+    uint32_t inv = 0xFFFFFFFFu/sum;     //Q32 reciprocal, lut*inv <= 2^32-1
+    for(int c=0; c <in->c; c++){
+        uint32_t p = t->lut[maxq - din[c]]*inv;     //probability in Q32
+        int32_t q = (int32_t)((((uint64_t)p)*t->out_mul + (1ULL<<39))>>40) + out_zp; //requant
+        out->data[c] = (mtype_t)(q > 127 ? 127 : (q < -128 ? -128 : q));
+    }
+    return;
+}
+#endif
+
 tm_err_t TM_WEAK tml_softmax(tm_mat_t* in, tm_mat_t* out, sctype_t in_s, zptype_t in_zp, sctype_t out_s, zptype_t out_zp)
 {   TM_DBGT_INIT(); //note we have float size output buf even in INT8/INT16 mode
+#if (TM_MDL_TYPE == TM_MDL_INT8) && TM_SOFTMAX_LUT_CNT
+    tml_softmax_lut_t* t = tml_softmax_lut_find(in_s, out_s);
+    if(t) {
+        tml_softmax_q8(t, in, out, out_zp);
+        return TM_OK;
+    }
+#endif
     mtype_t* din = in->data;
     float*  dout = (float*)(out->data);
     float   dmax =  -FLT_MAX;
@@ -274,23 +487,101 @@ tm_err_t TM_WEAK tml_softmax(tm_mat_t* in, tm_mat_t* out, sctype_t in_s, zptype_
 /*************************** TML_RESHAPE **********************************/
 tm_err_t TM_WEAK tml_reshape(tm_mat_t* in, tm_mat_t* out, sctype_t in_s, zptype_t in_zp, sctype_t out_s, zptype_t out_zp)
 {   
-    //in fact do nothing... out shape
+    //in fact do nothing... out shape, unless the output is another buffer
+    if(out->data != in->data)
+        memmove(out->data, in->data, out->h*out->w*out->c*sizeof(mtype_t));
     return TM_OK;
 }
 
+/*************************** TML_ADD **********************************/
+#if TM_MDL_TYPE == TM_MDL_INT8
+#if defined(__ARM_FEATURE_DSP) && __ARM_FEATURE_DSP
+#include <arm_acle.h>
+#define TML_ADD_SIMD (1)    //M33 DSP extension: 4 int8 lanes per word, SMLAD per lane pair
+#else
+#define TML_ADD_SIMD (0)
+#endif
+
+//fixed point add params, computed once per tml_add call
+typedef struct{
+    int32_t m0;             //0 <= m0,m1 < 2^15, the int16 halves SMLAD multiplies with
+    int32_t m1;
+    int32_t bias;           //rounding offset minus both input zero points
+    int32_t shift;
+    int32_t out_zp;
+    uint32_t m01;           //m1<<16 | m0
+}tml_addq_t;
+
+//out = ((d0*m0 + d1*m1 + bias) >> shift) + out_zp, saturated
+TM_INLINE mtype_t tml_add_q8(mtype_t a, mtype_t b, tml_addq_t* q)
+{
+    int32_t r = (((int32_t)a)*q->m0 + ((int32_t)b)*q->m1 + q->bias) >> q->shift;
+    r += q->out_zp;
+    return (mtype_t)(r > 127 ? 127 : (r < -128 ? -128 : r));
+}
+
+#if TML_ADD_SIMD
+//tml_add_q8 on 4 lanes: SXTB16 sign extends lanes 0,2 (1,3 after ROR 8) to int16 halves,
+//lane k of a and b are paired in one word so one SMLAD gives d0*m0 + d1*m1 + bias
+TM_INLINE uint32_t tml_add_q8x4(uint32_t a, uint32_t b, tml_addq_t* q)
+{
+    uint32_t a02 = __sxtb16(a), a13 = __sxtb16((a >> 8) | (a << 24));
+    uint32_t b02 = __sxtb16(b), b13 = __sxtb16((b >> 8) | (b << 24));
+    int32_t r0 = __smlad((a02 & 0xffffu) | (b02 << 16), q->m01, q->bias);
+    int32_t r1 = __smlad((a13 & 0xffffu) | (b13 << 16), q->m01, q->bias);
+    int32_t r2 = __smlad((a02 >> 16) | (b02 & 0xffff0000u), q->m01, q->bias);
+    int32_t r3 = __smlad((a13 >> 16) | (b13 & 0xffff0000u), q->m01, q->bias);
+    r0 = __ssat((r0 >> q->shift) + q->out_zp, 8);
+    r1 = __ssat((r1 >> q->shift) + q->out_zp, 8);
+    r2 = __ssat((r2 >> q->shift) + q->out_zp, 8);
+    r3 = __ssat((r3 >> q->shift) + q->out_zp, 8);
+    return (uint8_t)r0 | ((uint32_t)(uint8_t)r1 << 8) | ((uint32_t)(uint8_t)r2 << 16) | ((uint32_t)(uint8_t)r3 << 24);
+}
+#endif
+#endif
 
 tm_err_t TM_WEAK tml_add(tm_mat_t* in0, tm_mat_t* in1, tm_mat_t* out, \
     sctype_t in_s0, zptype_t in_zp0, sctype_t in_s1, zptype_t in_zp1, sctype_t out_s, zptype_t out_zp)
 {   //TODO: check in0 shape == in1 shape 
-    //It is simple and experimental implement for ADD, could be more way faster
+    //out may be in0 or in1 (in place), but must not partially overlap them
     mtype_t* d0 = in0->data;
     mtype_t* d1 = in1->data;
     mtype_t* res = out->data; 
     int size = in0->h*in0->w*in0->c;
     TM_PRINTF("s0=%.3f,zp0=%d; s1=%.3f,zp1=%d\r\n", in_s0, in_zp0, in_s1, in_zp1);
+    int i = 0;
+#if TM_MDL_TYPE == TM_MDL_INT8
+    //m<2^15 (int16 for SMLAD, same multipliers on every build): with |d|,|zp|<=128
+    //d*m and zp*m stay < 2^22, the rounding term < 2^30, no int32 overflow
+    float r0 = in_s0/out_s, r1 = in_s1/out_s;
+    int shift = tml_quant_shift(r0 > r1 ? r0 : r1, 15, 30);
+    if(shift > 0 && tml_quant_mult(r0 > r1 ? r0 : r1, shift) >= (1<<15)) shift--;   //rounded up to 2^15
+    if(shift >= 0) {
+        tml_addq_t q;
+        q.m0     = tml_quant_mult(r0, shift);
+        q.m1     = tml_quant_mult(r1, shift);
+        q.bias   = (shift ? (1L<<(shift-1)) : 0) - in_zp0*q.m0 - in_zp1*q.m1;
+        q.shift  = shift;
+        q.out_zp = out_zp;
+        q.m01    = ((uint32_t)q.m1 << 16) | (uint32_t)q.m0;
+#if TML_ADD_SIMD
+        for(; i+4<=size; i+=4){ //word loads through memcpy, each word read before written: in place is safe
+            uint32_t a, b, r;
+            memcpy(&a, d0+i, 4);
+            memcpy(&b, d1+i, 4);
+            r = tml_add_q8x4(a, b, &q);
+            memcpy(res+i, &r, 4);
+        }
+#endif
+        for(; i<size; i++){ //element i is read before written, so in place is safe
+            res[i] = tml_add_q8(d0[i], d1[i], &q);
+        }
+        return TM_OK;
+    }
+    //scale ratio out of fixed point range, fall back to float
+#endif
 #if TM_MDL_TYPE == TM_MDL_FP16 || TM_MDL_TYPE == TM_MDL_FP32 || TM_MDL_TYPE == TM_MDL_INT8
-    int i;
-    for(i=0; i+4<=size; ){
+    for(; i+4<=size; ){
         res[i] = TM_QUANT(TM_DEQUANT(d0[i],in_s0,in_zp0)+TM_DEQUANT(d1[i],in_s1,in_zp1), out_s, out_zp); i++;
         res[i] = TM_QUANT(TM_DEQUANT(d0[i],in_s0,in_zp0)+TM_DEQUANT(d1[i],in_s1,in_zp1), out_s, out_zp); i++;
         res[i] = TM_QUANT(TM_DEQUANT(d0[i],in_s0,in_zp0)+TM_DEQUANT(d1[i],in_s1,in_zp1), out_s, out_zp); i++;
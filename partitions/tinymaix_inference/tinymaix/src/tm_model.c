@@ -11,6 +11,122 @@ limitations under the License.
 ==============================================================================*/
 #include "tinymaix.h"
 
+#if TM_FC_PACK_AT_LOAD && (TM_MDL_TYPE != TM_MDL_FP8_143) && (TM_MDL_TYPE != TM_MDL_FP8_152)
+//interleave fc weights by 4 outputs in place, main buf (not used until tm_run) as temp
+//skip if already packed (by converter or previous load) or main buf too small
+static void tm_fc_pack4(tm_mdl_t* mdl, tml_fc_t* l)
+{
+    int in_c  = l->h.in_dims[3];
+    int out_c = l->h.out_dims[3];
+    wtype_t* w   = (wtype_t*)((uint8_t*)l + l->w_oft);
+    wtype_t* tmp = (wtype_t*)mdl->buf;
+    if(l->w_pack != 0 || 4*in_c*sizeof(wtype_t) > mdl->b->buf_size) return;
+    for(int c=0; c+4<=out_c; c+=4){
+        memcpy(tmp, w, 4*in_c*sizeof(wtype_t));
+        for(int k=0; k<in_c; k++){
+            for(int j=0; j<4; j++) w[4*k+j] = tmp[j*in_c+k];
+        }
+        w += 4*in_c;
+    }
+    l->w_pack = TML_FC_PACK4;
+    return;
+}
+#else
+    #undef  TM_FC_PACK_AT_LOAD
+    #define TM_FC_PACK_AT_LOAD (0)  //fp8 has no packed fc kernel
+#endif
+
+//check patch based stack: conv layers, each reads the previous one, only last one materialised
+static tm_err_t tm_patch_check(tm_mdlbin_t* b)
+{
+    uint8_t* body = b->layers_body;
+    if(b->patch_layers == 0) return TM_OK;
+    if(b->patch_layers > TM_PATCH_MAX_LAYERS || b->patch_layers > b->layer_cnt || b->patch_rows == 0)
+        return TM_ERR_UNSUPPORT;
+    for(int i=0; i<b->patch_layers; i++){
+        tml_conv2d_dw_t* l = (tml_conv2d_dw_t*)body;
+        if(l->h.type != TML_CONV2D && l->h.type != TML_DWCONV2D) return TM_ERR_UNSUPPORT;
+        if(l->h.is_out || l->dilation_h != 1) return TM_ERR_UNSUPPORT;
+        body += l->h.size;
+    }
+    return TM_OK;
+}
+
+#if TM_DELTA_RUN
+//check delta stack: chained conv layers from the input, outputs kept resident by the planner
+static tm_err_t tm_delta_check(tm_mdlbin_t* b)
+{
+    uint8_t* body = b->layers_body;
+    uint32_t oft = 0;   //input at 0 oft
+    if(b->delta_layers == 0) return TM_OK;
+    if(b->delta_layers > b->layer_cnt || b->patch_layers) return TM_ERR_UNSUPPORT;
+    for(int i=0; i<b->delta_layers; i++){
+        tml_conv2d_dw_t* l = (tml_conv2d_dw_t*)body;
+        if(l->h.type != TML_CONV2D && l->h.type != TML_DWCONV2D) return TM_ERR_UNSUPPORT;
+        if(l->h.is_out || l->dilation_h != 1 || l->h.in_oft != oft) return TM_ERR_UNSUPPORT;
+        if(l->h.in_dims[1] > TM_DELTA_MAX_ROWS || l->h.out_dims[1] > TM_DELTA_MAX_ROWS) return TM_ERR_UNSUPPORT;
+        oft = l->h.out_oft;
+        body += l->h.size;
+    }
+    return TM_OK;
+}
+#endif
+
+//a reshape keeps its element count: an aliasing one is skipped by tm_run and
+//the next layer reads the same buffer with its own in_dims, others are copied
+static tm_err_t tm_reshape_check(tm_mdlbin_t* b)
+{
+    uint8_t* body = b->layers_body;
+    for(int i=0; i<b->layer_cnt; i++){
+        tml_head_t* h = (tml_head_t*)body;
+        if(h->type == TML_RESHAPE) {
+            if(h->in_dims[1]*h->in_dims[2]*h->in_dims[3] != h->out_dims[1]*h->out_dims[2]*h->out_dims[3])
+                return TM_ERR_UNSUPPORT;
+        }
+        body += h->size;
+    }
+    return TM_OK;
+}
+
+#if TM_FUSE_LAYERS
+//tensor at oft is consumed by layer i+1 only: no later layer reads it before it is overwritten
+static int tm_fuse_private(uint8_t* body, int i, int cnt, uint32_t oft)
+{
+    for(int j=i+2; j<cnt; j++){
+        tml_head_t* h = (tml_head_t*)body;
+        if(h->in_oft == oft) return 0;
+        if(h->type == TML_ADD && ((tml_add_t*)h)->in_oft1 == oft) return 0;
+        if(h->out_oft == oft) return 1;
+        body += h->size;
+    }
+    return 1;
+}
+
+//find fusible pairs, bit i: layer i output fused into layer i+1
+//conv/dwconv+gap: conv run row by row into one row buf, gap accumulates the channel sums
+//gap+fc, fc+softmax: small producer output goes to tm_fuse_buf instead of main buf
+//callbacks still run for fused producers, their main buf output is not written
+static uint32_t tm_fuse_scan(tm_mdlbin_t* b)
+{
+    uint32_t fuse = 0;
+    uint8_t* body = b->layers_body;
+    for(int i=0; i+1<b->layer_cnt && i<32; i++){
+        tml_head_t* p = (tml_head_t*)body;
+        tml_head_t* c = (tml_head_t*)(body + p->size);
+        body += p->size;
+        int size = p->out_dims[1]*p->out_dims[2]*p->out_dims[3];
+        int ok = 0;
+        if(p->is_out || i < b->patch_layers || i < b->delta_layers || c->in_oft != p->out_oft) continue;
+        if((p->type == TML_CONV2D || p->type == TML_DWCONV2D) && c->type == TML_GAP)
+            ok = ((tml_conv2d_dw_t*)p)->dilation_h == 1 && p->out_dims[3] <= TM_MAX_CSIZE;
+        else if((p->type == TML_GAP && c->type == TML_FC) || (p->type == TML_FC && c->type == TML_SOFTMAX))
+            ok = size <= TM_MAX_CSIZE;
+        if(ok && tm_fuse_private(body + c->size, i, b->layer_cnt, p->out_oft)) fuse |= 1u<<i;
+    }
+    return fuse;
+}
+#endif
+
 //load model
 //mdl: model handle; bin: model bin buf; buf: main buf for middle output; cb: layer callback; 
 //in: return input mat, include buf addr; //you can ignore it if use static buf
@@ -19,6 +135,17 @@ tm_err_t TM_WEAK tm_load  (tm_mdl_t* mdl, const uint8_t* bin, uint8_t*buf, tm_cb
     tm_mdlbin_t* mdl_bin = (tm_mdlbin_t*)bin;
     if(mdl_bin->magic != TM_MDL_MAGIC)   return TM_ERR_MAGIC;   //FIXME: big-endian not compatible
     if(mdl_bin->mdl_type != TM_MDL_TYPE) return TM_ERR_MDLTYPE;
+    if(tm_patch_check(mdl_bin) != TM_OK) return TM_ERR_UNSUPPORT;
+    if(tm_reshape_check(mdl_bin) != TM_OK) return TM_ERR_UNSUPPORT;
+#if TM_DELTA_RUN
+    if(tm_delta_check(mdl_bin) != TM_OK) return TM_ERR_UNSUPPORT;
+#endif
+#if TM_FUSE_LAYERS
+    mdl->fuse       = tm_fuse_scan(mdl_bin);
+#else
+    mdl->fuse       = 0;
+#endif
+    if(mdl_bin->fuse_mask & ~mdl->fuse) return TM_ERR_UNSUPPORT;  //planned buffers only fit fused run
     mdl->b          = mdl_bin;
     mdl->cb         = (void*)cb;
     if(buf == NULL) {
@@ -35,6 +162,22 @@ tm_err_t TM_WEAK tm_load  (tm_mdl_t* mdl, const uint8_t* bin, uint8_t*buf, tm_cb
     } else mdl->subbuf = NULL;
     mdl->layer_i    = 0;
     mdl->layer_body = mdl->b->layers_body;
+    mdl->delta_ok   = 0;
+#if ((TM_MDL_TYPE == TM_MDL_INT8) && TM_SOFTMAX_LUT_CNT) || TM_FC_PACK_AT_LOAD
+    uint8_t* body = mdl->b->layers_body;
+    for(int i=0; i<mdl->b->layer_cnt; i++){
+        tml_head_t* h = (tml_head_t*)body;
+    #if (TM_MDL_TYPE == TM_MDL_INT8) && TM_SOFTMAX_LUT_CNT
+        if(h->type == TML_SOFTMAX && tml_softmax_lut_init(h->in_s, h->out_s) != TM_OK)  //gen softmax LUT
+            TM_LOAD_NOTE("tm_load: no free softmax LUT (TM_SOFTMAX_LUT_CNT %d), layer %d uses float softmax\n",
+                         TM_SOFTMAX_LUT_CNT, i);
+    #endif
+    #if TM_FC_PACK_AT_LOAD
+        if(h->type == TML_FC) tm_fc_pack4(mdl, (tml_fc_t*)h);
+    #endif
+        body += h->size;
+    }
+#endif
     memcpy((void*)in, (void*)mdl->b->in_dims, sizeof(tm_mat_t));
     in->data = (mtype_t*)mdl->buf; //input at 0 oft
     return TM_OK;
@@ -43,6 +186,15 @@ tm_err_t TM_WEAK tm_load  (tm_mdl_t* mdl, const uint8_t* bin, uint8_t*buf, tm_cb
 //remove model
 void TM_WEAK tm_unload(tm_mdl_t* mdl)
 {
+#if (TM_MDL_TYPE == TM_MDL_INT8) && TM_SOFTMAX_LUT_CNT
+    uint8_t* body = mdl->b->layers_body;
+    for(int i=0; i<mdl->b->layer_cnt; i++){
+        tml_head_t* h = (tml_head_t*)body;
+        if(h->type == TML_SOFTMAX) tml_softmax_lut_deinit(h->in_s, h->out_s);
+        body += h->size;
+    }
+#endif
+    if(mdl->subbuf) tm_free(mdl->subbuf);  //reverse order of tm_load
     if(mdl->main_alloc) tm_free(mdl->buf);
     return;
 }
@@ -82,62 +234,216 @@ tm_err_t TM_WEAK tm_preprocess(tm_mdl_t* mdl, tm_pp_t pp_type, tm_mat_t* in, tm_
 }
 
 
-//run model
-//mdl: model handle; in: input mat; out: output mat
-tm_err_t TM_WEAK tm_run(tm_mdl_t* mdl, tm_mat_t* in, tm_mat_t* out)
+//run conv layer l, pad_top overrides l->pad[0] for row bands
+static tm_err_t tm_run_conv(tml_conv2d_dw_t* l, tm_mat_t* _in, tm_mat_t* _out, int pad_top)
+{
+    return tml_conv2d_dwconv2d(_in, _out, (wtype_t*)((uint8_t*)l + l->w_oft), (btype_t*)((uint8_t*)l + l->b_oft), \
+        l->kernel_w, l->kernel_h, l->stride_w, l->stride_h, l->dilation_w, l->dilation_h, \
+        l->act, pad_top, l->pad[1], l->pad[2], l->pad[3], l->depth_mul, \
+        (sctype_t*)((uint8_t*)l + l->ws_oft), l->h.in_s, l->h.in_zp, l->h.out_s, l->h.out_zp);
+}
+
+//run one layer, _in/_out already point to the layer input/output
+static tm_err_t tm_run_layer(tm_mdl_t* mdl, tml_head_t* h, tm_mat_t* _in, tm_mat_t* _out)
 {
-    tm_mat_t _in, _in1, _out;
+    tm_mat_t _in1;
     tm_err_t res = TM_OK;
-    int out_idx = 0;
-    memcpy((void*)&_in, (void*)in, sizeof(tm_mat_t));       
+    switch(h->type){
+    case TML_CONV2D:
+    case TML_DWCONV2D:{
+        tml_conv2d_dw_t* l = (tml_conv2d_dw_t*)(mdl->layer_body);
+        res = tm_run_conv(l, _in, _out, l->pad[0]);
+        break;}
+    case TML_GAP: {
+        res = tml_gap(_in, _out, h->in_s, h->in_zp, h->out_s, h->out_zp);
+        break;}
+    case TML_FC: {
+        tml_fc_t* l = (tml_fc_t*)(mdl->layer_body);
+        if(l->w_pack == TML_FC_PACK4) res = tml_fc_pack4(_in, _out, (wtype_t*)(mdl->layer_body + l->w_oft), (btype_t*)(mdl->layer_body + l->b_oft), \
+            (sctype_t*)(mdl->layer_body + l->ws_oft), h->in_s, h->in_zp, h->out_s, h->out_zp);
+        else res = tml_fc(_in, _out, (wtype_t*)(mdl->layer_body + l->w_oft), (btype_t*)(mdl->layer_body + l->b_oft), \
+            (sctype_t*)(mdl->layer_body + l->ws_oft), h->in_s, h->in_zp, h->out_s, h->out_zp);
+        break;}
+    case TML_SOFTMAX: {
+        res = tml_softmax(_in, _out, h->in_s, h->in_zp, h->out_s, h->out_zp);
+        break; }
+    case TML_RESHAPE: {
+        res = tml_reshape(_in, _out, h->in_s, h->in_zp, h->out_s, h->out_zp);
+        break; }
+    case TML_ADD: {
+        tml_add_t* l = (tml_add_t*)(mdl->layer_body);
+        memcpy((void*)&_in1, (void*)(h->in_dims), sizeof(uint16_t)*4);
+        _in1.data = (mtype_t *)(mdl->buf + l->in_oft1);
+        res = tml_add(_in, &_in1, _out, h->in_s, h->in_zp, l->in_s1, l->in_zp1, h->out_s, h->out_zp);
+        break; }
+    default:
+        res = TM_ERR_LAYERTYPE;
+        break;
+    }
+    return res;
+}
+
+//index of max value, compared on quantized data (scale>0 keeps the order)
+static int tm_argmax(mtype_t* data, int size)
+{
+    int maxi = 0;
+    for(int i=1; i<size; i++){
+    #if (TM_MDL_TYPE == TM_MDL_FP8_143) || (TM_MDL_TYPE == TM_MDL_FP8_152)
+        if(tm_fp8to32(data[i]) > tm_fp8to32(data[maxi])) maxi = i;
+    #else
+        if(data[i] > data[maxi]) maxi = i;
+    #endif
+    }
+    return maxi;
+}
+
+//patch based run of the first b->patch_layers conv layers (MCUNetV2 style, row patches)
+//each patch is patch_rows output rows of the last stack layer, input rows of every layer
+//are derived backward (halo rows recomputed). layers before the last write only the patch
+//to their out_oft buf, the last layer writes its rows into its full output
+static tm_err_t tm_run_patch(tm_mdl_t* mdl, tm_mat_t* in)
+{
+    tm_mat_t _in, _out;
+    tm_err_t res = TM_OK;
+    int n = mdl->b->patch_layers;
+    tml_conv2d_dw_t* ls[TM_PATCH_MAX_LAYERS];
+    int ri0[TM_PATCH_MAX_LAYERS], ri1[TM_PATCH_MAX_LAYERS];   //input rows of patch
+    int ro0[TM_PATCH_MAX_LAYERS], ro1[TM_PATCH_MAX_LAYERS];   //output rows of patch
+    mdl->layer_body = mdl->b->layers_body;
+    for(int j=0; j<n; j++){
+        ls[j] = (tml_conv2d_dw_t*)(mdl->layer_body);
+        mdl->layer_body += ls[j]->h.size;
+    }
+    int oh = ls[n-1]->h.out_dims[1];
+    for(int r=0; r<oh; r+=mdl->b->patch_rows){
+        int a = r;
+        int b = r+mdl->b->patch_rows > oh ? oh : r+mdl->b->patch_rows;
+        for(int j=n-1; j>=0; j--){
+            tml_conv2d_dw_t* l = ls[j];
+            ro0[j] = a; ro1[j] = b;
+            a = a*l->stride_h - l->pad[0];
+            b = (b-1)*l->stride_h - l->pad[0] + l->kernel_h;
+            ri0[j] = a < 0 ? 0 : a;
+            ri1[j] = b > l->h.in_dims[1] ? l->h.in_dims[1] : b;
+            a = ri0[j]; b = ri1[j];
+        }
+        for(int j=0; j<n; j++){
+            tml_conv2d_dw_t* l = ls[j];
+            memcpy((void*)&_in, (void*)(l->h.in_dims), sizeof(uint16_t)*4);
+            memcpy((void*)&_out, (void*)(l->h.out_dims), sizeof(uint16_t)*4);
+            _in.h  = ri1[j]-ri0[j];
+            _out.h = ro1[j]-ro0[j];
+            _in.data  = (j==0) ? TM_MATP(in, ri0[j], 0, 0) : (mtype_t*)(mdl->buf + l->h.in_oft);
+            _out.data = (mtype_t*)(mdl->buf + l->h.out_oft);
+            if(j==n-1) _out.data += ro0[j]*_out.w*_out.c;
+            int pad_top = l->pad[0] - ro0[j]*l->stride_h;  //only first patch sees top padding
+            res = tm_run_conv(l, &_in, &_out, pad_top < 0 ? 0 : pad_top);
+            if(res != TM_OK) return res;
+        }
+    }
     mdl->layer_body = mdl->b->layers_body;
-    for(mdl->layer_i = 0; mdl->layer_i < mdl->b->layer_cnt; mdl->layer_i++){
+    //stack done, callbacks in layer order (non last stack layers only hold their last patch)
+    for(mdl->layer_i = 0; mdl->layer_i < n; mdl->layer_i++){
+        if(mdl->cb) ((tm_cb_t)mdl->cb)(mdl, (tml_head_t*)(mdl->layer_body));
+        mdl->layer_body += ((tml_head_t*)(mdl->layer_body))->size;
+    }
+    return TM_OK;
+}
+
+#if TM_FUSE_LAYERS
+TM_STATIC mtype_t tm_fuse_buf[2][TM_MAX_CSIZE];  //fused gap/fc outputs, ping-pong by layer index
+TM_STATIC sumtype_t tm_fuse_sums[TM_MAX_CSIZE];
+
+//fused conv+gap: conv output rows computed one at a time into the conv out_oft buf
+//(one row big), channel sums accumulated, gap requant at the end
+static tm_err_t tm_run_conv_gap(tm_mdl_t* mdl, tml_conv2d_dw_t* l, tm_mat_t* in, tml_head_t* g, tm_mat_t* out)
+{
+    tm_mat_t _in, _row;
+    tm_err_t res = TM_OK;
+    int oh = l->h.out_dims[1];
+    memcpy((void*)&_in, (void*)in, sizeof(tm_mat_t));
+    memcpy((void*)&_row, (void*)(l->h.out_dims), sizeof(uint16_t)*4);
+    _row.h    = 1;
+    _row.data = (mtype_t*)(mdl->buf + l->h.out_oft);
+    memset(tm_fuse_sums, 0, sizeof(sumtype_t)*_row.c);
+    for(int y=0; y<oh; y++){
+        int a = y*l->stride_h - l->pad[0];
+        int b = a + l->kernel_h;
+        int a0 = a < 0 ? 0 : a;
+        _in.h    = (b > in->h ? in->h : b) - a0;
+        _in.data = TM_MATP(in, a0, 0, 0);
+        res = tm_run_conv(l, &_in, &_row, a < 0 ? -a : 0);
+        if(res != TM_OK) return res;
+        tml_gap_sum(&_row, tm_fuse_sums);
+    }
+    return tml_gap_post(tm_fuse_sums, oh*_row.w, out, g->in_s, g->in_zp, g->out_s, g->out_zp);
+}
+#endif
+
+//run layers from mdl->layer_i/layer_body; cls!=NULL is argmax mode: stop at first
+//output layer, skip it if it is softmax (monotonic), return top-1 class without dequant
+//a layer callback returning TM_SUSPEND stops the run after that layer (before any output
+//layer, not inside a fused pair): layer_i/layer_body point at the next layer, return TM_SUSPEND
+//in==NULL: resumed run, the input of every remaining layer is in main buf
+static tm_err_t tm_run_from(tm_mdl_t* mdl, tm_mat_t* in, tm_mat_t* out, int* cls)
+{
+    tm_mat_t _in, _out;
+    tm_err_t res = TM_OK;
+    int out_idx = 0;
+#if TM_FUSE_LAYERS
+    tml_conv2d_dw_t* fconv = NULL;  //conv waiting for its fused gap
+    tm_mat_t fconv_in;
+#endif
+    if(in) memcpy((void*)&_in, (void*)in, sizeof(tm_mat_t));
+    for(; mdl->layer_i < mdl->b->layer_cnt; mdl->layer_i++){
         tml_head_t* h = (tml_head_t*)(mdl->layer_body);
+        if(TML_IS_NOOP(h)) {    //no dispatch, no callback
+            mdl->layer_body += (h->size);
+            continue;
+        }
         if(mdl->layer_i>0) {
             _in.data  = (mtype_t *)(mdl->buf + h->in_oft);
             memcpy((void*)&_in, (void*)(h->in_dims), sizeof(uint16_t)*4);
         }
         _out.data = (mtype_t *)(mdl->buf + h->out_oft);
         memcpy((void*)&_out, (void*)(h->out_dims), sizeof(uint16_t)*4);
-        switch(h->type){
-        case TML_CONV2D: 
-        case TML_DWCONV2D:{ 
-            tml_conv2d_dw_t* l = (tml_conv2d_dw_t*)(mdl->layer_body);
-            res = tml_conv2d_dwconv2d(&_in, &_out, (wtype_t*)(mdl->layer_body + l->w_oft), (btype_t*)(mdl->layer_body + l->b_oft), \
-                l->kernel_w, l->kernel_h, l->stride_w, l->stride_h, l->dilation_w, l->dilation_h, \
-                l->act, l->pad[0], l->pad[1], l->pad[2], l->pad[3], l->depth_mul, \
-                (sctype_t*)(mdl->layer_body + l->ws_oft), h->in_s, h->in_zp, h->out_s, h->out_zp); 
-            break;}
-        case TML_GAP: {
-            tml_gap_t* l = (tml_gap_t*)(mdl->layer_body);
-            res = tml_gap(&_in, &_out, h->in_s, h->in_zp, h->out_s, h->out_zp);
-            break;}
-        case TML_FC: {
-            tml_fc_t* l = (tml_fc_t*)(mdl->layer_body);
-            res = tml_fc(&_in, &_out, (wtype_t*)(mdl->layer_body + l->w_oft), (btype_t*)(mdl->layer_body + l->b_oft), \
-                (sctype_t*)(mdl->layer_body + l->ws_oft), h->in_s, h->in_zp, h->out_s, h->out_zp);
-            break;}
-        case TML_SOFTMAX: {
-            tml_softmax_t* l = (tml_softmax_t*)(mdl->layer_body);
-            res = tml_softmax(&_in, &_out, h->in_s, h->in_zp, h->out_s, h->out_zp);
-            break; }
-        case TML_RESHAPE: {
-            tml_reshape_t* l = (tml_reshape_t*)(mdl->layer_body);
-            res = tml_reshape(&_in, &_out, h->in_s, h->in_zp, h->out_s, h->out_zp);
-            break; }
-        case TML_ADD: {
-            tml_add_t* l = (tml_add_t*)(mdl->layer_body);
-            memcpy((void*)&_in1, (void*)(h->in_dims), sizeof(uint16_t)*4);
-            _in1.data = (mtype_t *)(mdl->buf + l->in_oft1);
-            res = tml_add(&_in, &_in1, &_out, h->in_s, h->in_zp, l->in_s1, l->in_zp1, h->out_s, h->out_zp);
-            break; }
-        default:
-            res = TM_ERR_LAYERTYPE;
-            break;
+    #if TM_FUSE_LAYERS
+        int fi = mdl->layer_i;
+        if(fi > 0 && fi <= 32 && (mdl->fuse & (1u<<(fi-1))) && fconv == NULL)
+            _in.data = tm_fuse_buf[(fi-1)&1];
+        if(fi < 32 && (mdl->fuse & (1u<<fi))) {
+            if(h->type == TML_CONV2D || h->type == TML_DWCONV2D) {  //run later with the gap
+                fconv = (tml_conv2d_dw_t*)h;
+                memcpy((void*)&fconv_in, (void*)&_in, sizeof(tm_mat_t));
+                if(mdl->cb) ((tm_cb_t)mdl->cb)(mdl, h);    //output not materialised
+                mdl->layer_body += (h->size);
+                continue;
+            }
+            _out.data = tm_fuse_buf[fi&1];
         }
+    #endif
+        if(cls && h->is_out && h->type == TML_SOFTMAX) {
+            *cls = tm_argmax(_in.data, _in.h*_in.w*_in.c);
+            return TM_OK;
+        }
+    #if TM_FUSE_LAYERS
+        if(fconv) {
+            res = tm_run_conv_gap(mdl, fconv, &fconv_in, h, &_out);
+            fconv = NULL;
+        } else
+    #endif
+        res = tm_run_layer(mdl, h, &_in, &_out);
         if(res != TM_OK) return res;
-        if(mdl->cb) ((tm_cb_t)mdl->cb)(mdl, h);    //layer callback
+        if(mdl->cb && ((tm_cb_t)mdl->cb)(mdl, h) == TM_SUSPEND && !h->is_out && out_idx == 0) {  //layer callback
+            mdl->layer_i++;
+            mdl->layer_body += (h->size);
+            return TM_SUSPEND;
+        }
         if(h->is_out) {
+            if(cls) {
+                *cls = tm_argmax(_out.data, _out.h*_out.w*_out.c);
+                return TM_OK;
+            }
             memcpy((void*)(&out[out_idx]), (void*)(&(h->out_dims)), sizeof(uint16_t)*4);
             if(mdl->b->out_deq == 0 || TM_MDL_TYPE == TM_MDL_FP32) //fp32 do not need deq
                 out[out_idx].data = (mtype_t*)(TML_GET_OUTPUT(mdl, h));
@@ -152,7 +458,141 @@ tm_err_t TM_WEAK tm_run(tm_mdl_t* mdl, tm_mat_t* in, tm_mat_t* out)
         }
         mdl->layer_body += (h->size);
     }
-    return TM_OK;
+    return cls ? TM_ERR : TM_OK;    //argmax mode: no output layer found
 }
 
+//run all layers
+static tm_err_t tm_run_layers(tm_mdl_t* mdl, tm_mat_t* in, tm_mat_t* out, int* cls)
+{
+    mdl->delta_ok = 0;  //resident delta stack only valid after tm_run_delta
+    if(mdl->b->patch_layers) {  //first layers patch by patch, continue after the stack
+        tm_err_t res = tm_run_patch(mdl, in);
+        if(res != TM_OK) return res;
+    } else {
+        mdl->layer_body = mdl->b->layers_body;
+        mdl->layer_i    = 0;
+    }
+    return tm_run_from(mdl, in, out, cls);
+}
 
+//run model
+//mdl: model handle; in: input mat; out: output mat
+tm_err_t TM_WEAK tm_run(tm_mdl_t* mdl, tm_mat_t* in, tm_mat_t* out)
+{
+    return tm_run_layers(mdl, in, out, NULL);
+}
+
+//run model, only get top-1 class of first output: no trailing softmax, no dequant
+//mdl: model handle; in: input mat; cls: return class index
+tm_err_t TM_WEAK tm_run_argmax(tm_mdl_t* mdl, tm_mat_t* in, int* cls)
+{
+    if(cls == NULL) return TM_ERR;
+    return tm_run_layers(mdl, in, NULL, cls);
+}
+
+//continue a run its layer callback suspended (TM_SUSPEND), from mdl->layer_i/layer_body
+//main buf, sub buf and fused outputs must be untouched since: no other run of any model
+//mdl: model handle; out/cls: as the suspended tm_run/tm_run_argmax (cls!=NULL: argmax)
+tm_err_t TM_WEAK tm_run_resume(tm_mdl_t* mdl, tm_mat_t* out, int* cls)
+{
+    if(mdl->layer_i == 0 || mdl->layer_i >= mdl->b->layer_cnt) return TM_ERR;
+    return tm_run_from(mdl, NULL, out, cls);
+}
+
+#if TM_DELTA_RUN
+TM_STATIC uint8_t tm_delta_rows[2][TM_DELTA_MAX_ROWS];  //dirty rows of layer input/output
+
+//recompute dirty output rows of delta stack layer l, din: dirty input rows, dout: return dirty output rows
+//output row y reads input rows [y*stride-pad, y*stride-pad+kernel), runs of dirty rows run as one band
+static tm_err_t tm_delta_layer(tm_mdl_t* mdl, tml_conv2d_dw_t* l, uint8_t* din, uint8_t* dout)
+{
+    tm_mat_t in, _in, _out;
+    tm_err_t res = TM_OK;
+    int ih = l->h.in_dims[1];
+    int oh = l->h.out_dims[1];
+    for(int y=0; y<oh; y++){
+        int a = y*l->stride_h - l->pad[0];
+        dout[y] = 0;
+        for(int r=(a<0?0:a); r<a+l->kernel_h && r<ih; r++) dout[y] |= din[r];
+    }
+    memcpy((void*)&in, (void*)(l->h.in_dims), sizeof(uint16_t)*4);
+    memcpy((void*)&_out, (void*)(l->h.out_dims), sizeof(uint16_t)*4);
+    in.data = (mtype_t*)(mdl->buf + l->h.in_oft);
+    memcpy((void*)&_in, (void*)&in, sizeof(tm_mat_t));
+    for(int y0=0; y0<oh; ){
+        if(!dout[y0]) { y0++; continue; }
+        int y1 = y0;
+        while(y1<oh && dout[y1]) y1++;
+        int a = y0*l->stride_h - l->pad[0];
+        int b = (y1-1)*l->stride_h - l->pad[0] + l->kernel_h;
+        int a0 = a < 0 ? 0 : a;
+        _in.h    = (b > ih ? ih : b) - a0;
+        _in.data = TM_MATP(&in, a0, 0, 0);
+        _out.h    = y1-y0;
+        _out.data = (mtype_t*)(mdl->buf + l->h.out_oft) + y0*_out.w*_out.c;
+        res = tm_run_conv(l, &_in, &_out, a < 0 ? -a : 0);
+        if(res != TM_OK) return res;
+        y0 = y1;
+    }
+    return TM_OK;
+}
+
+//run model on a new frame of a stream, model planned with delta_layers (tm_mdlbin_t)
+//the previous frame and the delta stack outputs stay in main buf; input row tiles that
+//differ by more than d->tol are copied in, only rows they reach are recomputed through
+//the stack, the rest of the model runs as usual. first frame, in at main buf or more
+//than d->max_pct percent of changed tiles: full run
+//mdl: model handle; in: new frame (not main buf); out/cls: as tm_run/tm_run_argmax (cls!=NULL: argmax)
+tm_err_t TM_WEAK tm_run_delta(tm_mdl_t* mdl, tm_mat_t* in, tm_mat_t* out, int* cls, tm_delta_t* d)
+{
+    tm_err_t res = TM_OK;
+    mtype_t* prev = (mtype_t*)mdl->buf;
+    int n = mdl->b->delta_layers;
+    int ih = in->h;
+    int row = in->w*in->c;
+    uint8_t* din = tm_delta_rows[0];
+    if(d == NULL || n == 0) return TM_ERR;
+    d->tiles   = (ih + TM_DELTA_TILE_ROWS - 1)/TM_DELTA_TILE_ROWS;
+    d->changed = 0;
+    d->full    = in->data == prev || !mdl->delta_ok;
+    if(d->full) {
+        d->changed = d->tiles;
+    } else {
+        for(int t=0; t<d->tiles; t++){
+            int r0 = t*TM_DELTA_TILE_ROWS;
+            int r1 = r0+TM_DELTA_TILE_ROWS > ih ? ih : r0+TM_DELTA_TILE_ROWS;
+            int dirty = 0;
+            for(int i=r0*row; i<r1*row && !dirty; i++){
+                int diff = (int)in->data[i] - (int)prev[i];
+                dirty = diff > d->tol || diff < -(int)d->tol;
+            }
+            memset(din+r0, dirty, r1-r0);
+            d->changed += dirty;
+        }
+    }
+    if(d->full || d->changed*100 > d->max_pct*d->tiles) {   //full run on the frame copied to main buf
+        tm_mat_t _in;
+        memcpy((void*)&_in, (void*)in, sizeof(tm_mat_t));
+        _in.data = prev;
+        if(in->data != prev) memcpy(prev, in->data, ih*row*sizeof(mtype_t));
+        d->full = 1;
+        res = tm_run_layers(mdl, &_in, out, cls);
+        mdl->delta_ok = (res == TM_OK);
+        return res;
+    }
+    for(int r=0; r<ih; r++){
+        if(din[r]) memcpy(prev + r*row, in->data + r*row, row*sizeof(mtype_t));
+    }
+    mdl->delta_ok   = 0;    //stack inconsistent until the rows are recomputed
+    mdl->layer_body = mdl->b->layers_body;
+    for(mdl->layer_i = 0; mdl->layer_i < n; mdl->layer_i++){
+        tml_conv2d_dw_t* l = (tml_conv2d_dw_t*)(mdl->layer_body);
+        res = tm_delta_layer(mdl, l, tm_delta_rows[mdl->layer_i&1], tm_delta_rows[(mdl->layer_i+1)&1]);
+        if(res != TM_OK) return res;
+        if(mdl->cb) ((tm_cb_t)mdl->cb)(mdl, (tml_head_t*)l);
+        mdl->layer_body += l->h.size;
+    }
+    mdl->delta_ok = 1;
+    return tm_run_from(mdl, in, out, cls);
+}
+#endif
@@ -7,7 +7,11 @@
 
 #include "psa/service.h"
 #include "psa/crypto.h"
+#ifdef TM_SFN
+#include "psa_manifest/tinymaix_inference_sfn_manifest.h"
+#else
 #include "psa_manifest/tinymaix_inference_manifest.h"
+#endif
 #include "tfm_log_unpriv.h"
 #include <string.h>
 #include <stdint.h>
@@ -15,7 +19,17 @@
 #include "tm_port.h"
 #include "tinymaix.h"
 #include "tfm_builtin_key_ids.h"
+#include "tfm_tinymaix_inference_defs.h"
 #include "../../models/encrypted_mnist_model_psa.h"  /* Changed to match PSA encrypted model header */
+#include "tm_arena.h"
+#include "tm_log.h"
+#include "tm_tick.h"
+#ifdef TM_AOT
+#include "tinymaix_model_aot.h"  /* Generated by tools/tinymaix_aot.py */
+#endif
+#ifdef TM_PROFILE
+#include "tm_prof.h"
+#endif
 
 /* Maximum model size */
 #define TFM_TINYMAIX_MAX_MODEL_SIZE 4096
@@ -27,6 +41,10 @@
 #ifdef DEV_MODE
 #define TINYMAIX_IPC_GET_MODEL_KEY       (0x1004U)  /* Get HUK-derived model key for debugging */
 #endif
+#define TINYMAIX_IPC_GET_PROFILE         (0x1005U)  /* Cycle profile of the last inference */
+#define TINYMAIX_IPC_GET_QUEUE_STATS     (0x1006U)  /* Request queue counters */
+#define TINYMAIX_IPC_RESUME_INFERENCE    (0x1007U)  /* Continue a run suspended by its time budget */
+#define TINYMAIX_IPC_GET_STATS           (0x1008U)  /* Service counters and tick histograms */
 
 /* Encrypted TinyMAIX model header structure for CBC */
 typedef struct {
@@ -39,23 +57,102 @@ typedef struct {
 #define ENCRYPTED_HEADER_MAGIC 0x58414D54  // "TMAX" in little endian
 #define ENCRYPTED_HEADER_CBC_SIZE 28       // 4+4+4+16
 
+/* A loaded model: TinyMaix handle plus the decrypted bin it points into */
+typedef struct {
+    tm_mdl_t mdl;
+    tm_mat_t in;
+    tm_mat_t outs[1];
+    tm_mat_t frame;              /* stream frame staging, models planned with --delta only */
+    int loaded;
+    uint32_t gen;                /* load number since boot, 0 while empty */
+    uint32_t bank;               /* arena bank of the main/sub buffers */
+    float out_s;                 /* first output's scale and zero point, for models without out_deq */
+    int32_t out_zp;
+    size_t bin_size;
+    uint8_t bin[TFM_TINYMAIX_MAX_MODEL_SIZE] __attribute__((aligned(8)));
+} tinymaix_slot_t;
+
+#ifdef TM_AB_SLOTS
+/* A/B slots: one spare storage beyond the service slots, every load goes there and is swapped in */
+#define TINYMAIX_SLOT_STORE_CNT     (TINYMAIX_SLOT_CNT + 1)
+#else
+#define TINYMAIX_SLOT_STORE_CNT     (TINYMAIX_SLOT_CNT)
+#endif
+
 /* Global TinyMaix objects */
-static tm_mdl_t g_mdl;
+static tinymaix_slot_t g_slots[TINYMAIX_SLOT_STORE_CNT];
+static tinymaix_slot_t* g_active[TINYMAIX_SLOT_CNT];  /* TINYMAIX_SLOT_MAIN, TINYMAIX_SLOT_GATE */
+#ifdef TM_AB_SLOTS
+static tinymaix_slot_t* g_spare;    /* inactive storage the next load is decrypted into */
+#endif
+static uint32_t g_load_gen = 0;     /* successful loads since boot */
 static tm_mat_t g_in_uint8;
-static tm_mat_t g_in;
-static tm_mat_t g_outs[1];
-static int g_model_loaded = 0;
-#define MDL_BUF_LEN (1464)
-#define LBUF_LEN (1424)
-static uint8_t static_main_buf[MDL_BUF_LEN];
-static uint8_t static_sub_buf[512];
-
-/* Shared buffer for model processing */
-static uint8_t shared_model_buffer[TFM_TINYMAIX_MAX_MODEL_SIZE];
+#ifdef TM_PROFILE
+static int g_prof_ready = 0;    /* cycle counter available */
+#endif
+/* Service timestamps (preload, queue waits, stats, budgets): TIMER0 ticks, 0 Hz if it does not run */
+static uint32_t g_tick_hz = 0;
+#define SERVICE_TICKS()     tm_tick_read()
+#define SERVICE_TICK_HZ     (g_tick_hz)
+#ifdef TM_PRELOAD
+static uint32_t g_preload_gen = 0;  /* gen of the builtin model loaded at init */
+#endif
+#ifdef TM_QUEUE
+#ifndef TM_QUEUE_DEPTH
+#define TM_QUEUE_DEPTH      (8)
+#endif
+#ifndef TM_QUEUE_BATCH
+#define TM_QUEUE_BATCH      (4)
+#endif
+/* Run flags that pick the models a request runs on, a batch shares them */
+#define QUEUE_MODE_FLAGS    (TINYMAIX_RUN_FLAG_CASCADE | TINYMAIX_RUN_FLAG_STREAM)
+
+/* A RUN message taken from the SPM and held, unreplied, until its batch runs */
+typedef struct {
+    psa_msg_t msg;
+    tfm_tinymaix_run_params_t params;
+    uint32_t arrival;            /* SERVICE_TICKS() when taken */
+    uint32_t served;             /* g_queue_served when taken */
+} tinymaix_queued_run_t;
+
+static tinymaix_queued_run_t g_queue[TM_QUEUE_DEPTH];  /* arrival order */
+static uint32_t g_queue_cnt = 0;
+static uint32_t g_queue_served = 0;     /* runs served from the queue since boot */
+static tfm_tinymaix_queue_stats_t g_queue_stats;
+/* Serve order of the priority classes, index TINYMAIX_PRIO_* */
+static const uint8_t g_prio_rank[TINYMAIX_PRIO_CNT] = { 1, 0, 2 };
+#endif
+
+/* A main model run its time budget suspended after a layer, continued by TINYMAIX_IPC_RESUME_INFERENCE */
+typedef struct {
+    uint32_t token;              /* 0: none */
+    tinymaix_slot_t* slot;
+    uint32_t flags;              /* TINYMAIX_RUN_FLAG_* of the request */
+} tinymaix_suspended_t;
+
+static tinymaix_suspended_t g_suspended;
+static uint32_t g_resume_seq = 0;
+static uint32_t g_budget = 0;       /* ticks of the running part of a budgeted run, 0: no limit */
+static uint32_t g_budget_t0;        /* SERVICE_TICKS() when that part started */
+
+#if (TM_LOG_SAMPLE > 0) && (TM_LOG_LEVEL_RUN >= TM_LOG_INFO)
+/* Sampled request logging: the RUN INFO/DEBUG lines of every TM_LOG_SAMPLE-th request */
+uint8_t g_tm_log_on = 1;
+static uint32_t g_log_seq = 0;
+
+void tm_log_sample(void)
+{
+    g_tm_log_on = (g_log_seq++ % TM_LOG_SAMPLE) == 0;
+}
+#endif
 
-/* Global decrypted model buffer */
-static uint8_t g_decrypted_model[TFM_TINYMAIX_MAX_MODEL_SIZE];
-static size_t g_decrypted_size = 0;
+/* Service counters and tick histograms, always kept, read by TINYMAIX_IPC_GET_STATS */
+static tfm_tinymaix_stats_t g_stats;
+static int g_stats_cause = -1;      /* TINYMAIX_STATS_ERR_* set where the request failed, -1: from its status */
+/* Main/sub buffers are allocated per model by tm_load from the static arena (tm_arena.c) */
+
+/* Shared buffer for model processing (client supplied encrypted models) */
+static uint8_t shared_model_buffer[TFM_TINYMAIX_MAX_MODEL_SIZE];
 
 /* AES-128 encryption key (16 bytes) - PSA crypto test key */
 #define DERIVED_KEY_LEN 16    // 128-bit
@@ -102,7 +199,7 @@ static psa_status_t derive_key_from_huk(const char *label, uint8_t *derived, siz
     /* Setup HKDF with SHA-256 as specified in TF-M builtin key design */
     status = psa_key_derivation_setup(&op, PSA_ALG_HKDF(PSA_ALG_SHA_256));
     if (status != PSA_SUCCESS) {
-        INFO_UNPRIV("ERROR: psa_key_derivation_setup failed: %d\n", (int)status);
+        LOG_LOAD_ERR("ERROR: psa_key_derivation_setup failed: %d\n", (int)status);
         return status;
     }
     
@@ -110,7 +207,7 @@ static psa_status_t derive_key_from_huk(const char *label, uint8_t *derived, siz
     status = psa_key_derivation_input_bytes(&op, PSA_KEY_DERIVATION_INPUT_SALT,
                                             NULL, 0);
     if (status != PSA_SUCCESS) {
-        INFO_UNPRIV("ERROR: psa_key_derivation_input_salt failed: %d\n", (int)status);
+        LOG_LOAD_ERR("ERROR: psa_key_derivation_input_salt failed: %d\n", (int)status);
         psa_key_derivation_abort(&op);
         return status;
     }
@@ -119,7 +216,7 @@ static psa_status_t derive_key_from_huk(const char *label, uint8_t *derived, siz
     status = psa_key_derivation_input_key(&op, PSA_KEY_DERIVATION_INPUT_SECRET,
                                           TFM_BUILTIN_KEY_ID_HUK);
     if (status != PSA_SUCCESS) {
-        INFO_UNPRIV("ERROR: psa_key_derivation_input_key failed: %d\n", (int)status);
+        LOG_LOAD_ERR("ERROR: psa_key_derivation_input_key failed: %d\n", (int)status);
         psa_key_derivation_abort(&op);
         return status;
     }
@@ -128,7 +225,7 @@ static psa_status_t derive_key_from_huk(const char *label, uint8_t *derived, siz
     status = psa_key_derivation_input_bytes(&op, PSA_KEY_DERIVATION_INPUT_INFO,
                                             (const uint8_t*)label, strlen(label));
     if (status != PSA_SUCCESS) {
-        INFO_UNPRIV("ERROR: psa_key_derivation_input_bytes failed: %d\n", (int)status);
+        LOG_LOAD_ERR("ERROR: psa_key_derivation_input_bytes failed: %d\n", (int)status);
         psa_key_derivation_abort(&op);
         return status;
     }
@@ -136,7 +233,7 @@ static psa_status_t derive_key_from_huk(const char *label, uint8_t *derived, siz
     /* Derive the output key material */
     status = psa_key_derivation_output_bytes(&op, derived, derived_len);
     if (status != PSA_SUCCESS) {
-        INFO_UNPRIV("ERROR: psa_key_derivation_output_bytes failed: %d\n", (int)status);
+        LOG_LOAD_ERR("ERROR: psa_key_derivation_output_bytes failed: %d\n", (int)status);
         psa_key_derivation_abort(&op);
         return status;
     }
@@ -146,61 +243,383 @@ static psa_status_t derive_key_from_huk(const char *label, uint8_t *derived, siz
     return PSA_SUCCESS;
 }
 
+/* Book the ticks since t0 in a log2 histogram bin, only with a tick source */
+static void stats_time(uint32_t hist, uint32_t t0)
+{
+    uint32_t ticks, bin = 0;
+
+    if (SERVICE_TICK_HZ == 0) {
+        return;
+    }
+    for (ticks = SERVICE_TICKS() - t0; ticks != 0 && bin < TINYMAIX_STATS_HIST_BINS - 1; ticks >>= 1) {
+        bin++;
+    }
+    g_stats.hist[hist][bin]++;
+}
+
+/* Count a handled request of a message type taken at t0: outcome, error cause and end to end ticks */
+static void stats_request(uint32_t type, psa_status_t status, uint32_t t0)
+{
+    int cause = g_stats_cause;
+    int run = (type == TINYMAIX_IPC_RUN_INFERENCE || type == TINYMAIX_IPC_RESUME_INFERENCE);
+
+    g_stats_cause = -1;
+    g_stats.requests++;
+    if (status == PSA_SUCCESS || status == PSA_OPERATION_INCOMPLETE) {
+        if (run) {
+            g_stats.inferences += (status == PSA_SUCCESS);
+            stats_time(TINYMAIX_STATS_HIST_REQUEST, t0);
+        }
+        return;
+    }
+    if (cause < 0) {
+        switch (status) {
+            case PSA_ERROR_INVALID_ARGUMENT:
+            case PSA_ERROR_BUFFER_TOO_SMALL:
+            case PSA_ERROR_INSUFFICIENT_MEMORY:
+            case PSA_ERROR_COMMUNICATION_FAILURE:
+                cause = TINYMAIX_STATS_ERR_PARAM;
+                break;
+            case PSA_ERROR_BAD_STATE:
+                cause = TINYMAIX_STATS_ERR_STATE;
+                break;
+            case PSA_ERROR_NOT_SUPPORTED:
+                cause = TINYMAIX_STATS_ERR_UNSUPPORTED;
+                break;
+            default:
+                cause = run ? TINYMAIX_STATS_ERR_INFERENCE : TINYMAIX_STATS_ERR_OTHER;
+                break;
+        }
+    }
+    g_stats.errors[cause]++;
+}
+
 /* Layer callback function */
 static tm_err_t layer_cb(tm_mdl_t* mdl, tml_head_t* lh)
 {
+#ifdef TM_PROFILE
+    tm_prof_layer(mdl->layer_i, lh->type);
+#endif
+    /* Budget used up: yield after this layer */
+    if (g_budget && SERVICE_TICKS() - g_budget_t0 >= g_budget) {
+        return TM_SUSPEND;
+    }
     return TM_OK;
 }
 
-/* Parse output function */
-static int parse_output(tm_mat_t* outs)
+/* Scale and zero point of a loaded model's first output */
+static void slot_output_quant(tinymaix_slot_t* slot)
+{
+    uint8_t* body = slot->mdl.b->layers_body;
+
+    for (int i = 0; i < slot->mdl.b->layer_cnt; i++) {
+        tml_head_t* h = (tml_head_t*)body;
+        if (h->is_out) {
+            slot->out_s = h->out_s;
+            slot->out_zp = h->out_zp;
+            return;
+        }
+        body += h->size;
+    }
+}
+
+/* Parse output function: top-1 class, its probability in conf (may be NULL).
+ * A model without out_deq leaves its output quantised, it is dequantised here */
+static int parse_output(tinymaix_slot_t* slot, float* conf)
 {
-    tm_mat_t out = outs[0];
-    float* data = out.dataf;
+    tm_mat_t* out = &slot->outs[0];
+    int deq = slot->mdl.b->out_deq;
     float maxp = 0;
     int maxi = -1;
     
-    for(int i = 0; i < 10; i++){
-        if(data[i] > maxp) {
+    for(int i = 0; i < out->h * out->w * out->c; i++){
+        float p = deq ? out->dataf[i] : (float)TM_DEQUANT(out->data[i], slot->out_s, slot->out_zp);
+        if(p > maxp) {
             maxi = i;
-            maxp = data[i];
+            maxp = p;
         }
     }
+    if (conf) {
+        *conf = maxp;
+    }
     return maxi;
 }
 
-static psa_status_t decrypt_model(const uint8_t* encrypted_data, size_t encrypted_size)
+#if TM_DELTA_RUN
+/* Stream frame: only the rows changed since the previous frame go through the delta stack */
+static tm_err_t run_stream(tinymaix_slot_t* slot, uint32_t flags, tm_delta_t* d, int* result, float* conf)
+{
+    tm_err_t tm_res;
+
+    if (flags & TINYMAIX_RUN_FLAG_ARGMAX_ONLY) {
+        return tm_run_delta(&slot->mdl, &slot->frame, NULL, result, d);
+    }
+    tm_res = tm_run_delta(&slot->mdl, &slot->frame, slot->outs, NULL, d);
+    if (tm_res == TM_OK) {
+        *result = parse_output(slot, conf);
+    }
+    return tm_res;
+}
+#endif
+
+/* Run a loaded model on its input and get the predicted class (and confidence) */
+static tm_err_t run_model(tinymaix_slot_t* slot, uint32_t flags, tm_delta_t* d, int* result, float* conf)
+{
+    uint32_t t0 = SERVICE_TICKS();
+    tm_err_t tm_res;
+#ifdef TM_AOT
+    /* AOT code is generated for the main model, other slots and budgeted runs are interpreted */
+    int aot = (slot == g_active[TINYMAIX_SLOT_MAIN]) && !g_budget;
+#endif
+
+#ifdef TM_PROFILE
+    tm_prof_run_begin(slot->mdl.b->layer_cnt);
+#endif
+#if TM_DELTA_RUN
+    if (flags & TINYMAIX_RUN_FLAG_STREAM) {
+        /* Interpreted: the AOT code has no delta stack */
+        tm_res = run_stream(slot, flags, d, result, conf);
+    } else
+#endif
+    if (flags & TINYMAIX_RUN_FLAG_ARGMAX_ONLY) {
+        /* Argmax on quantised logits, no softmax/dequant in the tail */
+#ifdef TM_AOT
+        tm_res = aot ? tm_aot_run_argmax(&slot->mdl, &slot->in, result) :
+                       tm_run_argmax(&slot->mdl, &slot->in, result);
+#else
+        tm_res = tm_run_argmax(&slot->mdl, &slot->in, result);
+#endif
+    } else {
+#ifdef TM_AOT
+        tm_res = aot ? tm_aot_run(&slot->mdl, &slot->in, slot->outs) :
+                       tm_run(&slot->mdl, &slot->in, slot->outs);
+#else
+        tm_res = tm_run(&slot->mdl, &slot->in, slot->outs);
+#endif
+        if (tm_res == TM_OK) {
+            *result = parse_output(slot, conf);
+        }
+    }
+#ifdef TM_AOT
+    if (aot && !(flags & TINYMAIX_RUN_FLAG_STREAM)) {
+        slot->mdl.delta_ok = 0;    /* next stream frame runs in full */
+    }
+#endif
+    stats_time(TINYMAIX_STATS_HIST_RUN, t0);
+#ifdef TM_PROFILE
+    if (tm_res == TM_SUSPEND) {
+        tm_prof_run_pause();
+    } else {
+        tm_prof_run_end();
+    }
+#endif
+    return tm_res;
+}
+
+/* Continue a main model run suspended by its budget, from its next layer */
+static tm_err_t resume_model(tinymaix_slot_t* slot, uint32_t flags, int* result, float* conf)
+{
+    uint32_t t0 = SERVICE_TICKS();
+    tm_err_t tm_res;
+
+#ifdef TM_PROFILE
+    tm_prof_run_resume();
+#endif
+    if (flags & TINYMAIX_RUN_FLAG_ARGMAX_ONLY) {
+        tm_res = tm_run_resume(&slot->mdl, NULL, result);
+    } else {
+        tm_res = tm_run_resume(&slot->mdl, slot->outs, NULL);
+        if (tm_res == TM_OK) {
+            *result = parse_output(slot, conf);
+        }
+    }
+    stats_time(TINYMAIX_STATS_HIST_RUN, t0);
+#ifdef TM_PROFILE
+    if (tm_res == TM_SUSPEND) {
+        tm_prof_run_pause();
+    } else {
+        tm_prof_run_end();
+    }
+#endif
+    return tm_res;
+}
+
+/* Keep a run its budget suspended for TINYMAIX_IPC_RESUME_INFERENCE, token and next layer in info */
+static void suspend_run(tinymaix_slot_t* slot, uint32_t flags, tfm_tinymaix_run_info_t* info)
+{
+    if (++g_resume_seq == 0) {
+        g_resume_seq = 1;
+    }
+    g_suspended.token = g_resume_seq;
+    g_suspended.slot = slot;
+    g_suspended.flags = flags;
+    info->resume_token = g_suspended.token;
+    info->resume_layer = slot->mdl.layer_i;
+    g_stats.suspends++;
+    LOG_RUN_DBG("Run suspended before layer %d (token %d)\n", slot->mdl.layer_i, g_suspended.token);
+}
+
+/*
+ * A suspended run leaves its model mid-way through main buf, sub buf and the
+ * fused outputs. Another run or a load on the same storage would overwrite
+ * them, so it drops the suspended run; resuming that token then fails with
+ * PSA_ERROR_BAD_STATE. With A/B slots a hot-swap keeps the swapped out
+ * storage for the run until it finishes or the next load drops it.
+ */
+static void drop_suspended(void)
+{
+    if (g_suspended.token) {
+        LOG_RUN_DBG("Suspended run (token %d) dropped\n", g_suspended.token);
+        g_suspended.token = 0;
+    }
+}
+
+/* Preprocess the 28x28 input image (g_in_uint8) into a model's input (or its stream frame) */
+static tm_err_t preprocess_input(tinymaix_slot_t* slot, tm_mat_t* dst)
+{
+    uint32_t t0 = SERVICE_TICKS();
+    tm_err_t tm_res;
+
+#if (TM_MDL_TYPE == TM_MDL_INT8) || (TM_MDL_TYPE == TM_MDL_INT16)
+    tm_res = tm_preprocess(&slot->mdl, TMPP_UINT2INT, &g_in_uint8, dst);
+#else
+    tm_res = tm_preprocess(&slot->mdl, TMPP_UINT2FP01, &g_in_uint8, dst);
+#endif
+    stats_time(TINYMAIX_STATS_HIST_PREPROCESS, t0);
+    return tm_res;
+}
+
+/*
+ * Run one request. With TINYMAIX_RUN_FLAG_CASCADE the gate model runs first
+ * and decides alone when its top-1 probability reaches gate_threshold; the
+ * main model only runs for frames the gate is unsure about. With
+ * TINYMAIX_RUN_FLAG_STREAM the main model input is diffed against the
+ * previous stream frame and only the changed rows are recomputed. With a
+ * budget the main model yields after the layer that uses it up and the
+ * request returns PSA_OPERATION_INCOMPLETE with a resume token. info comes
+ * in zeroed (or with the queue fields set) and gets the run details.
+ */
+static psa_status_t run_request(const tfm_tinymaix_run_params_t* params, int* result,
+                                tfm_tinymaix_run_info_t* info)
+{
+    tinymaix_slot_t* main_slot = g_active[TINYMAIX_SLOT_MAIN];
+    tinymaix_slot_t* gate = g_active[TINYMAIX_SLOT_GATE];
+    tm_err_t tm_res;
+    float conf = 0;
+    tm_delta_t delta = {0};
+
+    info->stage = TINYMAIX_STAGE_MAIN;
+    if (g_suspended.slot == main_slot ||
+        ((params->flags & TINYMAIX_RUN_FLAG_CASCADE) && g_suspended.slot == gate)) {
+        drop_suspended();
+    }
+
+    if (params->budget && (params->flags & (TINYMAIX_RUN_FLAG_CASCADE | TINYMAIX_RUN_FLAG_STREAM))) {
+        LOG_RUN_ERR("ERROR: Time budget not supported with cascade or stream runs\n");
+        return PSA_ERROR_NOT_SUPPORTED;
+    }
+    if (params->budget && SERVICE_TICK_HZ == 0) {
+        LOG_RUN_ERR("ERROR: Time budget needs the service timer\n");
+        return PSA_ERROR_NOT_SUPPORTED;
+    }
+    if (params->flags & TINYMAIX_RUN_FLAG_STREAM) {
+        if (main_slot->frame.data == NULL) {
+            LOG_RUN_ERR("ERROR: Stream run needs a model planned with --delta\n");
+            return PSA_ERROR_NOT_SUPPORTED;
+        }
+        delta.tol = params->stream_tolerance;
+        delta.max_pct = params->stream_max_percent ? params->stream_max_percent : 50;
+    }
+
+    g_in_uint8.dims = 3;
+    g_in_uint8.h = 28;
+    g_in_uint8.w = 28;
+    g_in_uint8.c = 1;
+    g_in_uint8.data = (mtype_t*)mnist_pic;
+
+    if (params->flags & TINYMAIX_RUN_FLAG_CASCADE) {
+        if (!gate->loaded) {
+            LOG_RUN_ERR("ERROR: Cascade requested, gate model not loaded\n");
+            return PSA_ERROR_BAD_STATE;
+        }
+        if (memcmp(gate->mdl.b->in_dims, main_slot->mdl.b->in_dims, sizeof(gate->mdl.b->in_dims)) != 0) {
+            LOG_RUN_ERR("ERROR: Gate and main model inputs differ\n");
+            return PSA_ERROR_INVALID_ARGUMENT;
+        }
+        /* Gate needs the dequantised softmax for its confidence, never argmax-only */
+        tm_res = preprocess_input(gate, &gate->in);
+        if (tm_res == TM_OK) {
+            tm_res = run_model(gate, 0, NULL, result, &conf);
+        }
+        if (tm_res != TM_OK) {
+            LOG_RUN_ERR("ERROR: Gate inference failed: %d\n", tm_res);
+            return PSA_ERROR_GENERIC_ERROR;
+        }
+        info->gate_confidence = conf;
+        LOG_RUN_DBG("Gate class %d, confidence %d/1000 (threshold %d/1000)\n", *result,
+                    (int)(conf * 1000), (int)(params->gate_threshold * 1000));
+        if (conf >= params->gate_threshold) {
+            info->stage = TINYMAIX_STAGE_GATE;
+            return PSA_SUCCESS;
+        }
+    }
+
+    tm_res = preprocess_input(main_slot, (params->flags & TINYMAIX_RUN_FLAG_STREAM) ?
+                                         &main_slot->frame : &main_slot->in);
+    if (tm_res == TM_OK) {
+        g_budget = params->budget;
+        g_budget_t0 = SERVICE_TICKS();
+        tm_res = run_model(main_slot, params->flags, &delta, result, &info->confidence);
+        g_budget = 0;
+    }
+    if (tm_res == TM_SUSPEND) {
+        suspend_run(main_slot, params->flags, info);
+        return PSA_OPERATION_INCOMPLETE;
+    }
+    if (params->flags & TINYMAIX_RUN_FLAG_STREAM) {
+        info->stream_tiles = delta.tiles;
+        info->stream_changed = delta.changed;
+        info->stream_full = delta.full;
+        LOG_RUN_DBG("Stream frame: %d/%d tiles changed, full run %d\n", delta.changed, delta.tiles, delta.full);
+    }
+    LOG_RUN_DBG("Main inference result: %d\n", tm_res);
+    return (tm_res == TM_OK) ? PSA_SUCCESS : PSA_ERROR_GENERIC_ERROR;
+}
+
+/* Decrypt an encrypted model package into out (TFM_TINYMAIX_MAX_MODEL_SIZE bytes) */
+static psa_status_t decrypt_model(const uint8_t* encrypted_data, size_t encrypted_size,
+                                  uint8_t* out, size_t* out_size)
 {
-    INFO_UNPRIV("=== PSA CBC DECRYPTION WITH MANUAL PKCS7 PADDING ===\n");
+    LOG_LOAD_DBG("=== PSA CBC DECRYPTION WITH MANUAL PKCS7 PADDING ===\n");
     
     /* Basic validation */
     if (!encrypted_data) {
         return PSA_ERROR_INVALID_ARGUMENT;
     }
     
-    INFO_UNPRIV("Input package size: %d bytes\n", encrypted_size);
+    LOG_LOAD_DBG("Input package size: %d bytes\n", encrypted_size);
     
     /* Parse header */
     if (encrypted_size < ENCRYPTED_HEADER_CBC_SIZE) {
-        INFO_UNPRIV("Package too small for CBC header\n");
+        LOG_LOAD_ERR("Package too small for CBC header\n");
         return PSA_ERROR_INVALID_ARGUMENT;
     }
     
     const encrypted_tinymaix_header_cbc_t* header = (const encrypted_tinymaix_header_cbc_t*)encrypted_data;
     
-    INFO_UNPRIV("PSA CBC Header:\n");
-    INFO_UNPRIV("  - Magic: 0x%08x\n", header->magic);
-    INFO_UNPRIV("  - Version: %u\n", header->version);
-    INFO_UNPRIV("  - Original size: %u\n", header->original_size);
+    LOG_LOAD_DBG("PSA CBC Header:\n");
+    LOG_LOAD_DBG("  - Magic: 0x%08x\n", header->magic);
+    LOG_LOAD_DBG("  - Version: %u\n", header->version);
+    LOG_LOAD_DBG("  - Original size: %u\n", header->original_size);
     
     /* Validate header */
     if (header->magic != ENCRYPTED_HEADER_MAGIC || header->version != 3) {
-        INFO_UNPRIV("Invalid header\n");
+        LOG_LOAD_ERR("Invalid header\n");
         return PSA_ERROR_INVALID_ARGUMENT;
     }
     
     if (header->original_size > TFM_TINYMAIX_MAX_MODEL_SIZE) {
-        INFO_UNPRIV("Output size too large\n");
+        LOG_LOAD_ERR("Output size too large\n");
         return PSA_ERROR_BUFFER_TOO_SMALL;
     }
     
@@ -209,14 +628,14 @@ static psa_status_t decrypt_model(const uint8_t* encrypted_data, size_t encrypte
     const uint8_t* ciphertext = encrypted_data + ENCRYPTED_HEADER_CBC_SIZE;
     
     if (ciphertext_size == 0) {
-        INFO_UNPRIV("No ciphertext found!\n");
+        LOG_LOAD_ERR("No ciphertext found!\n");
         return PSA_ERROR_INVALID_ARGUMENT;
     }
     
     /* Initialize PSA Crypto */
     psa_status_t crypto_status = psa_crypto_init();
     if (crypto_status != PSA_SUCCESS && crypto_status != PSA_ERROR_ALREADY_EXISTS) {
-        INFO_UNPRIV("PSA crypto init failed: %d\n", crypto_status);
+        LOG_LOAD_ERR("PSA crypto init failed: %d\n", crypto_status);
         return crypto_status;
     }
     
@@ -232,18 +651,18 @@ static psa_status_t decrypt_model(const uint8_t* encrypted_data, size_t encrypte
     psa_set_key_type(&attributes, PSA_KEY_TYPE_AES);
     psa_set_key_bits(&attributes, 128);
     
-    INFO_UNPRIV("Using CBC without padding (manual PKCS7 handling), algorithm: 0x%08x\n", cbc_alg);
+    LOG_LOAD_DBG("Using CBC without padding (manual PKCS7 handling), algorithm: 0x%08x\n", cbc_alg);
 
     // Derive key from HUK using PSA key derivation
     const char *huk_label = "pico2w-tinymaix-model-aes128-v1.0";
     if(derive_key_from_huk(huk_label, encryption_key, sizeof(encryption_key)) != PSA_SUCCESS) {
-        INFO_UNPRIV("Key derivation failed\n");
+        LOG_LOAD_ERR("Key derivation failed\n");
         return PSA_ERROR_GENERIC_ERROR;
     }
     
     psa_status_t status = psa_import_key(&attributes, encryption_key, 16, &key_id);
     if (status != PSA_SUCCESS) {
-        INFO_UNPRIV("Key import failed: %d\n", status);
+        LOG_LOAD_ERR("Key import failed: %d\n", status);
         return status;
     }
     
@@ -252,7 +671,7 @@ static psa_status_t decrypt_model(const uint8_t* encrypted_data, size_t encrypte
     
     status = psa_cipher_decrypt_setup(&operation, key_id, cbc_alg);
     if (status != PSA_SUCCESS) {
-        INFO_UNPRIV("Cipher setup failed: %d\n", status);
+        LOG_LOAD_ERR("Cipher setup failed: %d\n", status);
         psa_destroy_key(key_id);
         return status;
     }
@@ -260,7 +679,7 @@ static psa_status_t decrypt_model(const uint8_t* encrypted_data, size_t encrypte
     /* Set IV */
     status = psa_cipher_set_iv(&operation, header->iv, 16);
     if (status != PSA_SUCCESS) {
-        INFO_UNPRIV("Set IV failed: %d\n", status);
+        LOG_LOAD_ERR("Set IV failed: %d\n", status);
         psa_cipher_abort(&operation);
         psa_destroy_key(key_id);
         return status;
@@ -269,12 +688,12 @@ static psa_status_t decrypt_model(const uint8_t* encrypted_data, size_t encrypte
     /* Decrypt */
     size_t output_length = 0;
     status = psa_cipher_update(&operation, ciphertext, ciphertext_size, 
-                              g_decrypted_model, TFM_TINYMAIX_MAX_MODEL_SIZE, &output_length);
+                              out, TFM_TINYMAIX_MAX_MODEL_SIZE, &output_length);
     
     if (status == PSA_SUCCESS) {
         size_t final_length = 0;
         status = psa_cipher_finish(&operation, 
-                                  g_decrypted_model + output_length, 
+                                  out + output_length, 
                                   TFM_TINYMAIX_MAX_MODEL_SIZE - output_length, 
                                   &final_length);
         output_length += final_length;
@@ -284,94 +703,765 @@ static psa_status_t decrypt_model(const uint8_t* encrypted_data, size_t encrypte
     psa_destroy_key(key_id);
     
     if (status != PSA_SUCCESS) {
-        INFO_UNPRIV("Decryption failed: %d\n", status);
+        LOG_LOAD_ERR("Decryption failed: %d\n", status);
         return status;
     }
     
-    INFO_UNPRIV("Raw decryption successful: %d bytes (including PKCS7 padding)\n", output_length);
+    LOG_LOAD_DBG("Raw decryption successful: %d bytes (including PKCS7 padding)\n", output_length);
     
     /* Manual PKCS7 padding removal */
     if (output_length == 0) {
-        INFO_UNPRIV("No decrypted data\n");
+        LOG_LOAD_ERR("No decrypted data\n");
         return PSA_ERROR_GENERIC_ERROR;
     }
     
     /* Get padding length from last byte */
-    uint8_t padding_length = g_decrypted_model[output_length - 1];
-    INFO_UNPRIV("PKCS7 padding length: %d bytes\n", padding_length);
+    uint8_t padding_length = out[output_length - 1];
+    LOG_LOAD_DBG("PKCS7 padding length: %d bytes\n", padding_length);
     
     /* Validate padding length */
     if (padding_length == 0 || padding_length > 16) {
-        INFO_UNPRIV("Invalid PKCS7 padding length: %d\n", padding_length);
+        LOG_LOAD_ERR("Invalid PKCS7 padding length: %d\n", padding_length);
         return PSA_ERROR_GENERIC_ERROR;
     }
     
     if (padding_length > output_length) {
-        INFO_UNPRIV("Padding length (%d) exceeds data length (%d)\n", padding_length, output_length);
+        LOG_LOAD_ERR("Padding length (%d) exceeds data length (%d)\n", padding_length, output_length);
         return PSA_ERROR_GENERIC_ERROR;
     }
     
     /* Validate all padding bytes are correct */
     for (int i = 0; i < padding_length; i++) {
-        if (g_decrypted_model[output_length - 1 - i] != padding_length) {
-            INFO_UNPRIV("Invalid PKCS7 padding byte at position %d: got %d, expected %d\n", 
-                       output_length - 1 - i, g_decrypted_model[output_length - 1 - i], padding_length);
+        if (out[output_length - 1 - i] != padding_length) {
+            LOG_LOAD_ERR("Invalid PKCS7 padding byte at position %d: got %d, expected %d\n", 
+                       output_length - 1 - i, out[output_length - 1 - i], padding_length);
             return PSA_ERROR_GENERIC_ERROR;
         }
     }
     
     /* Remove padding */
-    g_decrypted_size = output_length - padding_length;
+    size_t decrypted_size = output_length - padding_length;
     
-    INFO_UNPRIV("=== CBC DECRYPTION SUCCESS ===\n");
-    INFO_UNPRIV("Decrypted %d bytes (manually removed %d bytes PKCS7 padding)\n", g_decrypted_size, padding_length);
-    INFO_UNPRIV("Expected size: %d bytes\n", header->original_size);
+    LOG_LOAD_DBG("=== CBC DECRYPTION SUCCESS ===\n");
+    LOG_LOAD_DBG("Decrypted %d bytes (manually removed %d bytes PKCS7 padding)\n", decrypted_size, padding_length);
+    LOG_LOAD_DBG("Expected size: %d bytes\n", header->original_size);
     
     /* Verify size matches expected */
-    if (g_decrypted_size != header->original_size) {
-        INFO_UNPRIV("Size mismatch: got %d, expected %d\n", g_decrypted_size, header->original_size);
+    if (decrypted_size != header->original_size) {
+        LOG_LOAD_ERR("Size mismatch: got %d, expected %d\n", decrypted_size, header->original_size);
         return PSA_ERROR_GENERIC_ERROR;
     }
     
+#if TM_LOG_LEVEL_LOAD >= TM_LOG_DEBUG
     /* Debug: Show first 16 bytes */
-    INFO_UNPRIV("First 16 bytes: ");
-    for (int i = 0; i < 16 && i < g_decrypted_size; i++) {
-        INFO_UNPRIV("%02x ", g_decrypted_model[i]);
+    LOG_LOAD_DBG("First 16 bytes: ");
+    for (int i = 0; i < 16 && i < decrypted_size; i++) {
+        LOG_LOAD_DBG("%02x ", out[i]);
     }
-    INFO_UNPRIV("\n");
+    LOG_LOAD_DBG("\n");
+#endif
     
     /* Verify TinyMaix model magic header */
-    if (g_decrypted_size >= 4) {
-        uint32_t model_magic = *(uint32_t*)g_decrypted_model;
-        INFO_UNPRIV("Model magic: 0x%08x\n", model_magic);
+    if (decrypted_size >= 4) {
+        uint32_t model_magic = *(uint32_t*)out;
+        LOG_LOAD_DBG("Model magic: 0x%08x\n", model_magic);
         if (model_magic == 0x5849414D) { // "MAIX"
-            INFO_UNPRIV("✅ Valid TinyMaix model detected!\n");
+            LOG_LOAD_DBG("✅ Valid TinyMaix model detected!\n");
         } else {
-            INFO_UNPRIV("❌ Invalid TinyMaix magic\n");
+            LOG_LOAD_ERR("❌ Invalid TinyMaix magic\n");
             return PSA_ERROR_GENERIC_ERROR;
         }
     }
     
+    *out_size = decrypted_size;
     return PSA_SUCCESS;
 }
-/* Initialization function for the TinyMaix inference service */
+/* Release a slot's model; the arena (A/B slots: the slot's bank) is wiped once no slot holds a model */
+static void unload_slot(tinymaix_slot_t* slot)
+{
+    if (slot->loaded) {
+        if (slot->frame.data != NULL) {
+            tm_free(slot->frame.data);  /* allocated after tm_load */
+            slot->frame.data = NULL;
+        }
+        tm_unload(&slot->mdl);
+        slot->loaded = 0;
+        slot->gen = 0;
+    }
+#ifdef TM_AB_SLOTS
+    /* Each storage owns its bank, the next allocations go there too */
+    tm_arena_select(slot->bank);
+#else
+    for (int i = 0; i < TINYMAIX_SLOT_STORE_CNT; i++) {
+        if (g_slots[i].loaded) {
+            return;
+        }
+    }
+#endif
+    tm_arena_reset();
+}
+
+/*
+ * Decrypt and load a model package into a slot. Buffers come from the
+ * arena in load order: reloading a slot below another loaded slot only
+ * reclaims its old buffers once the slots above are reloaded too.
+ *
+ * With A/B slots (TM_AB_SLOTS) the package goes into the spare storage and
+ * its own arena bank while the active model stays untouched. Only a fully
+ * decrypted and loaded model is swapped in, by one pointer store between
+ * requests; the replaced storage becomes the spare. A failed load leaves
+ * the active model serving.
+ */
+static psa_status_t load_slot(uint32_t slot_id, const uint8_t* encrypted, size_t encrypted_size)
+{
+#ifdef TM_AB_SLOTS
+    tinymaix_slot_t* slot = g_spare;
+#else
+    tinymaix_slot_t* slot = g_active[slot_id];
+#endif
+    psa_status_t status;
+    tm_err_t tm_res;
+    uint32_t t0;
+
+    if (g_suspended.slot == slot) {
+        drop_suspended();
+    }
+    /* Reload: release the current model before its bin is overwritten (A/B: the spare) */
+    unload_slot(slot);
+
+    /* Validate model size before processing */
+    if (encrypted_size > TFM_TINYMAIX_MAX_MODEL_SIZE) {
+        LOG_LOAD_ERR("Model too large: %d > %d\n", encrypted_size, TFM_TINYMAIX_MAX_MODEL_SIZE);
+        return PSA_ERROR_INSUFFICIENT_MEMORY;
+    }
+    t0 = SERVICE_TICKS();
+    status = decrypt_model(encrypted, encrypted_size, slot->bin, &slot->bin_size);
+    stats_time(TINYMAIX_STATS_HIST_DECRYPT, t0);
+    if (status != PSA_SUCCESS) {
+        LOG_LOAD_ERR("Model decryption failed: %d\n", status);
+        g_stats_cause = TINYMAIX_STATS_ERR_DECRYPT;
+        return status;
+    }
+    g_stats.bytes_decrypted += slot->bin_size;
+
+    /* Load decrypted model into TinyMaix */
+    LOG_LOAD_DBG("=== LOADING DECRYPTED MODEL INTO TINYMAIX (slot %d) ===\n", slot_id);
+    LOG_LOAD_DBG("Decrypted model size: %d bytes\n", slot->bin_size);
+    LOG_LOAD_DBG("Model buffer ptr: %p\n", slot->bin);
+    LOG_LOAD_DBG("Arena: %d bytes, %d in use\n", tm_arena_size(), tm_arena_used());
+    LOG_LOAD_DBG("Calling tm_load...\n");
+
+    /* NULL buf: main and sub buffers sized by the model, taken from the arena */
+    memset(&slot->mdl, 0, sizeof(slot->mdl));
+    tm_res = tm_load(&slot->mdl, slot->bin, NULL, layer_cb, &slot->in);
+#ifdef TM_AOT
+    if (tm_res == TM_OK && slot_id == TINYMAIX_SLOT_MAIN) {
+        /* AOT code is generated for one model, reject any other */
+        tm_res = tm_aot_check(&slot->mdl);
+        if (tm_res != TM_OK) {
+            LOG_LOAD_ERR("ERROR: Model does not match the AOT compiled code\n");
+            tm_unload(&slot->mdl);
+        }
+    }
+#endif
+
+    LOG_LOAD_DBG("tm_load returned: %d\n", tm_res);
+    if (tm_res != TM_OK) {
+        LOG_LOAD_ERR("TinyMaix model load failed: %d\n", tm_res);
+        if (tm_res == TM_ERR_MAGIC) {
+            LOG_LOAD_ERR("ERROR: Invalid model magic\n");
+        } else if (tm_res == TM_ERR_MDLTYPE) {
+            LOG_LOAD_ERR("ERROR: Wrong model type\n");
+        } else if (tm_res == TM_ERR_OOM) {
+            LOG_LOAD_ERR("ERROR: Out of memory\n");
+        }
+        /* Drop a partially allocated model */
+        if (tm_res == TM_ERR_OOM && slot->mdl.main_alloc) {
+            tm_arena_free(slot->mdl.buf);
+        }
+        unload_slot(slot);
+        g_stats_cause = TINYMAIX_STATS_ERR_MODEL;
+        return PSA_ERROR_GENERIC_ERROR;
+    }
+
+#if TM_DELTA_RUN
+    /* Stream frames are staged next to the model: its input at buf offset 0 is the previous frame */
+    memcpy(&slot->frame, &slot->in, sizeof(slot->frame));
+    slot->frame.data = NULL;
+    if (slot->mdl.b->delta_layers > 0) {
+        slot->frame.data = (mtype_t*)tm_malloc(slot->in.h * slot->in.w * slot->in.c * sizeof(mtype_t));
+        if (slot->frame.data == NULL) {
+            LOG_LOAD_ERR("ERROR: Out of memory for the stream frame\n");
+            tm_unload(&slot->mdl);
+            unload_slot(slot);
+            g_stats_cause = TINYMAIX_STATS_ERR_MODEL;
+            return PSA_ERROR_GENERIC_ERROR;
+        }
+    }
+#endif
+
+    slot_output_quant(slot);
+    slot->loaded = 1;
+    slot->gen = ++g_load_gen;
+    g_stats.loads++;
+#ifdef TM_AB_SLOTS
+    /* Swap in: the next request runs the new model, the old one is released unless a run is suspended on it */
+    g_spare = g_active[slot_id];
+    g_active[slot_id] = slot;
+    if (g_suspended.token && g_suspended.slot == g_spare) {
+        LOG_LOAD_DBG("Storage %d kept for the suspended run (token %d)\n", (int)(g_spare - g_slots),
+                     g_suspended.token);
+    } else {
+        unload_slot(g_spare);
+    }
+    tm_arena_select(slot->bank);
+    LOG_LOAD_INF("Slot %d swapped to storage %d (load %d)\n", slot_id, (int)(slot - g_slots), slot->gen);
+#endif
+    LOG_LOAD_INF("Model loaded into slot %d: %d layers, arena %d / %d bytes (high water %d)\n",
+                 slot_id, slot->mdl.b->layer_cnt, tm_arena_used(), tm_arena_size(), tm_arena_high_water());
+    LOG_LOAD_DBG("  - Input dims: %dx%dx%d\n", slot->mdl.b->in_dims[1], slot->mdl.b->in_dims[2], slot->mdl.b->in_dims[3]);
+    LOG_LOAD_DBG("  - Output dims: %dx%dx%d\n", slot->mdl.b->out_dims[1], slot->mdl.b->out_dims[2], slot->mdl.b->out_dims[3]);
+    LOG_LOAD_DBG("  - Buffer size: %d\n", slot->mdl.b->buf_size);
+    return PSA_SUCCESS;
+}
+
+/* TINYMAIX_IPC_LOAD_ENCRYPTED_MODEL: package in in_vec[0] (empty: builtin model), slot in in_vec[1] */
+static psa_status_t handle_load(const psa_msg_t* msg)
+{
+    tfm_tinymaix_load_params_t load_params;
+    psa_status_t status;
+    size_t bytes_read;
+
+    LOG_LOAD_DBG("TINYMAIX_IPC_LOAD_ENCRYPTED_MODEL called\n");
+
+    memset(&load_params, 0, sizeof(load_params));
+    if (msg->in_size[1] > 0) {
+        size_t params_size = msg->in_size[1] < sizeof(load_params) ?
+                             msg->in_size[1] : sizeof(load_params);
+        psa_read(msg->handle, 1, &load_params, params_size);
+    }
+
+    if (load_params.slot >= TINYMAIX_SLOT_CNT) {
+        LOG_LOAD_ERR("ERROR: Invalid model slot: %d\n", load_params.slot);
+        status = PSA_ERROR_INVALID_ARGUMENT;
+#ifdef TM_PRELOAD
+    } else if (msg->in_size[0] == 0 && load_params.slot == TINYMAIX_SLOT_MAIN &&
+               g_active[TINYMAIX_SLOT_MAIN]->loaded && g_active[TINYMAIX_SLOT_MAIN]->gen == g_preload_gen) {
+        /* Loaded (and warmed) at init, nothing to decrypt again */
+        LOG_LOAD_DBG("Builtin model already preloaded\n");
+        status = PSA_SUCCESS;
+#endif
+    } else if (msg->in_size[0] == 0) {
+        /* Use builtin encrypted model data */
+        LOG_LOAD_DBG("Using builtin model: size=%d bytes\n", encrypted_mdl_data_size);
+        status = load_slot(load_params.slot, encrypted_mdl_data_data, encrypted_mdl_data_size);
+    } else if (msg->in_size[0] > sizeof(shared_model_buffer)) {
+        LOG_LOAD_ERR("Client model too large: %d > %d\n", msg->in_size[0], sizeof(shared_model_buffer));
+        status = PSA_ERROR_INSUFFICIENT_MEMORY;
+    } else {
+        /* Client supplied package, encrypted for this device like the builtin one */
+        bytes_read = psa_read(msg->handle, 0, shared_model_buffer, msg->in_size[0]);
+        if (bytes_read != msg->in_size[0]) {
+            status = PSA_ERROR_COMMUNICATION_FAILURE;
+        } else {
+            LOG_LOAD_DBG("Using client model: size=%d bytes\n", bytes_read);
+            status = load_slot(load_params.slot, shared_model_buffer, bytes_read);
+        }
+    }
+
+    /* Write success result if there's output space */
+    if (status == PSA_SUCCESS && msg->out_size[0] >= sizeof(uint32_t)) {
+        uint32_t success_result = 0;
+        psa_write(msg->handle, 0, &success_result, sizeof(success_result));
+    }
+    return status;
+}
+
+/* Predicted class to out_vec[0] if there's output space, run details (deciding stage, resume token) to out_vec[1] */
+static void write_run_result(const psa_msg_t* msg, psa_status_t status, int result,
+                             const tfm_tinymaix_run_info_t* run_info)
+{
+    if (status == PSA_SUCCESS) {
+        LOG_RUN_DBG("Final predicted class: %d (stage %d)\n", result, run_info->stage);
+        if (msg->out_size[0] >= sizeof(int)) {
+            psa_write(msg->handle, 0, &result, sizeof(result));
+        }
+    }
+    if ((status == PSA_SUCCESS || status == PSA_OPERATION_INCOMPLETE) && msg->out_size[1] > 0) {
+        psa_write(msg->handle, 1, run_info, msg->out_size[1] < sizeof(*run_info) ?
+                  msg->out_size[1] : sizeof(*run_info));
+    }
+}
+
+/* Optional run parameters of a TINYMAIX_IPC_RUN_INFERENCE message in in_vec[1] */
+static void read_run_params(const psa_msg_t* msg, tfm_tinymaix_run_params_t* run_params)
+{
+    memset(run_params, 0, sizeof(*run_params));
+    if (msg->in_size[1] > 0) {
+        size_t params_size = msg->in_size[1] < sizeof(*run_params) ?
+                             msg->in_size[1] : sizeof(*run_params);
+        psa_read(msg->handle, 1, run_params, params_size);
+    }
+}
+
+/* Run a RUN message with its parameters (already read), image in in_vec[0] (empty: builtin image) */
+static psa_status_t serve_run(const psa_msg_t* msg, const tfm_tinymaix_run_params_t* params,
+                              tfm_tinymaix_run_info_t* run_info)
+{
+    psa_status_t status;
+    size_t bytes_read;
+    int result = -1;
+
+    tm_log_sample();
+    LOG_RUN_DBG("=== TINYMAIX_IPC_RUN_INFERENCE called ===\n");
+    LOG_RUN_DBG("Model loaded status: %d\n", g_active[TINYMAIX_SLOT_MAIN]->loaded);
+    LOG_RUN_DBG("Run flags: 0x%08x\n", params->flags);
+
+    if (!g_active[TINYMAIX_SLOT_MAIN]->loaded) {
+        LOG_RUN_ERR("ERROR: Model not loaded, cannot run inference\n");
+        status = PSA_ERROR_BAD_STATE;
+    } else {
+        LOG_RUN_DBG("Input data size: %d bytes\n", msg->in_size[0]);
+        /* Check if input data provided */
+        if (msg->in_size[0] == 28*28) {
+            /* Read custom input image data (28x28 = 784 bytes) */
+            bytes_read = psa_read(msg->handle, 0, mnist_pic, msg->in_size[0]);
+            if (bytes_read != msg->in_size[0]) {
+                status = PSA_ERROR_COMMUNICATION_FAILURE;
+            } else {
+                status = run_request(params, &result, run_info);
+            }
+        } else if (msg->in_size[0] == 0) {
+            /* Use built-in test image */
+            LOG_RUN_DBG("Using built-in test image for inference\n");
+            status = run_request(params, &result, run_info);
+        } else {
+            /* Invalid input size */
+            LOG_RUN_ERR("ERROR: Invalid input size: %d (expected 0 or 784)\n", msg->in_size[0]);
+            status = PSA_ERROR_INVALID_ARGUMENT;
+        }
+    }
+
+    LOG_RUN_DBG("=== INFERENCE COMPLETE ===\n");
+    LOG_RUN_DBG("Final status: %d\n", status);
+    write_run_result(msg, status, result, run_info);
+    return status;
+}
+
+/* TINYMAIX_IPC_RUN_INFERENCE: image in in_vec[0] (empty: builtin image), run parameters in in_vec[1] */
+static psa_status_t handle_run(const psa_msg_t* msg)
+{
+    tfm_tinymaix_run_params_t run_params;
+    tfm_tinymaix_run_info_t run_info;
+
+    read_run_params(msg, &run_params);
+    memset(&run_info, 0, sizeof(run_info));
+    return serve_run(msg, &run_params, &run_info);
+}
+
+/* TINYMAIX_IPC_RESUME_INFERENCE: token and budget in in_vec[0], outputs as TINYMAIX_IPC_RUN_INFERENCE */
+static psa_status_t handle_resume(const psa_msg_t* msg)
+{
+    tfm_tinymaix_resume_params_t resume;
+    tfm_tinymaix_run_info_t run_info;
+    psa_status_t status;
+    tm_err_t tm_res;
+    int result = -1;
+
+    tm_log_sample();
+    if (msg->in_size[0] != sizeof(resume) ||
+        psa_read(msg->handle, 0, &resume, sizeof(resume)) != sizeof(resume)) {
+        return PSA_ERROR_INVALID_ARGUMENT;
+    }
+    if (resume.token == 0 || resume.token != g_suspended.token) {
+        LOG_RUN_ERR("ERROR: No suspended run with token %d\n", resume.token);
+        return PSA_ERROR_BAD_STATE;
+    }
+
+    memset(&run_info, 0, sizeof(run_info));
+    run_info.stage = TINYMAIX_STAGE_MAIN;
+    g_budget = resume.budget;
+    g_budget_t0 = SERVICE_TICKS();
+    tm_res = resume_model(g_suspended.slot, g_suspended.flags, &result, &run_info.confidence);
+    g_budget = 0;
+    if (tm_res == TM_SUSPEND) {
+        suspend_run(g_suspended.slot, g_suspended.flags, &run_info);
+        status = PSA_OPERATION_INCOMPLETE;
+    } else {
+        g_suspended.token = 0;
+#ifdef TM_AB_SLOTS
+        /* The model swapped out under the run is released now */
+        if (g_suspended.slot == g_spare) {
+            unload_slot(g_spare);
+            tm_arena_select(g_active[TINYMAIX_SLOT_MAIN]->bank);
+        }
+#endif
+        LOG_RUN_DBG("Resumed inference result: %d\n", tm_res);
+        status = (tm_res == TM_OK) ? PSA_SUCCESS : PSA_ERROR_GENERIC_ERROR;
+    }
+    write_run_result(msg, status, result, &run_info);
+    return status;
+}
+
+#ifdef DEV_MODE
+/* TINYMAIX_IPC_GET_MODEL_KEY: HUK-derived model key in out_vec[0] (debug only) */
+static psa_status_t handle_get_model_key(const psa_msg_t* msg)
+{
+    psa_status_t status;
+
+    LOG_SVC_DBG("=== TINYMAIX_IPC_GET_MODEL_KEY called (DEV_MODE) ===\n");
+
+    if (msg->out_size[0] < DERIVED_KEY_LEN) {
+        LOG_SVC_ERR("ERROR: Output buffer too small for model key\n");
+        return PSA_ERROR_BUFFER_TOO_SMALL;
+    }
+
+    /* Derive key from HUK using same label as decrypt_model */
+    const char *huk_label = "pico2w-tinymaix-model-aes128-v1.0";
+    uint8_t derived_key[DERIVED_KEY_LEN];
+
+    status = derive_key_from_huk(huk_label, derived_key, sizeof(derived_key));
+    if (status == PSA_SUCCESS) {
+        /* Write the derived key to output */
+        psa_write(msg->handle, 0, derived_key, DERIVED_KEY_LEN);
+        LOG_SVC_INF("HUK-derived key returned successfully\n");
+
+#if TM_LOG_LEVEL_SVC >= TM_LOG_INFO
+        /* Log the key for debugging */
+        LOG_SVC_INF("Derived key: ");
+        for(int i = 0; i < DERIVED_KEY_LEN; i++) {
+            LOG_SVC_INF("%02x", derived_key[i]);
+        }
+        LOG_SVC_INF("\n");
+#endif
+    } else {
+        LOG_SVC_ERR("ERROR: Key derivation failed: %d\n", status);
+    }
+    return status;
+}
+#endif
+
+#ifdef TM_PROFILE
+/* TINYMAIX_IPC_GET_PROFILE: per-layer and kernel phase ticks of the last inference */
+static psa_status_t handle_get_profile(const psa_msg_t* msg)
+{
+    if (!g_prof_ready) {
+        return PSA_ERROR_NOT_SUPPORTED;
+    }
+    if (msg->out_size[0] < sizeof(tfm_tinymaix_profile_t)) {
+        return PSA_ERROR_BUFFER_TOO_SMALL;
+    }
+    psa_write(msg->handle, 0, tm_prof_table(), sizeof(tfm_tinymaix_profile_t));
+    return PSA_SUCCESS;
+}
+#endif
+
+#ifdef TM_QUEUE
+/* TINYMAIX_IPC_GET_QUEUE_STATS: request queue counters since boot */
+static psa_status_t handle_get_queue_stats(const psa_msg_t* msg)
+{
+    if (msg->out_size[0] < sizeof(tfm_tinymaix_queue_stats_t)) {
+        return PSA_ERROR_BUFFER_TOO_SMALL;
+    }
+    g_queue_stats.tick_hz = SERVICE_TICK_HZ;
+    g_queue_stats.capacity = TM_QUEUE_DEPTH;
+    g_queue_stats.depth = g_queue_cnt;
+    psa_write(msg->handle, 0, &g_queue_stats, sizeof(g_queue_stats));
+    return PSA_SUCCESS;
+}
+#endif
+
+/* TINYMAIX_IPC_GET_STATS: counters to out_vec[0] (may be empty), TINYMAIX_STATS_FLAG_* in in_vec[0] */
+static psa_status_t handle_get_stats(const psa_msg_t* msg)
+{
+    uint32_t flags = 0;
+
+    if (msg->in_size[0] > 0) {
+        if (msg->in_size[0] != sizeof(flags) ||
+            psa_read(msg->handle, 0, &flags, sizeof(flags)) != sizeof(flags)) {
+            return PSA_ERROR_INVALID_ARGUMENT;
+        }
+    }
+    if (msg->out_size[0] > 0) {
+        if (msg->out_size[0] < sizeof(g_stats)) {
+            return PSA_ERROR_BUFFER_TOO_SMALL;
+        }
+        g_stats.tick_hz = SERVICE_TICK_HZ;
+        g_stats.arena_size = tm_arena_size();
+        for (uint32_t i = 0; i < TINYMAIX_STATS_ARENA_BANKS; i++) {
+            g_stats.arena_high_water[i] = tm_arena_bank_high_water(i);
+        }
+        psa_write(msg->handle, 0, &g_stats, sizeof(g_stats));
+    }
+    if (flags & TINYMAIX_STATS_FLAG_RESET) {
+        memset(&g_stats, 0, sizeof(g_stats));
+        tm_arena_clear_high_water();
+    }
+    return PSA_SUCCESS;
+}
+
+/* Handle one message, shared by the IPC loop and the SFN entry */
+static psa_status_t tinymaix_dispatch(const psa_msg_t* msg)
+{
+    uint32_t t0 = SERVICE_TICKS();
+    psa_status_t status;
+
+    switch (msg->type) {
+        case PSA_IPC_CONNECT:
+        case PSA_IPC_DISCONNECT:
+            return PSA_SUCCESS;
+        case TINYMAIX_IPC_GET_STATS:
+            /* Not counted itself */
+            return handle_get_stats(msg);
+        case TINYMAIX_IPC_LOAD_ENCRYPTED_MODEL:  /* Changed from LOAD_ENCRYPTED_MODEL to match NS API */
+            status = handle_load(msg);
+            break;
+        case TINYMAIX_IPC_RUN_INFERENCE:
+            status = handle_run(msg);
+            break;
+        case TINYMAIX_IPC_RESUME_INFERENCE:
+            status = handle_resume(msg);
+            break;
+#ifdef DEV_MODE
+        case TINYMAIX_IPC_GET_MODEL_KEY:
+            status = handle_get_model_key(msg);
+            break;
+#endif
+#ifdef TM_PROFILE
+        case TINYMAIX_IPC_GET_PROFILE:
+            status = handle_get_profile(msg);
+            break;
+#endif
+#ifdef TM_QUEUE
+        case TINYMAIX_IPC_GET_QUEUE_STATS:
+            status = handle_get_queue_stats(msg);
+            break;
+#endif
+        default:
+            /* Unsupported message type */
+            status = PSA_ERROR_NOT_SUPPORTED;
+            break;
+    }
+    stats_request(msg->type, status, t0);
+    return status;
+}
+
+#ifdef TM_QUEUE
+/*
+ * Serve one batch: the oldest request of the most urgent class, followed by
+ * up to TM_QUEUE_BATCH - 1 later requests of the same class and run mode.
+ * They run back to back on the same model(s), each replied as it finishes.
+ */
+static void queue_serve_batch(void)
+{
+    uint8_t in_batch[TM_QUEUE_DEPTH] = {0};
+    uint32_t head = 0, batch = 0, depth = g_queue_cnt, kept = 0;
+    uint32_t prio, mode, wait, ahead;
+    psa_status_t status;
+    tfm_tinymaix_run_info_t run_info;
+    tfm_tinymaix_queue_prio_t* cls;
+
+    for (uint32_t i = 1; i < g_queue_cnt; i++) {
+        if (g_prio_rank[g_queue[i].params.priority] < g_prio_rank[g_queue[head].params.priority]) {
+            head = i;
+        }
+    }
+    prio = g_queue[head].params.priority;
+    mode = g_queue[head].params.flags & QUEUE_MODE_FLAGS;
+    for (uint32_t i = head; i < g_queue_cnt && batch < TM_QUEUE_BATCH; i++) {
+        if (g_queue[i].params.priority == prio && (g_queue[i].params.flags & QUEUE_MODE_FLAGS) == mode) {
+            in_batch[i] = 1;
+            batch++;
+        }
+    }
+
+    cls = &g_queue_stats.prio[prio];
+    for (uint32_t i = head; i < g_queue_cnt; i++) {
+        if (!in_batch[i]) {
+            continue;
+        }
+        wait = SERVICE_TICKS() - g_queue[i].arrival;
+        ahead = g_queue_served - g_queue[i].served;
+        g_queue_served++;
+        cls->served++;
+        cls->ahead_total += ahead;
+        cls->wait_total += wait;
+        if (ahead > cls->ahead_max) {
+            cls->ahead_max = ahead;
+        }
+        if (wait > cls->wait_max) {
+            cls->wait_max = wait;
+        }
+        memset(&run_info, 0, sizeof(run_info));
+        run_info.queue_depth = depth;
+        run_info.queue_batch = batch;
+        run_info.queue_wait = wait;
+        run_info.queue_ahead = ahead;
+        status = serve_run(&g_queue[i].msg, &g_queue[i].params, &run_info);
+        psa_reply(g_queue[i].msg.handle, status);
+        stats_request(TINYMAIX_IPC_RUN_INFERENCE, status, g_queue[i].arrival);
+    }
+    LOG_RUN_DBG("Queue batch: %d run(s) of class %d, depth %d\n", batch, prio, depth);
+
+    g_queue_stats.batches++;
+    if (batch > g_queue_stats.batch_max) {
+        g_queue_stats.batch_max = batch;
+    }
+    for (uint32_t i = 0; i < g_queue_cnt; i++) {
+        if (!in_batch[i]) {
+            g_queue[kept++] = g_queue[i];
+        }
+    }
+    g_queue_cnt = kept;
+}
+
+/*
+ * Take one message from the SPM loop (the queue has room). A RUN is queued
+ * with its parameters; everything else is handled now. A LOAD first serves
+ * the queued runs, which then still see the model they were sent for.
+ */
+static void queue_message(const psa_msg_t* msg)
+{
+    tinymaix_queued_run_t* q;
+
+    if (msg->type != TINYMAIX_IPC_RUN_INFERENCE) {
+        if (msg->type == TINYMAIX_IPC_LOAD_ENCRYPTED_MODEL) {
+            while (g_queue_cnt > 0) {
+                queue_serve_batch();
+            }
+        }
+        psa_reply(msg->handle, tinymaix_dispatch(msg));
+        return;
+    }
+
+    q = &g_queue[g_queue_cnt];
+    read_run_params(msg, &q->params);
+    if (q->params.priority >= TINYMAIX_PRIO_CNT) {
+        LOG_RUN_ERR("ERROR: Invalid priority class: %d\n", q->params.priority);
+        psa_reply(msg->handle, PSA_ERROR_INVALID_ARGUMENT);
+        stats_request(msg->type, PSA_ERROR_INVALID_ARGUMENT, SERVICE_TICKS());
+        return;
+    }
+    q->msg = *msg;
+    q->arrival = SERVICE_TICKS();
+    q->served = g_queue_served;
+    g_queue_cnt++;
+    if (g_queue_cnt > g_queue_stats.depth_max) {
+        g_queue_stats.depth_max = g_queue_cnt;
+    }
+}
+#endif
+
+#ifdef TM_PRELOAD
+/*
+ * Decrypt and load the builtin model into the main slot before the first
+ * request (TFM_TINYMAIX_PRELOAD), then optionally run one inference on the
+ * builtin image to warm the caches. The boot-time cost is logged in service
+ * ticks (tick_hz 0 if the timer does not run). A failure
+ * only leaves the slot empty for the first LOAD.
+ */
+static void preload_model(void)
+{
+    uint32_t t0, load_ticks, warm_ticks = 0;
+    int result = -1;
+    psa_status_t status;
+
+    t0 = SERVICE_TICKS();
+    status = load_slot(TINYMAIX_SLOT_MAIN, encrypted_mdl_data_data, encrypted_mdl_data_size);
+    load_ticks = SERVICE_TICKS() - t0;
+    stats_request(TINYMAIX_IPC_LOAD_ENCRYPTED_MODEL, status, t0);
+    if (status != PSA_SUCCESS) {
+        LOG_SVC_ERR("[TinyMaix Preload] failed: %d, model loads on first request\n", status);
+        return;
+    }
+    g_preload_gen = g_active[TINYMAIX_SLOT_MAIN]->gen;
+
+#ifdef TM_PRELOAD_WARMUP
+    {
+        tfm_tinymaix_run_params_t params;
+        tfm_tinymaix_run_info_t info;
+
+        memset(&params, 0, sizeof(params));
+        memset(&info, 0, sizeof(info));
+        t0 = SERVICE_TICKS();
+        status = run_request(&params, &result, &info);
+        warm_ticks = SERVICE_TICKS() - t0;
+        if (status != PSA_SUCCESS) {
+            LOG_SVC_ERR("[TinyMaix Preload] warm-up inference failed: %d\n", status);
+        }
+    }
+#endif
+    (void)load_ticks;   /* only logged */
+    (void)warm_ticks;
+    LOG_SVC_INF("[TinyMaix Preload] load %lu ticks warmup %lu ticks class %d tick_hz %lu\n",
+                (unsigned long)load_ticks, (unsigned long)warm_ticks, result,
+                (unsigned long)SERVICE_TICK_HZ);
+}
+#endif
+
+/* Initialization function for the TinyMaix inference service (SFN entry_init) */
 psa_status_t tinymaix_inference_init(void)
 {
     /* Initialize global state */
-    g_model_loaded = 0;
-    memset(&g_mdl, 0, sizeof(g_mdl));
+    memset(g_slots, 0, sizeof(g_slots));
+    for (uint32_t i = 0; i < TINYMAIX_SLOT_CNT; i++) {
+        g_active[i] = &g_slots[i];
+    }
+#ifdef TM_AB_SLOTS
+    g_spare = &g_slots[TINYMAIX_SLOT_CNT];
+    for (uint32_t i = 0; i < TINYMAIX_SLOT_STORE_CNT; i++) {
+        g_slots[i].bank = i;
+    }
+#endif
+    g_tick_hz = (tm_tick_init() == 0) ? TM_TICK_HZ : 0;
+    LOG_SVC_INF("TinyMaix service ticks: %lu Hz\n", (unsigned long)g_tick_hz);
+#ifdef TM_PROFILE
+    g_prof_ready = (tm_prof_init() == 0);
+    LOG_SVC_INF("TinyMaix profiler: %s\n", g_prof_ready ? "cycle counter enabled" : "no cycle counter");
+#endif
+#ifdef TM_PRELOAD
+    preload_model();
+#endif
     return PSA_SUCCESS;
 }
 
-/* Main entry point for the partition */
+#ifdef TM_SFN
+/* SFN model: the SPM calls the service function directly for every message */
+psa_status_t tfm_tinymaix_inference_sfn(const psa_msg_t* msg)
+{
+    return tinymaix_dispatch(msg);
+}
+#else
+/* Main entry point for the partition (IPC model) */
 void tinymaix_inference_entry(void)
 {
     psa_msg_t msg;
-    psa_status_t status;
-    size_t bytes_read;
-    tm_err_t tm_res;
-    int result;
 
+    tinymaix_inference_init();
+
+#ifdef TM_QUEUE
+    /* Queue loop: take every pending message, then serve one batch, then look again.
+     * Only calls that reach the SPM together queue up (secure clients, NS mailbox);
+     * TrustZone NS runs arrive one at a time and are ordered by the NS dispatcher */
+    while (1) {
+        if (g_queue_cnt == 0) {
+            psa_wait(TFM_TINYMAIX_INFERENCE_SIGNAL, PSA_BLOCK);
+        }
+        while (psa_wait(TFM_TINYMAIX_INFERENCE_SIGNAL, PSA_POLL) & TFM_TINYMAIX_INFERENCE_SIGNAL) {
+            if (g_queue_cnt == TM_QUEUE_DEPTH) {
+                /* The rest waits in the SPM until a batch frees room */
+                g_queue_stats.full++;
+                break;
+            }
+            if (psa_get(TFM_TINYMAIX_INFERENCE_SIGNAL, &msg) == PSA_SUCCESS) {
+                queue_message(&msg);
+            }
+        }
+        if (g_queue_cnt > 0) {
+            queue_serve_batch();
+        }
+    }
+#else
     /* Service loop: continuously wait for and process messages */
     while (1) {
         /* Wait for a message from a client */
@@ -382,224 +1472,8 @@ void tinymaix_inference_entry(void)
             continue;
         }
         
-        /* Process the message */
-        switch (msg.type) {
-            case PSA_IPC_CONNECT:
-                /* Connection request */
-                psa_reply(msg.handle, PSA_SUCCESS);
-                break;
-                
-            case TINYMAIX_IPC_LOAD_ENCRYPTED_MODEL:  /* Changed from LOAD_ENCRYPTED_MODEL to match NS API */
-                /* Process encrypted model load request using builtin encrypted model */
-                INFO_UNPRIV("TINYMAIX_IPC_LOAD_ENCRYPTED_MODEL called (builtin encrypted)\n");
-                
-                /* Use builtin encrypted model data */
-                INFO_UNPRIV("Using builtin model: size=%d bytes\n", encrypted_mdl_data_size);
-                
-                /* Validate model size before processing */
-                if (encrypted_mdl_data_size > TFM_TINYMAIX_MAX_MODEL_SIZE) {
-                    INFO_UNPRIV("Builtin model too large: %d > %d\n", encrypted_mdl_data_size, TFM_TINYMAIX_MAX_MODEL_SIZE);
-                    status = PSA_ERROR_INSUFFICIENT_MEMORY;
-                } else {
-                    status = decrypt_model(encrypted_mdl_data_data, encrypted_mdl_data_size);
-                }
-                
-                if (status == PSA_SUCCESS) {
-                    /* Load decrypted model into TinyMaix */
-                    INFO_UNPRIV("=== LOADING DECRYPTED MODEL INTO TINYMAIX ===\n");
-                    INFO_UNPRIV("Decrypted model size: %d bytes\n", g_decrypted_size);
-                    INFO_UNPRIV("Model buffer ptr: %p\n", g_decrypted_model);
-                    INFO_UNPRIV("Static main buf ptr: %p, size: %d\n", static_main_buf, MDL_BUF_LEN);
-                    INFO_UNPRIV("Calling tm_load...\n");
-                    
-                    tm_res = tm_load(&g_mdl, g_decrypted_model, static_main_buf, layer_cb, &g_in);
-                    
-                    INFO_UNPRIV("tm_load returned: %d\n", tm_res);
-                    if (tm_res != TM_OK) {
-                        INFO_UNPRIV("TinyMaix model load failed: %d\n", tm_res);
-                        if (tm_res == TM_ERR_MAGIC) {
-                            INFO_UNPRIV("ERROR: Invalid model magic\n");
-                        } else if (tm_res == TM_ERR_MDLTYPE) {
-                            INFO_UNPRIV("ERROR: Wrong model type\n");
-                        } else if (tm_res == TM_ERR_OOM) {
-                            INFO_UNPRIV("ERROR: Out of memory\n");
-                        }
-                        status = PSA_ERROR_GENERIC_ERROR;
-                        g_model_loaded = 0;
-                    } else {
-                        g_model_loaded = 1;
-                        status = PSA_SUCCESS;
-                        INFO_UNPRIV("=== TINYMAIX MODEL LOADED SUCCESSFULLY ===\n");
-                        INFO_UNPRIV("Model info:\n");
-                        INFO_UNPRIV("  - Input dims: %dx%dx%d\n", g_mdl.b->in_dims[1], g_mdl.b->in_dims[2], g_mdl.b->in_dims[3]);
-                        INFO_UNPRIV("  - Output dims: %dx%dx%d\n", g_mdl.b->out_dims[1], g_mdl.b->out_dims[2], g_mdl.b->out_dims[3]);
-                        INFO_UNPRIV("  - Layer count: %d\n", g_mdl.b->layer_cnt);
-                        INFO_UNPRIV("  - Buffer size: %d\n", g_mdl.b->buf_size);
-                    }
-                } else {
-                    INFO_UNPRIV("Builtin model decryption failed: %d\n", status);
-                    g_model_loaded = 0;
-                }
-                
-                /* Write success result if there's output space */
-                if (status == PSA_SUCCESS && msg.out_size[0] >= sizeof(uint32_t)) {
-                    uint32_t success_result = 0;
-                    psa_write(msg.handle, 0, &success_result, sizeof(success_result));
-                }
-                psa_reply(msg.handle, status);
-                break;
-                
-            case TINYMAIX_IPC_RUN_INFERENCE:
-                /* Process inference request */
-                INFO_UNPRIV("=== TINYMAIX_IPC_RUN_INFERENCE called ===\n");
-                INFO_UNPRIV("Model loaded status: %d\n", g_model_loaded);
-                
-                if (!g_model_loaded) {
-                    INFO_UNPRIV("ERROR: Model not loaded, cannot run inference\n");
-                    status = PSA_ERROR_BAD_STATE;
-                } else {
-                    INFO_UNPRIV("Input data size: %d bytes\n", msg.in_size[0]);
-                    /* Check if input data provided */
-                    if (msg.in_size[0] == 28*28) {
-                        /* Read custom input image data (28x28 = 784 bytes) */
-                        bytes_read = psa_read(msg.handle, 0, mnist_pic, msg.in_size[0]);
-                        if (bytes_read != msg.in_size[0]) {
-                            status = PSA_ERROR_COMMUNICATION_FAILURE;
-                        } else {
-                            /* Prepare input data with custom image */
-                            g_in_uint8.dims = 3;
-                            g_in_uint8.h = 28;
-                            g_in_uint8.w = 28; 
-                            g_in_uint8.c = 1;
-                            g_in_uint8.data = (mtype_t*)mnist_pic;
-                            
-                            /* Preprocess input */
-                            #if (TM_MDL_TYPE == TM_MDL_INT8) || (TM_MDL_TYPE == TM_MDL_INT16) 
-                                tm_res = tm_preprocess(&g_mdl, TMPP_UINT2INT, &g_in_uint8, &g_in); 
-                            #else
-                                tm_res = tm_preprocess(&g_mdl, TMPP_UINT2FP01, &g_in_uint8, &g_in); 
-                            #endif
-                            
-                            if (tm_res != TM_OK) {
-                                status = PSA_ERROR_GENERIC_ERROR;
-                            } else {
-                                /* Run inference */
-                                tm_res = tm_run(&g_mdl, &g_in, g_outs);
-                                if (tm_res != TM_OK) {
-                                    status = PSA_ERROR_GENERIC_ERROR;
-                                } else {
-                                    /* Parse output */
-                                    result = parse_output(g_outs);
-                                    status = PSA_SUCCESS;
-                                    
-                                    /* Write result if there's output space */
-                                    if (msg.out_size[0] >= sizeof(int)) {
-                                        psa_write(msg.handle, 0, &result, sizeof(result));
-                                    }
-                                }
-                            }
-                        }
-                    } else if (msg.in_size[0] == 0) {
-                        INFO_UNPRIV("Using built-in test image for inference\n");
-                        /* Use built-in test image */
-                        g_in_uint8.dims = 3;
-                        g_in_uint8.h = 28;
-                        g_in_uint8.w = 28; 
-                        g_in_uint8.c = 1;
-                        g_in_uint8.data = (mtype_t*)mnist_pic;
-                        
-                        INFO_UNPRIV("Preprocessing built-in input...\n");
-                        /* Preprocess input */
-                        #if (TM_MDL_TYPE == TM_MDL_INT8) || (TM_MDL_TYPE == TM_MDL_INT16) 
-                            tm_res = tm_preprocess(&g_mdl, TMPP_UINT2INT, &g_in_uint8, &g_in); 
-                        #else
-                            tm_res = tm_preprocess(&g_mdl, TMPP_UINT2FP01, &g_in_uint8, &g_in); 
-                        #endif
-                        
-                        INFO_UNPRIV("Built-in preprocessing result: %d\n", tm_res);
-                        if (tm_res != TM_OK) {
-                            INFO_UNPRIV("ERROR: Built-in preprocessing failed\n");
-                            status = PSA_ERROR_GENERIC_ERROR;
-                        } else {
-                            INFO_UNPRIV("Running built-in inference...\n");
-                            /* Run inference */
-                            tm_res = tm_run(&g_mdl, &g_in, g_outs);
-                            INFO_UNPRIV("Built-in inference result: %d\n", tm_res);
-                            if (tm_res != TM_OK) {
-                                INFO_UNPRIV("ERROR: Built-in inference failed\n");
-                                status = PSA_ERROR_GENERIC_ERROR;
-                            } else {
-                                INFO_UNPRIV("Parsing built-in output...\n");
-                                /* Parse output */
-                                result = parse_output(g_outs);
-                                INFO_UNPRIV("Built-in predicted class: %d\n", result);
-                                status = PSA_SUCCESS;
-                                
-                                /* Write result if there's output space */
-                                if (msg.out_size[0] >= sizeof(int)) {
-                                    psa_write(msg.handle, 0, &result, sizeof(result));
-                                }
-                            }
-                        }
-                    } else {
-                        /* Invalid input size */
-                        INFO_UNPRIV("ERROR: Invalid input size: %d (expected 0 or 784)\n", msg.in_size[0]);
-                        status = PSA_ERROR_INVALID_ARGUMENT;
-                    }
-                }
-                
-                INFO_UNPRIV("=== INFERENCE COMPLETE ===\n");
-                INFO_UNPRIV("Final status: %d\n", status);
-                if (status == PSA_SUCCESS) {
-                    INFO_UNPRIV("Final predicted class: %d\n", result);
-                }
-                
-                psa_reply(msg.handle, status);
-                break;
-
-#ifdef DEV_MODE
-            case TINYMAIX_IPC_GET_MODEL_KEY:
-                /* Get HUK-derived model key for debugging */
-                INFO_UNPRIV("=== TINYMAIX_IPC_GET_MODEL_KEY called (DEV_MODE) ===\n");
-                
-                if (msg.out_size[0] < DERIVED_KEY_LEN) {
-                    INFO_UNPRIV("ERROR: Output buffer too small for model key\n");
-                    status = PSA_ERROR_BUFFER_TOO_SMALL;
-                } else {
-                    /* Derive key from HUK using same label as decrypt_model */
-                    const char *huk_label = "pico2w-tinymaix-model-aes128-v1.0";
-                    uint8_t derived_key[DERIVED_KEY_LEN];
-                    
-                    status = derive_key_from_huk(huk_label, derived_key, sizeof(derived_key));
-                    if (status == PSA_SUCCESS) {
-                        /* Write the derived key to output */
-                        psa_write(msg.handle, 0, derived_key, DERIVED_KEY_LEN);
-                        INFO_UNPRIV("HUK-derived key returned successfully\n");
-                        
-                        /* Log the key for debugging */
-                        INFO_UNPRIV("Derived key: ");
-                        for(int i = 0; i < DERIVED_KEY_LEN; i++) {
-                            INFO_UNPRIV("%02x", derived_key[i]);
-                        }
-                        INFO_UNPRIV("\n");
-                    } else {
-                        INFO_UNPRIV("ERROR: Key derivation failed: %d\n", status);
-                    }
-                }
-                
-                psa_reply(msg.handle, status);
-                break;
-#endif
-                
-            case PSA_IPC_DISCONNECT:
-                /* Client disconnected */
-                psa_reply(msg.handle, PSA_SUCCESS);
-                break;
-                
-            default:
-                /* Unsupported message type */
-                psa_reply(msg.handle, PSA_ERROR_NOT_SUPPORTED);
-                break;
-        }
+        psa_reply(msg.handle, tinymaix_dispatch(&msg));
     }
-}
\ No newline at end of file
+#endif
+}
+#endif
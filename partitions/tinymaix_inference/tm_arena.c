@@ -0,0 +1,136 @@
+/*
+ * Copyright (c) 2025, Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ */
+
+#include "tm_arena.h"
+#include "tinymaix_model_mem.h"  /* Generated by tools/tinymaix_mem_planner.py */
+
+/* Build-time arena size (TFM_TINYMAIX_ARENA_SIZE), default fits the planned model */
+#ifndef TM_ARENA_SIZE
+#define TM_ARENA_SIZE (TINYMAIX_MDL_BUF_LEN + TINYMAIX_MDL_SUB_LEN + 2 * TM_ARENA_HDR_SIZE + \
+                       (TINYMAIX_MDL_FRAME_LEN ? TINYMAIX_MDL_FRAME_LEN + TM_ARENA_HDR_SIZE : 0))
+#endif
+
+#define TM_ARENA_ALIGN_UP(x)  (((x) + (TM_ARENA_ALIGN - 1)) & ~((size_t)TM_ARENA_ALIGN - 1))
+#define TM_ARENA_NONE         (0xFFFFFFFFu)
+#define TM_ARENA_FREED        (1u)  /* low bit of size, sizes are aligned */
+
+/* Block header, payload follows */
+typedef struct {
+    uint32_t prev;      /* offset of previous block header, TM_ARENA_NONE for first */
+    uint32_t size;      /* aligned payload size | TM_ARENA_FREED */
+} tm_arena_hdr_t;
+
+/* Allocation state of one bank */
+typedef struct {
+    uint32_t top;           /* first free byte */
+    uint32_t last;          /* header offset of the top block */
+    uint32_t high_water;
+} tm_arena_bank_t;
+
+#define TM_ARENA_BANK_SIZE    TM_ARENA_ALIGN_UP(TM_ARENA_SIZE)
+
+static uint8_t g_arena[TM_ARENA_BANKS][TM_ARENA_BANK_SIZE] __attribute__((aligned(TM_ARENA_ALIGN)));
+static tm_arena_bank_t g_banks[TM_ARENA_BANKS] = {
+    [0 ... TM_ARENA_BANKS - 1] = { 0, TM_ARENA_NONE, 0 }
+};
+static uint32_t g_bank_cur = 0;
+
+void tm_arena_select(uint32_t bank)
+{
+    if (bank < TM_ARENA_BANKS) {
+        g_bank_cur = bank;
+    }
+}
+
+void* tm_arena_alloc(size_t size)
+{
+    tm_arena_bank_t* b = &g_banks[g_bank_cur];
+    size_t need = TM_ARENA_HDR_SIZE + TM_ARENA_ALIGN_UP(size);
+    tm_arena_hdr_t* hdr;
+
+    if (size == 0 || need > TM_ARENA_BANK_SIZE - b->top) {
+        return NULL;
+    }
+
+    hdr = (tm_arena_hdr_t*)(g_arena[g_bank_cur] + b->top);
+    hdr->prev = b->last;
+    hdr->size = (uint32_t)TM_ARENA_ALIGN_UP(size);
+    b->last = b->top;
+    b->top += (uint32_t)need;
+    if (b->top > b->high_water) {
+        b->high_water = b->top;
+    }
+
+    return (uint8_t*)hdr + TM_ARENA_HDR_SIZE;
+}
+
+void tm_arena_free(void* ptr)
+{
+    uint8_t* p = (uint8_t*)ptr;
+    tm_arena_bank_t* b;
+    tm_arena_hdr_t* hdr;
+    uint8_t* base;
+    uint32_t i;
+
+    /* Any bank: a model is unloaded from its own bank */
+    for (i = 0; i < TM_ARENA_BANKS; i++) {
+        if (p >= g_arena[i] + TM_ARENA_HDR_SIZE && p < g_arena[i] + g_banks[i].top) {
+            break;
+        }
+    }
+    if (i == TM_ARENA_BANKS) {
+        return;
+    }
+    base = g_arena[i];
+    b = &g_banks[i];
+
+    hdr = (tm_arena_hdr_t*)(p - TM_ARENA_HDR_SIZE);
+    hdr->size |= TM_ARENA_FREED;
+
+    /* Roll the top back over every freed block at the end */
+    while (b->last != TM_ARENA_NONE) {
+        hdr = (tm_arena_hdr_t*)(base + b->last);
+        if (!(hdr->size & TM_ARENA_FREED)) {
+            break;
+        }
+        b->top = b->last;
+        b->last = hdr->prev;
+    }
+}
+
+void tm_arena_reset(void)
+{
+    g_banks[g_bank_cur].top = 0;
+    g_banks[g_bank_cur].last = TM_ARENA_NONE;
+}
+
+size_t tm_arena_size(void)
+{
+    return TM_ARENA_BANK_SIZE;
+}
+
+size_t tm_arena_used(void)
+{
+    return g_banks[g_bank_cur].top;
+}
+
+size_t tm_arena_high_water(void)
+{
+    return g_banks[g_bank_cur].high_water;
+}
+
+size_t tm_arena_bank_high_water(uint32_t bank)
+{
+    return bank < TM_ARENA_BANKS ? g_banks[bank].high_water : 0;
+}
+
+void tm_arena_clear_high_water(void)
+{
+    for (uint32_t i = 0; i < TM_ARENA_BANKS; i++) {
+        g_banks[i].high_water = g_banks[i].top;
+    }
+}
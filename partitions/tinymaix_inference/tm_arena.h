@@ -0,0 +1,63 @@
+/*
+ * Copyright (c) 2025, Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ */
+
+#ifndef __TM_ARENA_H__
+#define __TM_ARENA_H__
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * Static secure arena backing tm_malloc()/tm_free().
+ *
+ * Bump allocator over a build-time sized static buffer, no heap is used in
+ * the partition. Freeing the most recent block(s) rolls the top back, so
+ * the LIFO pattern of tm_load()/tm_unload() reclaims everything; a block
+ * freed out of order is reclaimed once all blocks above it are freed.
+ * tm_arena_reset() drops every block at once (model unload/reload).
+ *
+ * A/B model slots (TFM_TINYMAIX_AB_SLOTS) give every slot storage its own
+ * bank of the arena, so a model is loaded next to the one it replaces and
+ * the old bank is reset as a whole after the swap. Allocation, reset and
+ * the size queries act on the bank picked with tm_arena_select(); free
+ * finds the bank of the pointer.
+ */
+
+/* Allocation alignment and per-block header size in bytes */
+#define TM_ARENA_ALIGN      (8)
+#define TM_ARENA_HDR_SIZE   (8)
+
+/* Arena banks, each TM_ARENA_SIZE bytes: one per slot storage with A/B slots */
+#ifdef TM_AB_SLOTS
+#include "tfm_tinymaix_inference_defs.h"
+#define TM_ARENA_BANKS      (TINYMAIX_SLOT_CNT + 1)
+#else
+#define TM_ARENA_BANKS      (1)
+#endif
+
+void   tm_arena_select(uint32_t bank);  /* bank used by the calls below, 0 at boot */
+
+void*  tm_arena_alloc(size_t size);     /* NULL if the arena is exhausted */
+void   tm_arena_free(void* ptr);        /* NULL and foreign pointers are ignored */
+void   tm_arena_reset(void);            /* free all blocks, keeps high water mark */
+
+size_t tm_arena_size(void);             /* total arena bytes */
+size_t tm_arena_used(void);             /* bytes in use, headers included */
+size_t tm_arena_high_water(void);       /* max bytes ever in use */
+
+size_t tm_arena_bank_high_water(uint32_t bank);   /* of any bank, 0 past the last */
+void   tm_arena_clear_high_water(void);           /* every bank's mark down to its use */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __TM_ARENA_H__ */
@@ -0,0 +1,115 @@
+/*
+ * Copyright (c) 2025, Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ */
+
+#ifndef __TM_LOG_H__
+#define __TM_LOG_H__
+
+#include <stdint.h>
+#include "tfm_log_unpriv.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * Compile-time log levels of the TinyMaix partition (TFM_TINYMAIX_LOG_LEVEL).
+ *
+ * Every subsystem has its own level, TM_LOG_LEVEL unless set:
+ *   LOAD  package decryption and model load
+ *   RUN   the RUN/RESUME request path and the request queue
+ *   SVC   init, preload, DEV_MODE key
+ * A call above its subsystem's level expands to nothing, format string and
+ * arguments included. Level NONE (the Release/MinSizeRel default) leaves no
+ * log call in the partition. Lines that pass go out through INFO_UNPRIV.
+ *
+ * With TM_LOG_SAMPLE=N (TFM_TINYMAIX_LOG_SAMPLE) only every Nth request
+ * logs its RUN INFO and DEBUG lines; tm_log_sample() at the start of the
+ * request picks it. Errors are never sampled.
+ */
+#define TM_LOG_NONE         (0)
+#define TM_LOG_ERROR        (1)
+#define TM_LOG_INFO         (2)
+#define TM_LOG_DEBUG        (3)
+
+#ifndef TM_LOG_LEVEL
+#define TM_LOG_LEVEL        TM_LOG_INFO
+#endif
+#ifndef TM_LOG_LEVEL_LOAD
+#define TM_LOG_LEVEL_LOAD   TM_LOG_LEVEL
+#endif
+#ifndef TM_LOG_LEVEL_RUN
+#define TM_LOG_LEVEL_RUN    TM_LOG_LEVEL
+#endif
+#ifndef TM_LOG_LEVEL_SVC
+#define TM_LOG_LEVEL_SVC    TM_LOG_LEVEL
+#endif
+#ifndef TM_LOG_SAMPLE
+#define TM_LOG_SAMPLE       (0)
+#endif
+
+#if (TM_LOG_SAMPLE > 0) && (TM_LOG_LEVEL_RUN >= TM_LOG_INFO)
+extern uint8_t g_tm_log_on;             /* current request is sampled */
+void tm_log_sample(void);               /* at the start of a request */
+#define TM_LOG_SAMPLED(...)     do { if (g_tm_log_on) { INFO_UNPRIV(__VA_ARGS__); } } while (0)
+#else
+#define tm_log_sample()         do { } while (0)
+#define TM_LOG_SAMPLED(...)     INFO_UNPRIV(__VA_ARGS__)
+#endif
+
+#if TM_LOG_LEVEL_LOAD >= TM_LOG_ERROR
+#define LOG_LOAD_ERR(...)       INFO_UNPRIV(__VA_ARGS__)
+#else
+#define LOG_LOAD_ERR(...)       do { } while (0)
+#endif
+#if TM_LOG_LEVEL_LOAD >= TM_LOG_INFO
+#define LOG_LOAD_INF(...)       INFO_UNPRIV(__VA_ARGS__)
+#else
+#define LOG_LOAD_INF(...)       do { } while (0)
+#endif
+#if TM_LOG_LEVEL_LOAD >= TM_LOG_DEBUG
+#define LOG_LOAD_DBG(...)       INFO_UNPRIV(__VA_ARGS__)
+#else
+#define LOG_LOAD_DBG(...)       do { } while (0)
+#endif
+
+#if TM_LOG_LEVEL_RUN >= TM_LOG_ERROR
+#define LOG_RUN_ERR(...)        INFO_UNPRIV(__VA_ARGS__)
+#else
+#define LOG_RUN_ERR(...)        do { } while (0)
+#endif
+#if TM_LOG_LEVEL_RUN >= TM_LOG_INFO
+#define LOG_RUN_INF(...)        TM_LOG_SAMPLED(__VA_ARGS__)
+#else
+#define LOG_RUN_INF(...)        do { } while (0)
+#endif
+#if TM_LOG_LEVEL_RUN >= TM_LOG_DEBUG
+#define LOG_RUN_DBG(...)        TM_LOG_SAMPLED(__VA_ARGS__)
+#else
+#define LOG_RUN_DBG(...)        do { } while (0)
+#endif
+
+#if TM_LOG_LEVEL_SVC >= TM_LOG_ERROR
+#define LOG_SVC_ERR(...)        INFO_UNPRIV(__VA_ARGS__)
+#else
+#define LOG_SVC_ERR(...)        do { } while (0)
+#endif
+#if TM_LOG_LEVEL_SVC >= TM_LOG_INFO
+#define LOG_SVC_INF(...)        INFO_UNPRIV(__VA_ARGS__)
+#else
+#define LOG_SVC_INF(...)        do { } while (0)
+#endif
+#if TM_LOG_LEVEL_SVC >= TM_LOG_DEBUG
+#define LOG_SVC_DBG(...)        INFO_UNPRIV(__VA_ARGS__)
+#else
+#define LOG_SVC_DBG(...)        do { } while (0)
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __TM_LOG_H__ */
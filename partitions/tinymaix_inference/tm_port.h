@@ -36,19 +36,34 @@ limitations under the License.
 #define TM_MAX_CSIZE    (16)        //max channel num - minimal for MNIST (was 1000)
 #define TM_MAX_KSIZE    (9)         //max kernel_size 3x3 (was 5*5)  
 #define TM_MAX_KCSIZE   (144)       //max kernel_size*channels 3*3*16 (was 3*3*256)
+//int8 softmax exp LUT slots (1 per distinct softmax scale), 0 to use float softmax:
+//one per slot model (main, gate), two per slot model with A/B slots (old and new during a swap)
+#ifdef TM_AB_SLOTS
+#define TM_SOFTMAX_LUT_CNT (4)
+#else
+#define TM_SOFTMAX_LUT_CNT (2)
+#endif
+#define TM_FC_PACK_AT_LOAD (1)      //interleave fc weights by 4 outputs in tm_load (model bin must be in RAM)
+#define TM_FUSE_LAYERS  (1)         //fused conv+gap, gap+fc, fc+softmax, intermediates not materialised
+#define TM_DELTA_RUN    (1)         //tm_run_delta for TINYMAIX_RUN_FLAG_STREAM, needs a model planned with --delta
+#define TM_DELTA_TILE_ROWS (4)      //input rows per change tile
 
 #define TM_INLINE       __attribute__((always_inline)) static inline
 #define TM_WEAK         __attribute__((weak))
 
-// TF-M secure partition: NO dynamic memory allocation!
-// Use static buffers only to prevent malloc() calls
-#define tm_malloc(x)    NULL  
-#define tm_free(x)      do {} while(0)
+// TF-M secure partition: NO heap allocation!
+// tm_malloc/tm_free come from a static secure arena (tm_arena.c), sized at build time
+#include "tm_arena.h"
+#define tm_malloc(x)    tm_arena_alloc(x)
+#define tm_free(x)      tm_arena_free(x)
 
 // Minimal logging for TFM - use TFM logging macros
 #define TM_PRINTF(...) 
 #define TM_DBG(...)    
 #define TM_DBGL()
+// tm_load notes (e.g. a slower fallback kernel) go to the partition's LOAD log
+#include "tm_log.h"
+#define TM_LOAD_NOTE(...)   LOG_LOAD_INF(__VA_ARGS__)
 
 // Define FLT_MAX to avoid float.h dependency 
 #ifndef FLT_MAX
@@ -86,7 +101,21 @@ static inline float tm_exp_local(float x) {
 #define TM_DBGT(...)       do { } while(0)
 #define TM_GET_US()        0
 
-/******************************* DBG PERFORMANCE CONFIG - DISABLED ************************************/
+/******************************* DBG PERFORMANCE CONFIG ************************************/
+#ifdef TM_PROFILE
+// Profiling build (TFM_TINYMAIX_PROFILE): TM_PERF_* marks of tm_layers.c count
+// cycles (DWT CYCCNT) into TM_PERF_REG counters, collected by tm_prof.c
+#include "tm_prof.h"
+#define TM_EN_PERF 1
+#define TM_GET_TICK(x)      ((x) = tm_prof_ticks())
+#define TM_TICK_PERUS       (TM_PROF_CPU_HZ/1000000)
+#define TM_PERF_REG(x)      uint32_t x=0
+#define TM_PERF_EXTREG(x)   extern uint32_t x
+#define TM_PERF_INIT(x)     uint32_t _##x##_t0=0, _##x##_t1=0; (void)_##x##_t0; (void)_##x##_t1
+#define TM_PERF_START(x)    TM_GET_TICK(_##x##_t0)
+#define TM_PERF_ADD(x)      do { TM_GET_TICK(_##x##_t1); x += (_##x##_t1 - _##x##_t0); } while(0)
+#define TM_PERF_PRINT(x)
+#else
 // Disable performance monitoring to save memory and dependencies
 #define TM_EN_PERF 0
 #define TM_GET_TICK(x)
@@ -97,5 +126,6 @@ static inline float tm_exp_local(float x) {
 #define TM_PERF_START(x)
 #define TM_PERF_ADD(x)
 #define TM_PERF_PRINT(x)
+#endif
 
 #endif
@@ -0,0 +1,117 @@
+/*
+ * Copyright (c) 2025, Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ */
+
+#include <string.h>
+#include "tm_prof.h"
+#include "tm_port.h"
+
+#if defined(__ARM_ARCH_8M_MAIN__)
+/* DWT/DEMCR in the PPB, privileged access only (TFM_ISOLATION_LEVEL 1) */
+#define TM_PROF_DEMCR           (*(volatile uint32_t*)0xE000EDFCu)
+#define TM_PROF_DWT_CTRL        (*(volatile uint32_t*)0xE0001000u)
+#define TM_PROF_DWT_CYCCNT      (*(volatile uint32_t*)0xE0001004u)
+#define TM_PROF_DEMCR_TRCENA    (1u << 24)
+#define TM_PROF_DWT_NOCYCCNT    (1u << 25)
+#define TM_PROF_DWT_CYCCNTENA   (1u << 0)
+#define TM_PROF_TICK_HZ         TM_PROF_CPU_HZ
+#else
+#include <time.h>
+#define TM_PROF_TICK_HZ         (1000000000u)
+#endif
+
+/* Kernel phase counters defined by TM_PERF_REG in tm_layers.c */
+TM_PERF_EXTREG(t_sbuf); TM_PERF_EXTREG(t_dotp); TM_PERF_EXTREG(t_post);
+TM_PERF_EXTREG(t_valid); TM_PERF_EXTREG(t_pad);
+TM_PERF_EXTREG(t_conv); TM_PERF_EXTREG(t_pwconv); TM_PERF_EXTREG(t_dwconv);
+
+static tfm_tinymaix_profile_t g_prof;
+static uint32_t g_prof_run_t0;      /* tm_run entry */
+static uint32_t g_prof_layer_t0;    /* previous layer callback */
+static uint32_t g_prof_pause_t0;    /* suspended run */
+
+int tm_prof_init(void)
+{
+    memset(&g_prof, 0, sizeof(g_prof));
+    g_prof.tick_hz = TM_PROF_TICK_HZ;
+#if defined(__ARM_ARCH_8M_MAIN__)
+    TM_PROF_DEMCR |= TM_PROF_DEMCR_TRCENA;
+    if (TM_PROF_DWT_CTRL & TM_PROF_DWT_NOCYCCNT) {
+        return -1;
+    }
+    TM_PROF_DWT_CYCCNT = 0;
+    TM_PROF_DWT_CTRL |= TM_PROF_DWT_CYCCNTENA;
+#endif
+    return 0;
+}
+
+uint32_t tm_prof_ticks(void)
+{
+#if defined(__ARM_ARCH_8M_MAIN__)
+    return TM_PROF_DWT_CYCCNT;
+#else
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint32_t)((uint64_t)ts.tv_sec * 1000000000u + (uint64_t)ts.tv_nsec);
+#endif
+}
+
+void tm_prof_run_begin(uint32_t layer_cnt)
+{
+    t_sbuf = t_dotp = t_post = 0;
+    t_valid = t_pad = 0;
+    t_conv = t_pwconv = t_dwconv = 0;
+    memset(g_prof.layer_type, 0, sizeof(g_prof.layer_type));
+    memset(g_prof.layer_ticks, 0, sizeof(g_prof.layer_ticks));
+    g_prof.layer_cnt = layer_cnt < TINYMAIX_PROFILE_MAX_LAYERS ? layer_cnt : TINYMAIX_PROFILE_MAX_LAYERS;
+    g_prof_run_t0 = tm_prof_ticks();
+    g_prof_layer_t0 = g_prof_run_t0;
+}
+
+/* Ticks since the previous callback: layers that run before their callback
+ * (patch stack, fused producers) book their time on the next callback */
+void tm_prof_layer(uint32_t layer_i, uint32_t type)
+{
+    uint32_t now = tm_prof_ticks();
+
+    if (layer_i < g_prof.layer_cnt) {
+        g_prof.layer_type[layer_i] = type;
+        g_prof.layer_ticks[layer_i] = now - g_prof_layer_t0;
+    }
+    g_prof_layer_t0 = now;
+}
+
+void tm_prof_run_pause(void)
+{
+    g_prof_pause_t0 = tm_prof_ticks();
+}
+
+void tm_prof_run_resume(void)
+{
+    uint32_t paused = tm_prof_ticks() - g_prof_pause_t0;
+
+    g_prof_run_t0 += paused;
+    g_prof_layer_t0 += paused;
+}
+
+void tm_prof_run_end(void)
+{
+    g_prof.total_ticks = tm_prof_ticks() - g_prof_run_t0;
+    g_prof.phase_ticks[TINYMAIX_PROF_SBUF]   = t_sbuf;
+    g_prof.phase_ticks[TINYMAIX_PROF_DOTP]   = t_dotp;
+    g_prof.phase_ticks[TINYMAIX_PROF_POST]   = t_post;
+    g_prof.phase_ticks[TINYMAIX_PROF_VALID]  = t_valid;
+    g_prof.phase_ticks[TINYMAIX_PROF_PAD]    = t_pad;
+    g_prof.phase_ticks[TINYMAIX_PROF_CONV]   = t_conv;
+    g_prof.phase_ticks[TINYMAIX_PROF_PWCONV] = t_pwconv;
+    g_prof.phase_ticks[TINYMAIX_PROF_DWCONV] = t_dwconv;
+    g_prof.runs++;
+}
+
+const tfm_tinymaix_profile_t* tm_prof_table(void)
+{
+    return &g_prof;
+}
@@ -0,0 +1,49 @@
+/*
+ * Copyright (c) 2025, Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ */
+
+#ifndef __TM_PROF_H__
+#define __TM_PROF_H__
+
+#include <stdint.h>
+#include "tfm_tinymaix_inference_defs.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * Cycle profiler of the profiling build (TFM_TINYMAIX_PROFILE).
+ *
+ * The tick source is the DWT cycle counter on Armv8-M Mainline (M33), and
+ * CLOCK_MONOTONIC nanoseconds on a host build. The TM_PERF_* annotations of
+ * tm_layers.c accumulate kernel phase ticks into their TM_PERF_REG counters;
+ * per-layer ticks are taken from the layer callback. Results of the last
+ * run are kept in a tfm_tinymaix_profile_t table read by
+ * TINYMAIX_IPC_GET_PROFILE.
+ */
+
+/* Tick rate reported to clients (TFM_TINYMAIX_PROFILE_CPU_HZ) */
+#ifndef TM_PROF_CPU_HZ
+#define TM_PROF_CPU_HZ      (150000000u)
+#endif
+
+int      tm_prof_init(void);            /* 0 if the tick source works */
+uint32_t tm_prof_ticks(void);           /* free running, wraps */
+
+void     tm_prof_run_begin(uint32_t layer_cnt);
+void     tm_prof_layer(uint32_t layer_i, uint32_t type);   /* from the layer callback */
+void     tm_prof_run_pause(void);       /* run suspended, not counted until tm_prof_run_resume */
+void     tm_prof_run_resume(void);
+void     tm_prof_run_end(void);
+
+const tfm_tinymaix_profile_t* tm_prof_table(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __TM_PROF_H__ */
@@ -0,0 +1,46 @@
+/*
+ * Copyright (c) 2025, Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ */
+
+#include "tm_tick.h"
+
+#if defined(__ARM_ARCH_8M_MAIN__)
+/* RP2350 TIMER0, the low word of the raw 64-bit count needs no latching */
+#define TM_TICK_TIMER0_BASE     (0x400B0000u)
+#define TM_TICK_TIMERAWL        (*(volatile uint32_t*)(TM_TICK_TIMER0_BASE + 0x28u))
+/* Reads to wait for one tick, a few microseconds at the core clock */
+#define TM_TICK_PROBE_READS     (10000u)
+#else
+#include <time.h>
+#endif
+
+int tm_tick_init(void)
+{
+#if defined(__ARM_ARCH_8M_MAIN__)
+    uint32_t t0 = TM_TICK_TIMERAWL;
+
+    /* A timer held in reset or without its tick generator never moves */
+    for (uint32_t i = 0; i < TM_TICK_PROBE_READS; i++) {
+        if (TM_TICK_TIMERAWL != t0) {
+            return 0;
+        }
+    }
+    return -1;
+#else
+    return 0;
+#endif
+}
+
+uint32_t tm_tick_read(void)
+{
+#if defined(__ARM_ARCH_8M_MAIN__)
+    return TM_TICK_TIMERAWL;
+#else
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint32_t)((uint64_t)ts.tv_sec * 1000000u + (uint64_t)ts.tv_nsec / 1000u);
+#endif
+}
@@ -0,0 +1,38 @@
+/*
+ * Copyright (c) 2025, Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ */
+
+#ifndef __TM_TICK_H__
+#define __TM_TICK_H__
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * Service tick source: service stats, queue waits, preload and run budgets.
+ *
+ * The tick source is the free-running RP2350 TIMER0 (TFM_PERIPHERAL_TIMER0,
+ * a read-only MMIO region of the partition manifest, so it is readable at
+ * any isolation level), and CLOCK_MONOTONIC microseconds on a host build.
+ * The DWT cycle counter stays with the profiler (tm_prof.h).
+ */
+
+/* Tick rate of TIMER0, 1 MHz from the TICKS block set up by the boot code */
+#ifndef TM_TICK_HZ
+#define TM_TICK_HZ          (1000000u)
+#endif
+
+int      tm_tick_init(void);            /* 0 if the timer runs */
+uint32_t tm_tick_read(void);            /* free running, wraps */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __TM_TICK_H__ */
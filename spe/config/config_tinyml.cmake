@@ -34,6 +34,76 @@ set(TFM_PARTITION_TINYMAIX_INFERENCE    ON          CACHE BOOL      "Enable Tiny
 # Development mode option for debug features
 set(DEV_MODE                            OFF         CACHE BOOL      "Enable development mode with debug features")
 
+# TinyMaix secure arena backing tm_malloc (main/sub buffers), 0 sizes it from the planned model
+set(TFM_TINYMAIX_ARENA_SIZE             0           CACHE STRING    "TinyMaix static arena size in bytes, 0 for planned model size")
+
+# Run the model through the generated AOT code (tools/tinymaix_aot.py) instead of the tm_run interpreter
+set(TFM_TINYMAIX_AOT                    OFF         CACHE BOOL      "Use ahead-of-time compiled TinyMaix model code")
+
+# Per-layer and kernel phase cycle profiling (DWT CYCCNT), read with TINYMAIX_IPC_GET_PROFILE; needs TFM_ISOLATION_LEVEL 1
+set(TFM_TINYMAIX_PROFILE                OFF         CACHE BOOL      "Enable the TinyMaix cycle profiler")
+set(TFM_TINYMAIX_PROFILE_CPU_HZ         150000000   CACHE STRING    "Core clock reported with TinyMaix profiles")
+
+# A/B model slots: a load is decrypted and validated into a spare slot storage with its own arena bank,
+# then swapped in between requests, so the old model serves until then (costs one more model bin and
+# TFM_TINYMAIX_ARENA_SIZE bytes per slot storage, three in total)
+set(TFM_TINYMAIX_AB_SLOTS               OFF         CACHE BOOL      "Double-buffered TinyMaix model slots for hot-swap")
+
+# Decrypt and load the builtin model at partition init, optionally followed by one warm-up inference,
+# so the first request skips decryption, HKDF and tm_load; a builtin LOAD of the main slot is then a no-op
+set(TFM_TINYMAIX_PRELOAD                OFF         CACHE BOOL      "Load the builtin TinyMaix model at partition init")
+set(TFM_TINYMAIX_PRELOAD_WARMUP         ON          CACHE BOOL      "Run one warm-up inference after the preload")
+
+# Secure request queue (IPC model only): pending RUN requests are taken from the SPM into a bounded queue,
+# served most urgent priority class first and batched per class and run mode on the same model;
+# queue depth, batch and wait counters are read with TINYMAIX_IPC_GET_QUEUE_STATS
+set(TFM_TINYMAIX_QUEUE                  OFF         CACHE BOOL      "Queue, batch and prioritise TinyMaix RUN requests")
+set(TFM_TINYMAIX_QUEUE_DEPTH            8           CACHE STRING    "RUN requests held in the TinyMaix request queue")
+set(TFM_TINYMAIX_QUEUE_BATCH            4           CACHE STRING    "Most RUN requests served in one batch")
+
+# TinyMaix partition log levels NONE, ERROR, INFO or DEBUG: lines above the level are compiled out.
+# Empty: NONE in Release/MinSizeRel builds, INFO otherwise. Per subsystem (LOAD: decryption and model
+# load, RUN: request path, SVC: init and preload), empty ones follow TFM_TINYMAIX_LOG_LEVEL.
+# LOG_SAMPLE N > 0 logs the request path INFO/DEBUG lines of every Nth request only
+set(TFM_TINYMAIX_LOG_LEVEL              ""          CACHE STRING    "TinyMaix partition log level")
+set(TFM_TINYMAIX_LOG_LEVEL_LOAD         ""          CACHE STRING    "TinyMaix model load log level")
+set(TFM_TINYMAIX_LOG_LEVEL_RUN          ""          CACHE STRING    "TinyMaix request path log level")
+set(TFM_TINYMAIX_LOG_LEVEL_SVC          ""          CACHE STRING    "TinyMaix init and preload log level")
+set(TFM_TINYMAIX_LOG_SAMPLE             0           CACHE STRING    "Log every Nth TinyMaix request, 0 for all")
+
+# Build the TinyMaix partition in the SFN model (service function called per message, no partition thread);
+# a direct call on the caller's context also needs CONFIG_TFM_SPM_BACKEND=SFN and TFM_ISOLATION_LEVEL 1
+set(TFM_TINYMAIX_SFN                    OFF         CACHE BOOL      "Build the TinyMaix partition as an SFN model partition")
+
+# Compile the partitions with -fstack-usage -fcallgraph-info and add the tinymaix_stack_usage target
+# (worst-case stack per manifest entry, suggested "stack_size"); needs GCC 10 or later
+set(TFM_TINYML_STACK_USAGE              OFF         CACHE BOOL      "Build partitions for static stack usage analysis")
+
+# Post-link RAM/flash report of tfm_s.map per partition and symbol (tinymaix_footprint target, GNU only);
+# the build fails when a limit of the budget file is exceeded, deltas are printed against the baseline
+set(TFM_TINYML_FOOTPRINT                ON          CACHE BOOL      "Report the secure footprint after link and check it against the budget")
+set(TFM_TINYML_FOOTPRINT_BUDGET         "${CMAKE_CURRENT_LIST_DIR}/footprint_budget.json" CACHE FILEPATH "Footprint budget JSON, empty for no check")
+set(TFM_TINYML_FOOTPRINT_BASELINE       "${CMAKE_CURRENT_LIST_DIR}/footprint_baseline.json" CACHE FILEPATH "Footprint baseline JSON for deltas")
+
+# Crypto usage trace (partitions/crypto_trace): peak engine heap, peak concurrent operations and the
+# algorithms/key types used are logged as "[Crypto Trace]" lines, tools/tinymaix_crypto_config.py
+# turns a UART log of the workloads into a right-sized config header. The PSA core functions are
+# wrapped at link time under the SPE name prefix of the mbedcrypto library.
+set(TFM_TINYML_CRYPTO_TRACE             OFF         CACHE BOOL      "Trace crypto heap, operation and algorithm usage")
+set(TFM_TINYML_CRYPTO_TRACE_PREFIX      "mbedcrypto__" CACHE STRING "SPE name prefix of the PSA core functions (crypto_spe.h)")
+
+# manifest_list.yaml conditionals selecting the IPC or SFN manifest of the TinyMaix partition
+if (TFM_PARTITION_TINYMAIX_INFERENCE AND TFM_TINYMAIX_SFN)
+    set(TFM_PARTITION_TINYMAIX_INFERENCE_IPC OFF    CACHE INTERNAL  "")
+    set(TFM_PARTITION_TINYMAIX_INFERENCE_SFN ON     CACHE INTERNAL  "")
+elseif (TFM_PARTITION_TINYMAIX_INFERENCE)
+    set(TFM_PARTITION_TINYMAIX_INFERENCE_IPC ON     CACHE INTERNAL  "")
+    set(TFM_PARTITION_TINYMAIX_INFERENCE_SFN OFF    CACHE INTERNAL  "")
+else()
+    set(TFM_PARTITION_TINYMAIX_INFERENCE_IPC OFF    CACHE INTERNAL  "")
+    set(TFM_PARTITION_TINYMAIX_INFERENCE_SFN OFF    CACHE INTERNAL  "")
+endif()
+
 # Crypto modules will be automatically enabled based on TFM_CRYPTO dependency in manifest
 # No need to manually configure them
 
@@ -56,6 +126,10 @@ set(TFM_S_REG_TEST                      OFF         CACHE BOOL      "Enable S re
 
 # Use TF-M's default client config and our service config
 set(TFM_MBEDCRYPTO_CONFIG_PATH ${CMAKE_CURRENT_LIST_DIR}/mbedtls_config.h CACHE PATH "Service side mbedtls config")
+if (TFM_TINYML_CRYPTO_TRACE)
+    # Same config plus MBEDTLS_MEMORY_DEBUG for the heap peak
+    set(TFM_MBEDCRYPTO_CONFIG_PATH ${CMAKE_CURRENT_LIST_DIR}/mbedtls_config_trace.h)
+endif()
 # set(TFM_MBEDCRYPTO_CONFIG_CLIENT_PATH ${CONFIG_TFM_SOURCE_PATH}/lib/ext/mbedcrypto/mbedcrypto_config/tfm_mbedcrypto_config_client.h CACHE PATH "Client side mbedtls config") 
 # set(TFM_MBEDCRYPTO_PLATFORM_EXTRA_CONFIG_PATH ${CMAKE_CURRENT_LIST_DIR}/mbedtls_extra_config.h CACHE PATH "Extra config for MbedTLS")
 set(TFM_MBEDCRYPTO_PSA_CRYPTO_CONFIG_PATH ${CMAKE_CURRENT_LIST_DIR}/config_tinyml.h CACHE PATH "PSA crypto configuration file")
@@ -0,0 +1,13 @@
+/*
+ * MbedTLS configuration for TF-M crypto usage tracing (TFM_TINYML_CRYPTO_TRACE)
+ */
+
+#ifndef MBEDTLS_CONFIG_TRACE_H
+#define MBEDTLS_CONFIG_TRACE_H
+
+#include "mbedtls_config.h"
+
+/* Peak tracking of the engine heap, read by mbedtls_memory_buffer_alloc_max_get() */
+#define MBEDTLS_MEMORY_DEBUG
+
+#endif /* MBEDTLS_CONFIG_TRACE_H */
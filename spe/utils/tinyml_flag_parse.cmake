@@ -22,7 +22,12 @@ function(parse_tinyml_flag cmd_line)
     set(TFM_PARTITION_CRYPTO ON)
     set(TFM_PARTITION_PLATFORM ON)
     set(TFM_PARTITION_INITIAL_ATTESTATION ON)
-    set(TFM_PARTITION_ECHO_SERVICE ON)
+    # Echo service is an IPC model partition, the SFN backend only runs SFN partitions
+    if (CONFIG_TFM_SPM_BACKEND STREQUAL "SFN")
+        set(TFM_PARTITION_ECHO_SERVICE OFF)
+    else()
+        set(TFM_PARTITION_ECHO_SERVICE ON)
+    endif()
 
     # Out-of-tree partition configuration
     get_filename_component(PROJECT_ROOT "${CMAKE_SOURCE_DIR}/.." ABSOLUTE)
@@ -0,0 +1,16 @@
+/*
+ * Copyright (c) 2025, Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ */
+
+/* Host stand-in for the TF-M unprivileged log API used by tm_log.h */
+#ifndef __TFM_LOG_UNPRIV_H__
+#define __TFM_LOG_UNPRIV_H__
+
+#include <stdio.h>
+
+#define INFO_UNPRIV(...)    printf(__VA_ARGS__)
+
+#endif /* __TFM_LOG_UNPRIV_H__ */
@@ -0,0 +1,131 @@
+/*
+ * Copyright (c) 2025, Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ */
+
+/*
+ * Host test of the AOT model code (tools/tinymaix_aot.py): tm_aot_run and
+ * tm_aot_run_argmax against tm_run and tm_run_argmax of the interpreter on
+ * the model the code was generated for (TM_TEST_MODEL), outputs compared
+ * byte for byte over random inputs. tm_aot_check must reject the model
+ * once a baked weight scale changes. Built and run by tm_host_test.sh.
+ */
+
+#include "tinymaix.h"
+#include "tinymaix_model_aot.h"
+#include TM_TEST_MODEL
+
+#define TEST_INPUTS     (200)
+
+/* [0] interpreter, [1] AOT code; tm_load packs fc weights in place, one model copy each */
+static uint8_t g_bin[2][sizeof(mdl_data)] __attribute__((aligned(8)));
+static uint8_t g_buf[2][MDL_BUF_LEN] __attribute__((aligned(8)));
+static tm_mdl_t g_mdl[2];
+static tm_mat_t g_in[2];
+static int g_layers[2];
+
+static tm_err_t count_layer(tm_mdl_t* mdl, tml_head_t* lh)
+{
+    (void)lh;
+    g_layers[mdl == &g_mdl[1]]++;
+    return TM_OK;
+}
+
+/* Output bytes of a tm_run/tm_aot_run result */
+static size_t out_bytes(tm_mdl_t* mdl, tm_mat_t* out)
+{
+    size_t n = (size_t)out->h * out->w * out->c;
+    return mdl->b->out_deq ? n * sizeof(float) : n * sizeof(mtype_t);
+}
+
+/* First conv layer's first weight scale byte, 0 if the model has no conv */
+static size_t first_ws_offset(const uint8_t* bin)
+{
+    const tm_mdlbin_t* b = (const tm_mdlbin_t*)bin;
+    const uint8_t* body = b->layers_body;
+
+    for (int i = 0; i < b->layer_cnt; i++) {
+        const tml_conv2d_dw_t* l = (const tml_conv2d_dw_t*)body;
+        if (l->h.type == TML_CONV2D || l->h.type == TML_DWCONV2D) {
+            return (size_t)(body - bin) + l->ws_oft;
+        }
+        body += l->h.size;
+    }
+    return 0;
+}
+
+int main(void)
+{
+    tm_mat_t out[2];
+    int cls[2];
+    int fails = 0;
+    size_t n, ws;
+
+    for (int m = 0; m < 2; m++) {
+        memcpy(g_bin[m], mdl_data, sizeof(mdl_data));
+        if (tm_load(&g_mdl[m], g_bin[m], g_buf[m], count_layer, &g_in[m]) != TM_OK) {
+            printf("tm_aot_test: tm_load failed\n");
+            return 1;
+        }
+    }
+    if (tm_aot_check(&g_mdl[1]) != TM_OK) {
+        printf("tm_aot_test: tm_aot_check rejects the model it was generated for\n");
+        return 1;
+    }
+
+    n = (size_t)g_in[0].h * g_in[0].w * g_in[0].c;
+    srand(1);
+    for (int it = 0; it < TEST_INPUTS; it++) {
+        static mtype_t frame[MDL_BUF_LEN];
+        for (size_t i = 0; i < n; i++) {
+            frame[i] = (mtype_t)(rand() & 0xff);
+        }
+
+        g_layers[0] = g_layers[1] = 0;
+        memcpy(g_in[0].data, frame, n);
+        memcpy(g_in[1].data, frame, n);
+        if (tm_run(&g_mdl[0], &g_in[0], &out[0]) != TM_OK ||
+            tm_aot_run(&g_mdl[1], &g_in[1], &out[1]) != TM_OK) {
+            printf("tm_aot_test: input %d: run failed\n", it);
+            return 1;
+        }
+        if (out_bytes(&g_mdl[0], &out[0]) != out_bytes(&g_mdl[1], &out[1]) ||
+            memcmp(out[0].data, out[1].data, out_bytes(&g_mdl[0], &out[0])) != 0) {
+            printf("tm_aot_test: input %d: tm_aot_run output differs from tm_run\n", it);
+            fails++;
+        }
+        if (g_layers[0] != g_layers[1]) {
+            printf("tm_aot_test: input %d: %d layer callbacks, tm_run %d\n", it, g_layers[1], g_layers[0]);
+            fails++;
+        }
+
+        memcpy(g_in[0].data, frame, n);
+        memcpy(g_in[1].data, frame, n);
+        if (tm_run_argmax(&g_mdl[0], &g_in[0], &cls[0]) != TM_OK ||
+            tm_aot_run_argmax(&g_mdl[1], &g_in[1], &cls[1]) != TM_OK) {
+            printf("tm_aot_test: input %d: argmax run failed\n", it);
+            return 1;
+        }
+        if (cls[0] != cls[1]) {
+            printf("tm_aot_test: input %d: tm_aot_run_argmax class %d, tm_run_argmax %d\n", it, cls[1], cls[0]);
+            fails++;
+        }
+    }
+
+    ws = first_ws_offset(g_bin[1]);
+    if (ws) {
+        g_bin[1][ws] ^= 1;
+        if (tm_aot_check(&g_mdl[1]) == TM_OK) {
+            printf("tm_aot_test: tm_aot_check accepts a changed weight scale\n");
+            fails++;
+        }
+        g_bin[1][ws] ^= 1;
+    }
+
+    tm_unload(&g_mdl[0]);
+    tm_unload(&g_mdl[1]);
+    printf("tm_aot_test: %d random inputs, %s\n", TEST_INPUTS, fails ? "FAILED" : "bit-exact with the interpreter");
+    return fails != 0;
+}
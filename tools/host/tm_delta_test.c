@@ -0,0 +1,156 @@
+/*
+ * Copyright (c) 2025, Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ */
+
+/*
+ * Host test of incremental stream inference: tm_run_delta against a full
+ * tm_run/tm_run_argmax of the same frame, on a model planned with --delta
+ * (TM_TEST_MODEL). Frames are kept, fully replaced or edited in a few
+ * rows, partial and full delta runs both happen. After every frame the
+ * output tensor (or class) and the resident delta stack (the frame at buf
+ * offset 0 and the outputs of the delta_layers first layers) must equal
+ * the full run byte for byte. Built and run by tm_host_test.sh.
+ */
+
+#include "tinymaix.h"
+#include TM_TEST_MODEL
+
+#define TEST_FRAMES     (300)
+
+/* [0] tm_run_delta, [1] tm_run; tm_load packs fc weights in place, one model copy each */
+static uint8_t g_bin[2][sizeof(mdl_data)] __attribute__((aligned(8)));
+static uint8_t g_buf[2][MDL_BUF_LEN] __attribute__((aligned(8)));
+static tm_mdl_t g_mdl[2];
+static tm_mat_t g_in[2];
+static int g_layers[2];
+
+static tm_err_t count_layer(tm_mdl_t* mdl, tml_head_t* lh)
+{
+    (void)lh;
+    g_layers[mdl == &g_mdl[1]]++;
+    return TM_OK;
+}
+
+/* First layer of the resident delta stack that differs from the full run, -1: input frame, -2: none */
+static int stack_diff(size_t frame_size)
+{
+    const uint8_t* body = g_mdl[0].b->layers_body;
+
+    if (memcmp(g_buf[0], g_buf[1], frame_size) != 0) {
+        return -1;
+    }
+    for (int i = 0; i < g_mdl[0].b->delta_layers; i++) {
+        const tml_head_t* h = (const tml_head_t*)body;
+        size_t n = (size_t)h->out_dims[1] * h->out_dims[2] * h->out_dims[3] * sizeof(mtype_t);
+        if (memcmp(g_buf[0] + h->out_oft, g_buf[1] + h->out_oft, n) != 0) {
+            return i;
+        }
+        body += h->size;
+    }
+    return -2;
+}
+
+int main(void)
+{
+    static mtype_t frame[MDL_BUF_LEN];
+    tm_mat_t fm, out[2];
+    int cls[2];
+    int fails = 0, partial = 0, full = 0;
+    int rows, row;
+    size_t n;
+
+    for (int m = 0; m < 2; m++) {
+        memcpy(g_bin[m], mdl_data, sizeof(mdl_data));
+        if (tm_load(&g_mdl[m], g_bin[m], g_buf[m], count_layer, &g_in[m]) != TM_OK) {
+            printf("tm_delta_test: tm_load failed\n");
+            return 1;
+        }
+    }
+    if (g_mdl[0].b->delta_layers == 0) {
+        printf("tm_delta_test: model not planned with --delta\n");
+        return 1;
+    }
+
+    rows = g_in[0].h;
+    row = g_in[0].w * g_in[0].c;
+    n = (size_t)rows * row * sizeof(mtype_t);
+    memcpy(&fm, &g_in[0], sizeof(fm));
+    fm.data = frame;                    /* new frames come from outside main buf */
+    srand(7);
+    for (size_t i = 0; i < (size_t)rows * row; i++) {
+        frame[i] = (mtype_t)(rand() & 0xff);
+    }
+
+    for (int it = 0; it < TEST_FRAMES; it++) {
+        int kind = rand() % 5;
+        int argmax = it & 1;
+        tm_delta_t d = {0, (rand() % 4) ? 100 : 30, 0, 0, 0};
+        tm_err_t res[2];
+        int diff;
+
+        if (kind == 1) {                                /* new scene */
+            for (int i = 0; i < rows * row; i++) {
+                frame[i] = (mtype_t)(rand() & 0xff);
+            }
+        } else if (kind > 1) {                          /* a few rows, part of their width */
+            int r0 = rand() % rows, r1 = r0 + 1 + rand() % 3;
+            int c0 = rand() % row, c1 = c0 + 1 + rand() % row;
+            for (int r = r0; r < r1 && r < rows; r++) {
+                for (int c = c0; c < c1 && c < row; c++) {
+                    frame[r * row + c] = (mtype_t)(rand() & 0xff);
+                }
+            }
+        }                                               /* kind 0: same frame */
+
+        g_layers[0] = g_layers[1] = 0;
+        memcpy(g_in[1].data, frame, n);
+        if (argmax) {
+            res[0] = tm_run_delta(&g_mdl[0], &fm, NULL, &cls[0], &d);
+            res[1] = tm_run_argmax(&g_mdl[1], &g_in[1], &cls[1]);
+        } else {
+            res[0] = tm_run_delta(&g_mdl[0], &fm, &out[0], NULL, &d);
+            res[1] = tm_run(&g_mdl[1], &g_in[1], &out[1]);
+        }
+        if (res[0] != TM_OK || res[1] != TM_OK) {
+            printf("tm_delta_test: frame %d: run failed (%d, %d)\n", it, res[0], res[1]);
+            return 1;
+        }
+        if (d.full) {
+            full++;
+        } else {
+            partial++;
+        }
+
+        if (argmax && cls[0] != cls[1]) {
+            printf("tm_delta_test: frame %d: class %d, full run %d\n", it, cls[0], cls[1]);
+            fails++;
+        }
+        if (!argmax) {
+            size_t on = (size_t)out[1].h * out[1].w * out[1].c;
+            on *= g_mdl[1].b->out_deq ? sizeof(float) : sizeof(mtype_t);
+            if (memcmp(out[0].data, out[1].data, on) != 0) {
+                printf("tm_delta_test: frame %d: output differs (%d/%d tiles changed)\n", it, d.changed, d.tiles);
+                fails++;
+            }
+        }
+        diff = stack_diff(n);
+        if (diff != -2) {
+            printf("tm_delta_test: frame %d: resident %s %d differs (%d/%d tiles changed)\n", it,
+                   diff < 0 ? "input" : "layer", diff < 0 ? 0 : diff, d.changed, d.tiles);
+            fails++;
+        }
+        if (g_layers[0] != g_layers[1]) {
+            printf("tm_delta_test: frame %d: %d layer callbacks, full run %d\n", it, g_layers[0], g_layers[1]);
+            fails++;
+        }
+    }
+
+    printf("tm_delta_test: %s, %d frames (%d partial, %d full), %s\n", TM_TEST_MODEL, TEST_FRAMES,
+           partial, full, fails ? "FAILED" : "bit-exact with full runs");
+    tm_unload(&g_mdl[0]);
+    tm_unload(&g_mdl[1]);
+    return fails != 0;
+}
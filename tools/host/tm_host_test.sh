@@ -0,0 +1,46 @@
+#!/bin/bash
+
+# TinyMaix host tests: the library and the generated model code built for the
+# host with the secure partition's port config (tm_port.h)
+#   tm_aot_test    generated AOT code (models/tinymaix_model_aot.c) against the interpreter
+#   tm_delta_test  tm_run_delta against full runs, MNIST and a synthetic model (tm_synth_model.py)
+#                  planned with every possible --delta depth
+# build.sh runs them after the model code is generated. CC picks the host compiler.
+
+set -e
+
+PROJECT_ROOT=$(realpath "$(dirname "$(realpath "$0")")/../..")
+HOST_DIR="${PROJECT_ROOT}/tools/host"
+OUT_DIR="${PROJECT_ROOT}/build/host"
+TM_DIR="${PROJECT_ROOT}/partitions/tinymaix_inference"
+CC="${CC:-cc}"
+
+# _MATH_H: tm_port.h keeps libm out through the newlib _MATH_H_ guard, glibc's is _MATH_H
+CFLAGS="-O2 -w -D_MATH_H -DTM_LOG_LEVEL=TM_LOG_NONE \
+    -I${HOST_DIR} -I${TM_DIR} -I${TM_DIR}/tinymaix/include -I${TM_DIR}/tinymaix/src \
+    -I${PROJECT_ROOT}/models -I${PROJECT_ROOT}/interface/include"
+TM_SRC="${TM_DIR}/tinymaix/src/tm_model.c ${TM_DIR}/tinymaix/src/tm_layers.c ${TM_DIR}/tm_arena.c"
+
+mkdir -p "${OUT_DIR}"
+
+${CC} ${CFLAGS} -DTM_TEST_MODEL='"mnist_valid_q_planned.h"' -o "${OUT_DIR}/tm_aot_test" \
+    "${HOST_DIR}/tm_aot_test.c" "${PROJECT_ROOT}/models/tinymaix_model_aot.c" ${TM_SRC}
+"${OUT_DIR}/tm_aot_test"
+
+# delta_test <model header> <name> <delta depth>
+delta_test() {
+    python3 "${PROJECT_ROOT}/tools/tinymaix_mem_planner.py" --input "$1" \
+        --output "${OUT_DIR}/$2_delta$3.h" --mem-header "${OUT_DIR}/$2_delta$3_mem.h" \
+        --delta $3 --fuse auto > /dev/null
+    ${CC} ${CFLAGS} -I"${OUT_DIR}" -DTM_TEST_MODEL="\"$2_delta$3.h\"" -o "${OUT_DIR}/tm_delta_test" \
+        "${HOST_DIR}/tm_delta_test.c" ${TM_SRC}
+    "${OUT_DIR}/tm_delta_test"
+}
+
+python3 "${HOST_DIR}/tm_synth_model.py" --output "${OUT_DIR}/synth.h" > /dev/null
+for DELTA in 1 2 3; do
+    delta_test "${PROJECT_ROOT}/models/mnist_valid_q.h" mnist ${DELTA}
+done
+for DELTA in 1 2 3 4; do
+    delta_test "${OUT_DIR}/synth.h" synth ${DELTA}
+done
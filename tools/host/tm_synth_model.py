@@ -0,0 +1,114 @@
+#!/usr/bin/env python3
+"""
+Synthetic TinyMAIX INT8 Model for the Host Tests
+
+The MNIST model only has stride 2 convs without padding. This writes a small
+model with random weights whose leading conv stack goes through the other
+paths tm_run_delta recomputes rows with:
+
+    L0 CONV2D    9x9x3  -> 9x9x4    k3 s1, same padding, relu
+    L1 DWCONV2D  9x9x4  -> 5x5x8    k3 s2, same padding, depth multiplier 2, relu6
+    L2 CONV2D    5x5x8  -> 5x5x12   pointwise
+    L3 CONV2D    5x5x12 -> 3x3x6    k3 s2, same padding, relu
+    L4 GAP, L5 FC, L6 SOFTMAX       dequantised output
+
+Activation offsets are plain ping-pong, plan the model with
+tinymaix_mem_planner.py before use.
+
+Usage:
+    python tm_synth_model.py --output build/host/synth.h [--seed 1]
+"""
+
+import argparse
+import os
+import random
+import struct
+import sys
+
+sys.path.insert(0, os.path.join(os.path.dirname(os.path.realpath(__file__)), '..'))
+from tinymaix_model import (align, save_header, MDL_MAGIC, MDLBIN_HDR_SIZE, LAYER_HDR_SIZE,
+                            TML_CONV2D, TML_DWCONV2D, TML_FC, TML_GAP, TML_SOFTMAX)
+
+BUF_SIZE = 640
+ACT_NONE, ACT_RELU, ACT_RELU6 = 0, 1, 3
+
+
+def head(ltype, is_out, size, in_oft, out_oft, in_dims, out_dims, in_s, in_zp, out_s, out_zp) -> bytes:
+    """tml_head_t"""
+    return struct.pack('<HHIII4H4Hfifi', ltype, is_out, size, in_oft, out_oft, *in_dims, *out_dims,
+                       in_s, in_zp, out_s, out_zp)
+
+
+def int8s(n: int) -> bytes:
+    return bytes(random.randint(0, 255) for _ in range(n))
+
+
+def conv(ltype, in_oft, out_oft, in_dims, out_dims, k, s, pad, dmul, act, in_s, out_s) -> bytes:
+    """tml_conv2d_dw_t with per-channel weight scales, weights and biases"""
+    cho = out_dims[3]
+    chi = 1 if dmul else in_dims[3]
+    ws = struct.pack(f'<{cho}f', *[random.uniform(0.002, 0.02) for _ in range(cho)])
+    w = int8s(cho * chi * k * k)
+    b = struct.pack(f'<{cho}i', *[random.randint(-3000, 3000) for _ in range(cho)])
+    ws_oft = LAYER_HDR_SIZE + 32
+    w_oft = align(ws_oft + len(ws))
+    b_oft = align(w_oft + len(w))
+    size = align(b_oft + len(b))
+    body = bytearray(size)
+    body[0:LAYER_HDR_SIZE] = head(ltype, 0, size, in_oft, out_oft, in_dims, out_dims,
+                                  in_s, random.randint(-128, -100), out_s, -128)
+    body[LAYER_HDR_SIZE:ws_oft] = struct.pack('<6BH4BIIIII', k, k, s, s, 1, 1, act, *pad, dmul, 0,
+                                              ws_oft, w_oft, b_oft)
+    body[ws_oft:ws_oft + len(ws)] = ws
+    body[w_oft:w_oft + len(w)] = w
+    body[b_oft:b_oft + len(b)] = b
+    return bytes(body)
+
+
+def fc(in_oft, out_oft, k, n, in_s, out_s, out_zp) -> bytes:
+    """tml_fc_t, row major weights"""
+    w = int8s(n * k)
+    b = struct.pack(f'<{n}i', *[random.randint(-2000, 2000) for _ in range(n)])
+    ws_oft = LAYER_HDR_SIZE + 16
+    w_oft = align(ws_oft + 4)
+    b_oft = align(w_oft + len(w))
+    size = align(b_oft + len(b))
+    body = bytearray(size)
+    body[0:LAYER_HDR_SIZE] = head(TML_FC, 0, size, in_oft, out_oft, (1, 1, 1, k), (1, 1, 1, n),
+                                  in_s, -128, out_s, out_zp)
+    body[LAYER_HDR_SIZE:ws_oft] = struct.pack('<IIII', ws_oft, w_oft, b_oft, 0)
+    body[ws_oft:ws_oft + 4] = struct.pack('<f', 0.01)
+    body[w_oft:w_oft + len(w)] = w
+    body[b_oft:b_oft + len(b)] = b
+    return bytes(body)
+
+
+def synth_model() -> bytes:
+    layers = [
+        conv(TML_CONV2D, 0, 256, (3, 9, 9, 3), (3, 9, 9, 4), 3, 1, (1, 1, 1, 1), 0, ACT_RELU, 0.02, 0.03),
+        conv(TML_DWCONV2D, 256, 0, (3, 9, 9, 4), (3, 5, 5, 8), 3, 2, (1, 1, 1, 1), 2, ACT_RELU6, 0.03, 0.04),
+        conv(TML_CONV2D, 0, 256, (3, 5, 5, 8), (3, 5, 5, 12), 1, 1, (0, 0, 0, 0), 0, ACT_NONE, 0.04, 0.05),
+        conv(TML_CONV2D, 256, 0, (3, 5, 5, 12), (3, 3, 3, 6), 3, 2, (1, 1, 1, 1), 0, ACT_RELU, 0.05, 0.06),
+        head(TML_GAP, 0, LAYER_HDR_SIZE, 0, 64, (3, 3, 3, 6), (1, 1, 1, 6), 0.06, -128, 0.07, -128),
+        fc(64, 80, 6, 11, 0.07, 0.1, 3),
+        head(TML_SOFTMAX, 1, LAYER_HDR_SIZE, 80, 96, (1, 1, 1, 11), (1, 1, 1, 11), 0.1, 3, 1 / 256, -128),
+    ]
+    hdr = struct.pack('<IBBHHHII4H4H', MDL_MAGIC, 0, 1, 1, 1, len(layers), BUF_SIZE, 0,
+                      3, 9, 9, 3, 1, 1, 1, 11)
+    hdr += bytes(MDLBIN_HDR_SIZE - len(hdr))
+    return hdr + b''.join(layers)
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Write a synthetic TinyMAIX INT8 model header')
+    parser.add_argument('--output', '-o', required=True, help='Output model header (.h)')
+    parser.add_argument('--seed', type=int, default=1, help='Random seed of weights and zero points (default 1)')
+    args = parser.parse_args()
+
+    random.seed(args.seed)
+    save_header(args.output, synth_model(), 'mdl_data', {'MDL_BUF_LEN': BUF_SIZE, 'LBUF_LEN': 0})
+    print(f"Synthetic model saved: {args.output}")
+
+
+if __name__ == '__main__':
+    main()
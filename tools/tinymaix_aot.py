@@ -0,0 +1,529 @@
+#!/usr/bin/env python3
+"""
+TinyMAIX Ahead-of-Time Model Compiler
+
+tm_run() interprets the model binary: every shape, stride, pad and scale is
+read from memory at run time. This tool reads a TinyMAIX model header and
+emits C with one function per layer, where loop bounds, kernel sizes and
+requant constants are literals, so the compiler can unroll and fold them.
+
+The generated code is a drop-in alternative to the interpreter:
+
+- the model is still loaded with tm_load() (arena, softmax LUT, fc packing)
+- weights and biases stay in the (decrypted) model blob and are bound at
+  run time through literal offsets from mdl->b
+- activations use the planned offsets in mdl->buf, patch based stacks run
+  band by band from a literal band table
+- <prefix>_run()/<prefix>_run_argmax() match tm_run()/tm_run_argmax(), layer
+  callbacks included
+- fused layer pairs follow tm_run() with TM_FUSE_LAYERS: conv+GAP runs
+  row by row into the planned one row buffer, GAP+FC and FC+SOFTMAX keep
+  the intermediate in a local array
+- <prefix>_check() fingerprints the model header, the layer parameters and
+  the weight scales baked in as literals, so code generated for another
+  model (or a re-quantised one) is rejected at load time
+
+Only INT8 models are compiled (the build config of the secure partition).
+Conv/dwconv/pointwise, GAP and FC are specialised; softmax and add call the
+library kernels (LUT and fixed point paths set up by tm_load). Results are
+bit-exact with the interpreter for both TM_FASTSCALE settings.
+
+Usage:
+    python tinymaix_aot.py --input models/mnist_valid_q_planned.h \\
+        --output models/tinymaix_model_aot.c --header models/tinymaix_model_aot.h
+"""
+
+import argparse
+import os
+import sys
+from typing import List
+
+from tinymaix_model import (Model, dims_size, fuse_kind, fuse_scan, load_header, patch_bands, LAYER_HDR_SIZE,
+                            TML_ADD, TML_CONV2D, TML_DWCONV2D, TML_FC, TML_GAP, TML_RESHAPE, TML_SOFTMAX)
+
+FNV_OFFSET = 0x811C9DC5
+FNV_PRIME = 0x01000193
+FINGERPRINT_HDR = 46    # tm_mdlbin_t up to patch_layers/patch_rows/fuse_mask/delta_layers
+CONV_PARAMS_SIZE = 32   # tml_conv2d_dw_t after the layer head: kernel .. b_oft
+FC_PARAMS_SIZE = 12     # tml_fc_t ws_oft, w_oft, b_oft; w_pack is rewritten by tm_load
+ADD_PARAMS_SIZE = 12    # tml_add_t in_oft1, in_s1, in_zp1
+MAX_CSIZE = 16          # TM_MAX_CSIZE of tm_port.h, bounds fused intermediates
+
+
+def cfloat(x: float) -> str:
+    """Exact C float literal."""
+    return f"{float(x).hex()}f"
+
+
+def fnv1a(data: bytes, h: int = FNV_OFFSET) -> int:
+    for b in data:
+        h = ((h ^ b) * FNV_PRIME) & 0xFFFFFFFF
+    return h
+
+
+def fingerprint_spans(model: Model) -> List[tuple]:
+    """(layer, start, length) of every layer byte the generated code depends on, start from the layer start:
+    the layer head, the layer parameters and the weight scales baked in as literals."""
+    spans = []
+    for l in model.layers:
+        spans.append((l.index, 0, LAYER_HDR_SIZE))
+        if l.is_conv:
+            spans.append((l.index, LAYER_HDR_SIZE, CONV_PARAMS_SIZE))
+            spans.append((l.index, l.ws_oft, 4 * l.out_dims[3]))
+        elif l.type == TML_FC:
+            spans.append((l.index, LAYER_HDR_SIZE, FC_PARAMS_SIZE))
+            spans.append((l.index, l.ws_oft, 4))
+        elif l.type == TML_ADD:
+            spans.append((l.index, LAYER_HDR_SIZE, ADD_PARAMS_SIZE))
+    return spans
+
+
+def fingerprint(model: Model) -> int:
+    """FNV-1a over the model header and the fingerprint spans of every layer."""
+    h = fnv1a(model.data[:FINGERPRINT_HDR])
+    for i, start, length in fingerprint_spans(model):
+        h = fnv1a(model.layers[i].body(start, length), h)
+    return h
+
+
+class AotCompiler:
+    """Emit specialised C for one TinyMAIX INT8 model."""
+
+    def __init__(self, model: Model, prefix: str, source: str, header: str, max_c: int = MAX_CSIZE):
+        if model.type_name != "INT8":
+            raise ValueError(f"Only INT8 models are supported, got {model.type_name}")
+        self.fuse = fuse_scan(model, max(model.patch_layers, model.delta_layers), max_c)
+        if model.fuse_mask & ~self.fuse:
+            raise ValueError(f"Planned fuse_mask 0x{model.fuse_mask:x} needs TM_MAX_CSIZE above {max_c}")
+        self.model = model
+        self.prefix = prefix
+        self.source = source
+        self.header = header
+        self.out: List[str] = []
+
+    def emit(self, line: str = ""):
+        self.out.append(line)
+
+    def fn(self, layer) -> str:
+        return f"{self.prefix}_l{layer.index}"
+
+    # ---------------------------------------------------------------- layers
+
+    def conv(self, l):
+        """Conv/dwconv/pointwise: rows [oy0, oy1) of the output, in holds input rows from iy0."""
+        p = self.prefix
+        ih, iw, chi = l.in_dims[1], l.in_dims[2], l.in_dims[3]
+        oh, ow, cho = l.out_dims[1], l.out_dims[2], l.out_dims[3]
+        kh, kw, sy, sx = l.kernel_h, l.kernel_w, l.stride_h, l.stride_w
+        pt, pl = l.pad[0], l.pad[2]
+        dmul = l.depth_mul
+        if l.dilation_w != 1 or l.dilation_h != 1:
+            raise ValueError(f"Layer {l.index}: dilation is not supported")
+        ws = l.floats(l.ws_oft, cho)
+        base = l.offset
+        # any tap outside the input? (same padding) only then bounds checks are needed
+        padded = pt > 0 or pl > 0 or (oh - 1) * sy - pt + kh > ih or (ow - 1) * sx - pl + kw > iw
+        kind = "DWCONV2D" if dmul else ("PWCONV2D" if kh * kw == 1 else "CONV2D")
+
+        self.emit(f"//{kind} {ih}x{iw}x{chi} -> {oh}x{ow}x{cho}, k{kw}x{kh} s{sx}x{sy} "
+                  f"pad {l.pad[0]},{l.pad[1]},{l.pad[2]},{l.pad[3]} act {l.act}")
+        self.emit(f"static void {self.fn(l)}(const uint8_t* bin, const mtype_t* in, int iy0, "
+                  f"mtype_t* out, int oy0, int oy1)")
+        self.emit("{")
+        self.emit("#if TM_FASTSCALE")
+        self.emit(f"    static const int32_t sc[{cho}] = {{")
+        for c in range(cho):
+            self.emit(f"        (int32_t)(1.0/{cfloat(ws[c])}/{cfloat(l.in_s)}),")
+        self.emit("    };")
+        self.emit(f"    const int32_t os = (int32_t)((1<<TM_FASTSCALE_SHIFT)/{cfloat(l.out_s)});")
+        self.emit("#else")
+        self.emit(f"    static const float sc[{cho}] = {{")
+        for c in range(cho):
+            self.emit(f"        {cfloat(ws[c])}*{cfloat(l.in_s)},")
+        self.emit("    };")
+        self.emit(f"    const float os = 1.f/{cfloat(l.out_s)};")
+        self.emit("#endif")
+        self.emit(f"    const wtype_t* w = (const wtype_t*)(bin + {base + l.w_oft});")
+        self.emit(f"    const btype_t* b = (const btype_t*)(bin + {base + l.b_oft});")
+        self.emit("    for(int y=oy0; y<oy1; y++){")
+        self.emit(f"        for(int x=0; x<{ow}; x++){{")
+        self.emit(f"            for(int c=0; c<{cho}; c++){{")
+        self.emit("                sumtype_t sum = 0;")
+        if dmul:
+            ci_loop, ci, kidx = None, f"c/{dmul}", f"c*{kh * kw}+ky*{kw}+kx"
+        else:
+            ci_loop, ci, kidx = "i", "i", f"(c*{chi}+i)*{kh * kw}+ky*{kw}+kx"
+        self.emit(f"                for(int ky=0; ky<{kh}; ky++){{")
+        self.emit(f"                    int iy = y*{sy}-{pt}+ky;")
+        self.emit(f"                    for(int kx=0; kx<{kw}; kx++){{")
+        self.emit(f"                        int ix = x*{sx}-{pl}+kx;")
+        indent = "                        "
+        if ci_loop:
+            self.emit(f"{indent}for(int i=0; i<{chi}; i++){{")
+            indent += "    "
+        src = f"in[((iy-iy0)*{iw}+ix)*{chi}+{ci}]"
+        if padded:
+            self.emit(f"{indent}sumtype_t s = (iy>=0 && iy<{ih} && ix>=0 && ix<{iw}) ? {src} : {l.in_zp};")
+            self.emit(f"{indent}sum += s*w[{kidx}];")
+        else:
+            self.emit(f"{indent}sum += {src}*w[{kidx}];")
+        if ci_loop:
+            self.emit("                        }")
+        self.emit("                    }")
+        self.emit("                }")
+        self.emit(f"                *out++ = {p}_conv_post(sum + b[c], sc[c], os, {l.act}, {l.out_zp});")
+        self.emit("            }")
+        self.emit("        }")
+        self.emit("    }")
+        self.emit("}")
+        self.emit()
+
+    def gap(self, l):
+        ih, iw, c = l.in_dims[1], l.in_dims[2], l.in_dims[3]
+        self.emit(f"//GAP {ih}x{iw}x{c} -> {c}")
+        self.emit(f"static void {self.fn(l)}(const mtype_t* in, mtype_t* out)")
+        self.emit("{")
+        self.emit(f"    for(int c=0; c<{c}; c++){{")
+        self.emit("        sumtype_t sum = 0;")
+        self.emit(f"        for(int i=0; i<{ih * iw}; i++) sum += in[i*{c}+c];")
+        self.emit(f"        out[c] = (mtype_t)((sum/{ih * iw}-({l.in_zp}))*{cfloat(l.in_s)}/{cfloat(l.out_s)} + ({l.out_zp}));")
+        self.emit("    }")
+        self.emit("}")
+        self.emit()
+
+    def conv_gap(self, l, g):
+        """Fused conv+GAP: conv rows one at a time into row, channel sums kept in registers/stack."""
+        oh, ow, c = l.out_dims[1], l.out_dims[2], l.out_dims[3]
+        self.emit(f"//{l.name} + GAP fused, {oh} rows of {ow}x{c}")
+        self.emit(f"static void {self.fn(l)}_gap(const uint8_t* bin, const mtype_t* in, mtype_t* row, mtype_t* out)")
+        self.emit("{")
+        self.emit(f"    sumtype_t sum[{c}] = {{0}};")
+        self.emit(f"    for(int y=0; y<{oh}; y++){{")
+        self.emit(f"        {self.fn(l)}(bin, in, 0, row, y, y+1);")
+        self.emit(f"        for(int i=0; i<{ow}; i++)")
+        self.emit(f"            for(int c=0; c<{c}; c++) sum[c] += row[i*{c}+c];")
+        self.emit("    }")
+        self.emit(f"    for(int c=0; c<{c}; c++)")
+        self.emit(f"        out[c] = (mtype_t)((sum[c]/{oh * ow}-({g.in_zp}))*{cfloat(g.in_s)}/{cfloat(g.out_s)} + ({g.out_zp}));")
+        self.emit("}")
+        self.emit()
+
+    def fc(self, l):
+        k, n = l.in_dims[3], l.out_dims[3]
+        ws0 = l.floats(l.ws_oft, 1)[0]
+        n4 = n // 4 * 4
+        base = l.offset
+        self.emit(f"//FC {k} -> {n}, same arithmetic as tml_fc()")
+        self.emit(f"static void {self.fn(l)}(const uint8_t* bin, const mtype_t* in, mtype_t* out)")
+        self.emit("{")
+        self.emit(f"    const wtype_t* w = (const wtype_t*)(bin + {base + l.w_oft});")
+        self.emit(f"    const btype_t* b = (const btype_t*)(bin + {base + l.b_oft});")
+        self.emit(f"    int packed = ((const tml_fc_t*)(bin + {base}))->w_pack == TML_FC_PACK4;   //tm_load may pack")
+        self.emit(f"    for(int c=0; c<{n}; c++){{")
+        self.emit("        sumtype_t sum = 0;")
+        if n4:
+            self.emit(f"        if(packed && c < {n4}) {{")
+            self.emit(f"            const wtype_t* k = w + (c/4)*{4 * k} + c%4;")
+            self.emit(f"            for(int i=0; i<{k}; i++) sum += in[i]*k[i*4];")
+            self.emit("        } else {")
+            self.emit(f"            for(int i=0; i<{k}; i++) sum += in[i]*w[c*{k}+i];")
+            self.emit("        }")
+        else:
+            self.emit("        (void)packed;")
+            self.emit(f"            for(int i=0; i<{k}; i++) sum += in[i]*w[c*{k}+i];")
+        self.emit("        sum += b[c];")
+        self.emit(f"        out[c] = (mtype_t)(sum*{cfloat(l.in_s)}*{cfloat(ws0)}/{cfloat(l.out_s)} + ({l.out_zp}));")
+        self.emit("    }")
+        self.emit("}")
+        self.emit()
+
+    # ------------------------------------------------------------------ run
+
+    def inp(self, l) -> str:
+        """Input pointer of layer l: caller input, fused local array or planned offset."""
+        if l.index == 0:
+            return "in->data"
+        if fuse_kind(self.model, self.fuse, l.index - 1) == 'redirect':
+            return f"fz[{(l.index - 1) & 1}]"
+        return f"(mtype_t*)(buf + {l.in_oft})"
+
+    def outp(self, l) -> str:
+        if fuse_kind(self.model, self.fuse, l.index) == 'redirect':
+            return f"fz[{l.index & 1}]"
+        return f"(mtype_t*)(buf + {l.out_oft})"
+
+    def call(self, l) -> List[str]:
+        """Statements running layer l, input and output at their planned offsets."""
+        inp, outp = self.inp(l), self.outp(l)
+        if fuse_kind(self.model, self.fuse, l.index) == 'conv_gap':
+            g = self.model.layers[l.index + 1]
+            return [f"{self.fn(l)}_gap(bin, {inp}, {outp}, {self.outp(g)});   //fused with L{g.index}"]
+        if fuse_kind(self.model, self.fuse, l.index - 1) == 'conv_gap':
+            return [f"//L{l.index} done in L{l.index - 1}"]
+        if l.is_conv:
+            return [f"{self.fn(l)}(bin, {inp}, 0, {outp}, 0, {l.out_dims[1]});"]
+        if l.type == TML_GAP:
+            return [f"{self.fn(l)}({inp}, {outp});"]
+        if l.type == TML_FC:
+            return [f"{self.fn(l)}(bin, {inp}, {outp});"]
+        if l.type == TML_RESHAPE:
+            if l.in_oft == l.out_oft:
+                return ["//reshape: no copy"]
+            return [f"memmove({outp}, {inp}, {dims_size(l.out_dims)}*sizeof(mtype_t));   //reshape: copy"]
+        lines = ["{"]
+        d, o = l.in_dims, l.out_dims
+        lines.append(f"    tm_mat_t _in = {{{d[0]}, {d[1]}, {d[2]}, {d[3]}, {{{inp}}}}};")
+        lines.append(f"    tm_mat_t _out = {{{o[0]}, {o[1]}, {o[2]}, {o[3]}, {{{outp}}}}};")
+        if l.type == TML_SOFTMAX:
+            lines.append(f"    res = tml_softmax(&_in, &_out, {cfloat(l.in_s)}, {l.in_zp}, {cfloat(l.out_s)}, {l.out_zp});")
+        elif l.type == TML_ADD:
+            lines.append(f"    tm_mat_t _in1 = {{{d[0]}, {d[1]}, {d[2]}, {d[3]}, {{(mtype_t*)(buf + {l.in_oft1})}}}};")
+            lines.append(f"    res = tml_add(&_in, &_in1, &_out, {cfloat(l.in_s)}, {l.in_zp}, "
+                         f"{cfloat(l.in_s1)}, {l.in_zp1}, {cfloat(l.out_s)}, {l.out_zp});")
+        else:
+            raise ValueError(f"Layer {l.index}: unsupported type {l.name}")
+        lines.append("    if(res != TM_OK) return res;")
+        lines.append("}")
+        return lines
+
+    def patch_stack(self):
+        """Band table and band loop of the patch based stack, mirrors tm_run_patch()."""
+        m = self.model
+        n = m.patch_layers
+        stack = m.layers[:n]
+        bands = list(patch_bands(stack, m.patch_rows))
+        self.emit(f"//patch based stack: layers 0..{n - 1}, {m.patch_rows} output rows per band")
+        self.emit(f"//per band and layer: in_row0, out_row0, out_row1")
+        self.emit(f"static const uint16_t {self.prefix}_bands[{len(bands)}][{n}][3] = {{")
+        for band in bands:
+            self.emit("    {" + ", ".join(f"{{{ri0}, {ro0}, {ro1}}}" for ri0, _, ro0, ro1 in band) + "},")
+        self.emit("};")
+        self.emit()
+        self.emit(f"static void {self.prefix}_patch(const uint8_t* bin, uint8_t* buf, const mtype_t* in)")
+        self.emit("{")
+        self.emit(f"    for(int r=0; r<{len(bands)}; r++){{")
+        self.emit(f"        const uint16_t (*t)[3] = {self.prefix}_bands[r];")
+        for j, l in enumerate(stack):
+            w, c = l.in_dims[2], l.in_dims[3]
+            inp = f"in + t[0][0]*{w * c}" if j == 0 else f"(const mtype_t*)(buf + {l.in_oft})"
+            ow, oc = l.out_dims[2], l.out_dims[3]
+            outp = f"(mtype_t*)(buf + {l.out_oft})" + (f" + t[{j}][1]*{ow * oc}" if j == n - 1 else "")
+            self.emit(f"        {self.fn(l)}(bin, {inp}, t[{j}][0], {outp}, t[{j}][1], t[{j}][2]);")
+        self.emit("    }")
+        self.emit("}")
+        self.emit()
+
+    def body(self, argmax: bool) -> List[str]:
+        """Statements of <prefix>_run (argmax=False) or <prefix>_run_argmax."""
+        m = self.model
+        n = m.patch_layers
+        lines = []
+        out_idx = 0
+        fz = [dims_size(l.out_dims) for l in m.layers if fuse_kind(m, self.fuse, l.index) == 'redirect']
+        if fz:
+            lines.append(f"mtype_t fz[2][{max(fz)}];    //fused intermediates")
+        if n:
+            lines.append(f"{self.prefix}_patch(bin, buf, in->data);")
+            lines += [f"TM_AOT_CB({l.index}, {l.offset});" for l in m.layers[:n]]
+        for l in m.layers[n:]:
+            if l.is_noop:
+                lines.append(f"//L{l.index} {l.name}: folded, no copy")
+                continue
+            inp = self.inp(l)
+            size = dims_size(l.out_dims)
+            if argmax and l.is_out and l.type == TML_SOFTMAX:
+                lines.append(f"*cls = {self.prefix}_argmax({inp}, {dims_size(l.in_dims)});   //softmax is monotonic")
+                lines.append("return TM_OK;")
+                return lines
+            lines += self.call(l)
+            lines.append(f"TM_AOT_CB({l.index}, {l.offset});")
+            if not l.is_out:
+                continue
+            outd = f"(mtype_t*)(buf + {l.out_oft})"
+            if argmax:
+                lines.append(f"*cls = {self.prefix}_argmax({outd}, {size});")
+                lines.append("return TM_OK;")
+                return lines
+            lines.append("{")
+            lines.append(f"    mtype_t* o = {outd};")
+            lines.append(f"    out[{out_idx}].dims = {l.out_dims[0]}; out[{out_idx}].h = {l.out_dims[1]}; "
+                         f"out[{out_idx}].w = {l.out_dims[2]}; out[{out_idx}].c = {l.out_dims[3]};")
+            if m.out_deq:
+                lines.append(f"    float* f = (float*)(TM_ALIGN(o + {size}));")
+                lines.append(f"    for(int i=0; i<{size}; i++) f[i] = ((sumtype_t)o[i]-({l.out_zp}))*{cfloat(l.out_s)};")
+                lines.append(f"    out[{out_idx}].dataf = f;")
+            else:
+                lines.append(f"    out[{out_idx}].data = o;")
+            lines.append("}")
+            out_idx += 1
+        lines.append("return TM_ERR;   //no output layer" if argmax else "return TM_OK;")
+        return lines
+
+    def generate(self) -> str:
+        m = self.model
+        p = self.prefix
+        for l in m.layers:
+            if l.type not in (TML_CONV2D, TML_DWCONV2D, TML_GAP, TML_FC, TML_SOFTMAX, TML_RESHAPE, TML_ADD):
+                raise ValueError(f"Layer {l.index}: unsupported type {l.name}")
+        self.emit("/* Auto-generated TinyMAIX ahead-of-time model code */")
+        self.emit(f"/* Generated by tinymaix_aot.py from {self.source}, do not edit */")
+        self.emit()
+        self.emit('#include "tinymaix.h"')
+        self.emit(f'#include "{self.header}"')
+        self.emit()
+        self.emit("#if TM_MDL_TYPE != TM_MDL_INT8")
+        self.emit('#error "AOT model code is generated for INT8 models"')
+        self.emit("#endif")
+        self.emit()
+        self.emit("//layer callback, same order and arguments as tm_run()")
+        self.emit("#define TM_AOT_CB(i, oft) do{ mdl->layer_i = (i); mdl->layer_body = (uint8_t*)bin + (oft); \\")
+        self.emit("    if(mdl->cb) ((tm_cb_t)mdl->cb)(mdl, (tml_head_t*)(mdl->layer_body)); }while(0)")
+        self.emit()
+        self.emit("//conv bias+requant+act, same arithmetic as tm_postprocess_sum()")
+        self.emit("#if TM_FASTSCALE")
+        self.emit(f"TM_INLINE mtype_t {p}_conv_post(sumtype_t sum, int32_t sc, int32_t os, int act, zptype_t zp)")
+        self.emit("{")
+        self.emit("    sumtype_t sumf = (sum<<TM_FASTSCALE_SHIFT)/sc;")
+        self.emit("    if(act == TM_ACT_RELU || act == TM_ACT_RELU6) sumf = sumf>0?sumf:0;")
+        self.emit("    if(act == TM_ACT_RELU6) sumf = sumf>(6<<TM_FASTSCALE_SHIFT)?(6<<TM_FASTSCALE_SHIFT):sumf;")
+        self.emit("    return (mtype_t)(((sumf*os)>>(TM_FASTSCALE_SHIFT+TM_FASTSCALE_SHIFT))+zp);")
+        self.emit("}")
+        self.emit("#else")
+        self.emit(f"TM_INLINE mtype_t {p}_conv_post(sumtype_t sum, float sc, float os, int act, zptype_t zp)")
+        self.emit("{")
+        self.emit("    float sumf = sum*sc;")
+        self.emit("    if(act == TM_ACT_RELU || act == TM_ACT_RELU6) sumf = sumf>0?sumf:0;")
+        self.emit("    if(act == TM_ACT_RELU6) sumf = sumf>6?6:sumf;")
+        self.emit("    return (mtype_t)(sumf*os + zp);")
+        self.emit("}")
+        self.emit("#endif")
+        self.emit()
+        self.emit(f"static int {p}_argmax(const mtype_t* data, int size)")
+        self.emit("{")
+        self.emit("    int maxi = 0;")
+        self.emit("    for(int i=1; i<size; i++) if(data[i] > data[maxi]) maxi = i;")
+        self.emit("    return maxi;")
+        self.emit("}")
+        self.emit()
+        for l in m.layers:
+            self.emit(f"/* L{l.index} {l.name} */")
+            if l.is_conv:
+                self.conv(l)
+                if fuse_kind(m, self.fuse, l.index) == 'conv_gap':
+                    self.conv_gap(l, m.layers[l.index + 1])
+            elif l.type == TML_GAP and fuse_kind(m, self.fuse, l.index - 1) == 'conv_gap':
+                self.emit("//fused into the previous conv")
+                self.emit()
+            elif l.type == TML_GAP:
+                self.gap(l)
+            elif l.type == TML_FC:
+                self.fc(l)
+            else:
+                self.emit("//library kernel, called from the run functions")
+                self.emit()
+        if m.patch_layers:
+            self.patch_stack()
+
+        spans = fingerprint_spans(m)
+        self.emit("//fingerprinted bytes: layer, start from the layer start, length")
+        self.emit("//layer head and parameters, weight scales baked in above")
+        self.emit(f"static const uint32_t {p}_fp_spans[{len(spans)}][3] = {{")
+        for span in spans:
+            self.emit("    {" + ", ".join(str(v) for v in span) + "},")
+        self.emit("};")
+        self.emit()
+        self.emit(f"tm_err_t {p}_check(tm_mdl_t* mdl)")
+        self.emit("{")
+        self.emit("    const uint8_t* bin = (const uint8_t*)mdl->b;")
+        self.emit(f"    uint32_t h = 0x{FNV_OFFSET:08X}u;")
+        self.emit("    int s = 0;")
+        self.emit(f"    if(mdl->b->layer_cnt != {len(m.layers)}) return TM_ERR_MDLTYPE;")
+        self.emit(f"    for(int i=0; i<{FINGERPRINT_HDR}; i++) h = (h ^ bin[i])*0x{FNV_PRIME:08X}u;")
+        self.emit("    bin = mdl->b->layers_body;")
+        self.emit(f"    for(int l=0; l<{len(m.layers)}; l++){{")
+        self.emit("        uint32_t size = ((const tml_head_t*)bin)->size;")
+        self.emit(f"        for(; s<{len(spans)} && {p}_fp_spans[s][0]==(uint32_t)l; s++){{")
+        self.emit(f"            const uint32_t* sp = {p}_fp_spans[s];")
+        self.emit("            if(sp[1] + sp[2] > size) return TM_ERR_MDLTYPE;")
+        self.emit(f"            for(uint32_t i=0; i<sp[2]; i++) h = (h ^ bin[sp[1]+i])*0x{FNV_PRIME:08X}u;")
+        self.emit("        }")
+        self.emit("        bin += size;")
+        self.emit("    }")
+        self.emit(f"    return h == 0x{fingerprint(m):08X}u ? TM_OK : TM_ERR_MDLTYPE;")
+        self.emit("}")
+        self.emit()
+        for name, sig, argmax in ((f"{p}_run", "tm_mat_t* out", False),
+                                  (f"{p}_run_argmax", "int* cls", True)):
+            self.emit(f"tm_err_t {name}(tm_mdl_t* mdl, tm_mat_t* in, {sig})")
+            self.emit("{")
+            self.emit("    const uint8_t* bin = (const uint8_t*)mdl->b;")
+            self.emit("    uint8_t* buf = mdl->buf;")
+            self.emit("    tm_err_t res = TM_OK;")
+            self.emit("    (void)res;")
+            for line in self.body(argmax):
+                self.emit("    " + line)
+            self.emit("}")
+            self.emit()
+        return "\n".join(self.out)
+
+
+def write_header(path: str, prefix: str, model: Model, source: str):
+    guard = "__" + os.path.basename(path).upper().replace('.', '_') + "__"
+    content = f"""/* Auto-generated TinyMAIX ahead-of-time model code */
+/* Generated by tinymaix_aot.py from {source}, do not edit */
+
+#ifndef {guard}
+#define {guard}
+
+#include "tinymaix.h"
+
+/* Model must be loaded with tm_load() first, {prefix}_check() once after load */
+tm_err_t {prefix}_check(tm_mdl_t* mdl);                               /* TM_ERR_MDLTYPE: other model */
+tm_err_t {prefix}_run(tm_mdl_t* mdl, tm_mat_t* in, tm_mat_t* out);    /* same as tm_run() */
+tm_err_t {prefix}_run_argmax(tm_mdl_t* mdl, tm_mat_t* in, int* cls);  /* same as tm_run_argmax() */
+
+#define {prefix.upper()}_BUF_SIZE ({model.buf_size})
+#define {prefix.upper()}_LAYER_CNT ({len(model.layers)})
+
+#endif /* {guard} */
+"""
+    with open(path, 'w') as f:
+        f.write(content)
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Compile a TinyMAIX model to specialised C')
+    parser.add_argument('--input', '-i', required=True,
+                        help='Input TinyMAIX model header file (.h), planned model as shipped')
+    parser.add_argument('--output', '-o', required=True,
+                        help='Output generated C source')
+    parser.add_argument('--header', required=True,
+                        help='Output generated C header')
+    parser.add_argument('--prefix', default='tm_aot',
+                        help='Prefix of generated functions (default tm_aot)')
+    parser.add_argument('--max-csize', type=int, default=MAX_CSIZE,
+                        help=f'TM_MAX_CSIZE of the runtime, bounds fused intermediates (default {MAX_CSIZE})')
+    args = parser.parse_args()
+
+    if not os.path.exists(args.input):
+        print(f"Error: Input file not found: {args.input}")
+        sys.exit(1)
+
+    try:
+        model, _, _ = load_header(args.input)
+        source = os.path.basename(args.input)
+        code = AotCompiler(model, args.prefix, source, os.path.basename(args.header),
+                           args.max_csize).generate()
+        with open(args.output, 'w') as f:
+            f.write(code)
+        write_header(args.header, args.prefix, model, source)
+        print(f"AOT model code generated: {args.output} ({len(model.layers)} layers, "
+              f"fingerprint 0x{fingerprint(model):08X})")
+        print(f"AOT model header generated: {args.header}")
+    except Exception as e:
+        print(f"Error: {e}")
+        sys.exit(1)
+
+
+if __name__ == '__main__':
+    main()
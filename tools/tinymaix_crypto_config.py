@@ -0,0 +1,272 @@
+#!/usr/bin/env python3
+"""
+TinyMAIX Crypto Config Generator
+
+Right-sized PSA crypto config header from a TFM_TINYML_CRYPTO_TRACE build.
+That build links partitions/crypto_trace into the Crypto partition, which
+logs "[Crypto Trace]" lines on the secure UART while the workloads run
+(model load, NS crypto tests):
+
+    [Crypto Trace] heap peak <bytes> blocks <n> ops peak <n>
+    [Crypto Trace] ops peak <n>
+    [Crypto Trace] use <hash|mac|cipher|aead|kdf|key|rng> 0x<alg or key type>
+
+This tool reads one or more such logs and rewrites the template config
+(spe/config/config_tinyml.h):
+
+- CRYPTO_ENGINE_BUF_SIZE: heap peak plus --margin percent, 256 byte aligned
+- CRYPTO_CONC_OPER_NUM: operation peak plus --ops-spare
+- PSA_WANT_ALG_* / PSA_WANT_KEY_TYPE_*: the algorithms and key types used,
+  plus what they depend on (HKDF needs HMAC, its hash and derive keys)
+- CRYPTO_*_MODULE_ENABLED: only the modules of the API families used
+
+Everything else in the template is kept. Build with the result through
+-DTINYML_CONFIG_HEADER=<output> (build.sh CRYPTO_MIN). The numbers are only
+as good as the workloads traced: rerun the trace when they change.
+
+Usage:
+    python tinymaix_crypto_config.py --log uart.log \\
+        --template spe/config/config_tinyml.h --output spe/config/config_tinyml_min.h
+"""
+
+import argparse
+import re
+import sys
+from typing import List, Set, Tuple
+
+HEAP_RE = re.compile(r'\[Crypto Trace\] heap peak (\d+) blocks (\d+) ops peak (\d+)')
+OPS_RE = re.compile(r'\[Crypto Trace\] ops peak (\d+)')
+USE_RE = re.compile(r'\[Crypto Trace\] use (\w+) 0x([0-9a-fA-F]+)')
+DEFINE_RE = r'(#define\s+{}\s+)(\S+)'
+LENGTH_MASK = 0x003f8000    # MAC/AEAD tag length and at-least-this-length bits
+
+HASHES = {
+    0x02000005: 'SHA_1',
+    0x02000008: 'SHA_224',
+    0x02000009: 'SHA_256',
+    0x0200000a: 'SHA_384',
+    0x0200000b: 'SHA_512',
+}
+CIPHERS = {
+    0x04404000: 'CBC_NO_PADDING',
+    0x04404100: 'CBC_PKCS7',
+    0x04404400: 'ECB_NO_PADDING',
+    0x04c01000: 'CTR',
+    0x04c01100: 'CFB',
+    0x04c01200: 'OFB',
+}
+AEADS = {
+    0x05500100: 'CCM',
+    0x05500200: 'GCM',
+    0x05100500: 'CHACHA20_POLY1305',
+}
+KDFS = {
+    0x08000100: 'HKDF',
+    0x08000400: 'HKDF_EXTRACT',
+    0x08000500: 'HKDF_EXPAND',
+    0x08000200: 'TLS12_PRF',
+    0x08000300: 'TLS12_PSK_TO_MS',
+}
+KEY_TYPES = {
+    0x1001: 'RAW_DATA',
+    0x1100: 'HMAC',
+    0x1200: 'DERIVE',
+    0x2400: 'AES',
+    0x2004: 'CHACHA20',
+}
+
+# API family of the trace -> Crypto partition module
+MODULES = {
+    'hash': 'CRYPTO_HASH_MODULE_ENABLED',
+    'mac': 'CRYPTO_MAC_MODULE_ENABLED',
+    'cipher': 'CRYPTO_CIPHER_MODULE_ENABLED',
+    'aead': 'CRYPTO_AEAD_MODULE_ENABLED',
+    'kdf': 'CRYPTO_KEY_DERIVATION_MODULE_ENABLED',
+    'key': 'CRYPTO_KEY_MODULE_ENABLED',
+    'rng': 'CRYPTO_RNG_MODULE_ENABLED',
+}
+
+# Families whose operations take a key
+KEYED = {'mac', 'cipher', 'aead', 'kdf'}
+
+PSA_WANT_START = '#define MBEDTLS_PSA_CRYPTO_CONFIG'
+PSA_WANT_END = '/* Platform Partition Configs */'
+
+
+class Trace:
+    def __init__(self):
+        self.heap = 0
+        self.blocks = 0
+        self.ops = 0
+        self.uses: Set[Tuple[str, int]] = set()
+
+    def load(self, path: str):
+        with open(path, 'r', errors='replace') as f:
+            for line in f:
+                m = HEAP_RE.search(line)
+                if m:
+                    self.heap = max(self.heap, int(m.group(1)))
+                    self.blocks = max(self.blocks, int(m.group(2)))
+                    self.ops = max(self.ops, int(m.group(3)))
+                    continue
+                m = OPS_RE.search(line)
+                if m:
+                    self.ops = max(self.ops, int(m.group(1)))
+                    continue
+                m = USE_RE.search(line)
+                if m:
+                    self.uses.add((m.group(1), int(m.group(2), 16)))
+
+    @property
+    def families(self) -> Set[str]:
+        return {family for family, _ in self.uses}
+
+
+def hash_of(alg: int) -> int:
+    """Hash algorithm encoded in the low byte of HMAC and HKDF."""
+    return 0x02000000 | (alg & 0xff)
+
+
+def want(trace: Trace) -> Tuple[Set[str], List[str]]:
+    """PSA_WANT macros (without prefix) for the used algorithms, and the unknown values."""
+    wants: Set[str] = set()
+    unknown: List[str] = []
+
+    def add_hash(alg: int, family: str):
+        if alg in HASHES:
+            wants.add('ALG_' + HASHES[alg])
+        else:
+            unknown.append(f"{family} 0x{alg:08x}")
+
+    for family, value in sorted(trace.uses):
+        if family == 'hash':
+            add_hash(value, family)
+        elif family == 'mac':
+            if value & ~LENGTH_MASK & ~0xff == 0x03800000:     # HMAC of any hash and truncation
+                wants.update(('ALG_HMAC', 'KEY_TYPE_HMAC'))
+                add_hash(hash_of(value), family)
+            elif value & ~LENGTH_MASK == 0x03c00200:
+                wants.add('ALG_CMAC')
+            else:
+                unknown.append(f"{family} 0x{value:08x}")
+        elif family == 'cipher':
+            if value in CIPHERS:
+                wants.add('ALG_' + CIPHERS[value])
+            else:
+                unknown.append(f"{family} 0x{value:08x}")
+        elif family == 'aead':
+            names = [name for alg, name in AEADS.items() if alg & ~LENGTH_MASK == value & ~LENGTH_MASK]
+            if names:
+                wants.add('ALG_' + names[0])
+            else:
+                unknown.append(f"{family} 0x{value:08x}")
+        elif family == 'kdf':
+            base = value & ~0xff
+            if base in KDFS:
+                wants.update(('ALG_' + KDFS[base], 'ALG_HMAC', 'KEY_TYPE_DERIVE'))   # all HMAC based
+                add_hash(hash_of(value), family)
+            else:
+                unknown.append(f"{family} 0x{value:08x}")
+        elif family == 'key':
+            if value in KEY_TYPES:
+                wants.add('KEY_TYPE_' + KEY_TYPES[value])
+            else:
+                unknown.append(f"{family} 0x{value:04x}")
+    return wants, unknown
+
+
+def enabled_families(trace: Trace) -> Set[str]:
+    families = trace.families
+    if families & KEYED:
+        families.add('key')     # key handles (builtin HUK too) go through the key module
+    return families
+
+
+def engine_buf_size(peak: int, margin: int) -> int:
+    size = peak * (100 + margin) // 100
+    return (size + 0xFF) & ~0xFF
+
+
+def set_define(text: str, name: str, value: str) -> str:
+    text, n = re.subn(DEFINE_RE.format(name), lambda m: m.group(1) + value, text, count=1)
+    if not n:
+        raise ValueError(f"{name} not found in the template")
+    return text
+
+
+def generate(template: str, trace: Trace, wants: Set[str], buf_size: int, ops: int, logs: List[str]) -> str:
+    start = template.find(PSA_WANT_START)
+    end = template.find(PSA_WANT_END)
+    if start < 0 or end < start:
+        raise ValueError(f"template has no '{PSA_WANT_START}' ... '{PSA_WANT_END}' block")
+    start += len(PSA_WANT_START)
+
+    block = ['', '', '/* Algorithms and key types seen by the crypto trace */']
+    block += [f"#define {'PSA_WANT_' + w:<40}1" for w in sorted(wants)]
+    block += ['', '']
+    text = template[:start] + '\n'.join(block) + template[end:]
+
+    text = set_define(text, 'CRYPTO_ENGINE_BUF_SIZE', f"0x{buf_size:x}")
+    text = set_define(text, 'CRYPTO_CONC_OPER_NUM', str(ops))
+    for family, module in MODULES.items():
+        text = set_define(text, module, '1' if family in enabled_families(trace) else '0')
+
+    header = ("/*\n"
+              " * Generated by tools/tinymaix_crypto_config.py from the crypto trace of\n"
+              f" * {', '.join(logs)}:\n"
+              f" * heap peak {trace.heap} bytes ({trace.blocks} blocks), {trace.ops} concurrent operations.\n"
+              " * Do not edit, rerun the trace when the workloads change.\n"
+              " */\n\n")
+    return header + text
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Right-sized PSA crypto config header from a crypto trace log')
+    parser.add_argument('--log', '-l', action='append', required=True,
+                        help='Secure UART log of a TFM_TINYML_CRYPTO_TRACE build (repeatable)')
+    parser.add_argument('--template', '-t', required=True, help='Config header to start from (config_tinyml.h)')
+    parser.add_argument('--output', '-o', required=True, help='Generated config header')
+    parser.add_argument('--margin', type=int, default=25,
+                        help='Engine heap margin over the peak in percent (default 25)')
+    parser.add_argument('--ops-spare', type=int, default=1,
+                        help='Operation slots added to the peak (default 1)')
+    args = parser.parse_args()
+
+    trace = Trace()
+    try:
+        for path in args.log:
+            trace.load(path)
+        with open(args.template, 'r') as f:
+            template = f.read()
+    except OSError as e:
+        print(f"Error: {e}")
+        sys.exit(1)
+
+    if not trace.heap:
+        print("Error: No '[Crypto Trace] heap peak' line in the log (build with -DTFM_TINYML_CRYPTO_TRACE=ON)")
+        sys.exit(1)
+
+    wants, unknown = want(trace)
+    buf_size = engine_buf_size(trace.heap, args.margin)
+    ops = max(1, trace.ops) + args.ops_spare
+    try:
+        text = generate(template, trace, wants, buf_size, ops, args.log)
+    except ValueError as e:
+        print(f"Error: {args.template}: {e}")
+        sys.exit(1)
+    with open(args.output, 'w') as f:
+        f.write(text)
+
+    print(f"Crypto config from {len(args.log)} log(s): heap peak {trace.heap} B, ops peak {trace.ops}")
+    print(f"  CRYPTO_ENGINE_BUF_SIZE 0x{buf_size:x} (margin {args.margin}%)")
+    print(f"  CRYPTO_CONC_OPER_NUM   {ops} (spare {args.ops_spare})")
+    print(f"  modules: {', '.join(sorted(enabled_families(trace) & set(MODULES))) or 'none'}")
+    for w in sorted(wants):
+        print(f"  PSA_WANT_{w}")
+    for u in unknown:
+        print(f"  UNKNOWN: {u}, add its PSA_WANT by hand")
+    print(f"Written {args.output}")
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,298 @@
+#!/usr/bin/env python3
+"""
+TinyMAIX Secure Footprint Report
+
+RAM and flash per partition and per symbol from the GNU ld map file of the
+SPE (bin/tfm_s.map), run after link by the tinymaix_footprint target:
+
+- every input section is booked to a partition: the partition archive
+  (libtfm_*_partition_<name>.a) or the generated manifest objects
+  (intermedia_/load_info_<name>_manifest.c, which hold the partition stack).
+  Everything else is booked to its archive or object, alignment padding
+  to (fill).
+- RAM or flash comes from the memory region of the address. .data counts
+  in both, once for the copy in RAM and once for its load image.
+- --detail lists the symbols of a partition. The symbol is the input
+  section name without its prefix (.bss.static_main_buf), or the object
+  file name for sections not split per symbol.
+- --save-baseline stores the report as JSON, --baseline prints deltas
+  against one
+- --budget gives RAM/flash limits per partition (and "total") in a JSON
+  file. Any limit exceeded exits with status 1, which fails the build.
+
+Usage:
+    python tinymaix_footprint.py --map build/spe/build-spe/bin/tfm_s.map \\
+        --detail tinymaix_inference --budget spe/config/footprint_budget.json
+"""
+
+import argparse
+import json
+import os
+import re
+import sys
+from typing import Dict, List, Optional, Tuple
+
+REGION_RE = re.compile(r'^(\S+)\s+0x([0-9a-fA-F]+)\s+0x([0-9a-fA-F]+)(?:\s+(\S+))?')
+OUT_SECTION_RE = re.compile(r'^(\.\S+|\S+)\s+0x([0-9a-fA-F]+)\s+0x([0-9a-fA-F]+)(?:\s+load address 0x([0-9a-fA-F]+))?')
+IN_SECTION_RE = re.compile(r'^ (\S+)\s+0x([0-9a-fA-F]+)\s+0x([0-9a-fA-F]+)\s+(\S.*)$')
+FILL_RE = re.compile(r'^ \*fill\*\s+0x[0-9a-fA-F]+\s+0x([0-9a-fA-F]+)')
+IN_NAME_RE = re.compile(r'^ (\S+)$')
+IN_CONT_RE = re.compile(r'^\s+0x([0-9a-fA-F]+)\s+0x([0-9a-fA-F]+)\s+(\S.*)$')
+PARTITION_LIB_RE = re.compile(r'libtfm_\w+?_partition_(\w+)\.a')
+MANIFEST_OBJ_RE = re.compile(r'(?:intermedia|load_info)_(\w+?)(?:_sfn)?_manifest\.c\.o')
+
+# Section prefixes of input sections split per symbol (-ffunction-sections -fdata-sections)
+SPLIT_PREFIXES = ('.text.', '.rodata.', '.data.', '.bss.', '.sbss.', '.sdata.')
+
+
+class Region:
+    def __init__(self, name: str, origin: int, length: int, attrs: str):
+        self.name = name
+        self.origin = origin
+        self.length = length
+        self.ram = 'w' in attrs or 'RAM' in name.upper()
+
+    def contains(self, addr: int) -> bool:
+        return self.origin <= addr < self.origin + self.length
+
+
+class Footprint:
+    def __init__(self):
+        # owner -> [ram, flash], (owner, symbol) -> [ram, flash]
+        self.owners: Dict[str, List[int]] = {}
+        self.symbols: Dict[Tuple[str, str], List[int]] = {}
+
+    def add(self, owner: str, symbol: str, ram: int, flash: int):
+        o = self.owners.setdefault(owner, [0, 0])
+        o[0] += ram
+        o[1] += flash
+        s = self.symbols.setdefault((owner, symbol), [0, 0])
+        s[0] += ram
+        s[1] += flash
+
+    def total(self) -> Tuple[int, int]:
+        return (sum(v[0] for v in self.owners.values()), sum(v[1] for v in self.owners.values()))
+
+    def to_json(self) -> dict:
+        return {
+            'partitions': {k: {'ram': v[0], 'flash': v[1]} for k, v in sorted(self.owners.items())},
+            'symbols': {f"{o}/{s}": {'ram': v[0], 'flash': v[1]} for (o, s), v in sorted(self.symbols.items())},
+        }
+
+
+def owner_of(obj: str) -> str:
+    """Partition name for partition code and data, archive or object name otherwise."""
+    m = PARTITION_LIB_RE.search(obj)
+    if m:
+        return m.group(1)
+    m = MANIFEST_OBJ_RE.search(obj)
+    if m:
+        return m.group(1)
+    lib = re.search(r'([^/\\(]+\.a)\(', obj)
+    if lib:
+        return lib.group(1)
+    return os.path.basename(obj)
+
+
+def symbol_of(section: str, obj: str) -> str:
+    for prefix in SPLIT_PREFIXES:
+        if section.startswith(prefix):
+            return section[len(prefix):]
+    m = re.search(r'\(([^)]+)\)$', obj)
+    return f"{m.group(1) if m else os.path.basename(obj)}:{section}"
+
+
+def parse_map(path: str) -> Footprint:
+    regions: List[Region] = []
+    fp = Footprint()
+    with open(path, 'r', errors='replace') as f:
+        lines = f.read().splitlines()
+
+    i = 0
+    # Memory Configuration table (may be absent, then section names decide)
+    while i < len(lines) and not lines[i].startswith('Memory Configuration'):
+        i += 1
+    i += 1
+    while i < len(lines) and not lines[i].startswith('Linker script and memory map'):
+        m = REGION_RE.match(lines[i])
+        if m and m.group(1) not in ('Name', '*default*'):
+            regions.append(Region(m.group(1), int(m.group(2), 16), int(m.group(3), 16), m.group(4) or ''))
+        i += 1
+
+    def is_ram(addr: int, out_name: str) -> bool:
+        for r in regions:
+            if r.contains(addr):
+                return r.ram
+        return out_name.startswith(('.data', '.bss', '.sbss', '.sdata', '.heap', '.stack', '.noinit'))
+
+    out_name, out_ram, load_flash, out_nobits = '', False, False, False
+    pending: Optional[str] = None
+
+    def enter(vma: int, lma: Optional[int]):
+        """Start an output section: RAM or flash, and a flash load image for .data."""
+        nonlocal out_ram, load_flash, out_nobits
+        out_ram = is_ram(vma, out_name)
+        load_flash = out_ram and lma is not None and lma != vma and not is_ram(lma, out_name)
+        out_nobits = out_name.startswith(('.bss', '.sbss', '.noinit', '.heap', '.stack'))
+
+    for line in lines[i:]:
+        if line.startswith('/DISCARD/') or line.startswith('OUTPUT('):
+            out_name = ''
+            continue
+        m = OUT_SECTION_RE.match(line)
+        if m and not line.startswith(' '):
+            out_name = m.group(1)
+            enter(int(m.group(2), 16), int(m.group(4), 16) if m.group(4) else None)
+            pending = None
+            continue
+        if not line.startswith(' ') and line.strip() and not line.startswith('\t'):
+            # Output section name alone on its line, address on the next
+            if re.match(r'^\.\S+$', line.strip()):
+                out_name = line.strip()
+                pending = '__out__'
+            continue
+        if pending == '__out__':
+            m = IN_CONT_RE.match(line)
+            if m:
+                lma = re.search(r'load address 0x([0-9a-fA-F]+)', line)
+                enter(int(m.group(1), 16), int(lma.group(1), 16) if lma else None)
+            pending = None
+            continue
+        if not out_name:
+            continue
+
+        m = FILL_RE.match(line)
+        if m:
+            # Alignment padding, booked apart so totals match the image
+            size = int(m.group(1), 16)
+            fp.add('(fill)', out_name, size if out_ram else 0,
+                   size if not out_ram or (load_flash and not out_nobits) else 0)
+            pending = None
+            continue
+
+        section = obj = None
+        size = 0
+        m = IN_SECTION_RE.match(line)
+        if m and not m.group(4).startswith('0x'):
+            section, size, obj = m.group(1), int(m.group(3), 16), m.group(4).strip()
+        else:
+            m = IN_NAME_RE.match(line)
+            if m and m.group(1) != '*fill*':
+                pending = m.group(1)
+                continue
+            m = IN_CONT_RE.match(line)
+            if m and pending:
+                section, size, obj = pending, int(m.group(2), 16), m.group(3).strip()
+            pending = None
+        if not section or not size or section.startswith('*') or obj.startswith('load address'):
+            continue
+        if section == 'COMMON':
+            section = '.bss.COMMON'
+        ram = size if out_ram else 0
+        flash = 0 if out_ram else size
+        if load_flash and not out_nobits:
+            flash = size
+        fp.add(owner_of(obj), symbol_of(section, obj), ram, flash)
+    return fp
+
+
+def delta(cur: int, base: Optional[int]) -> str:
+    if base is None:
+        return 'new'
+    return f"{cur - base:+d}" if cur != base else '0'
+
+
+def report(fp: Footprint, path: str, baseline: Optional[dict], details: List[str], top: int):
+    ram, flash = fp.total()
+    base_parts = baseline['partitions'] if baseline else {}
+    base_syms = baseline['symbols'] if baseline else {}
+    print(f"Secure footprint: {path} (RAM {ram} B, flash {flash} B)")
+    hdr = f"  {'partition / object':<40} {'RAM':>8} {'flash':>8}"
+    if baseline:
+        hdr += f" {'dRAM':>8} {'dflash':>8}"
+    print(hdr)
+    for owner, (r, fl) in sorted(fp.owners.items(), key=lambda kv: -(kv[1][0] + kv[1][1])):
+        line = f"  {owner:<40} {r:>8} {fl:>8}"
+        if baseline:
+            b = base_parts.get(owner)
+            line += f" {delta(r, b and b['ram']):>8} {delta(fl, b and b['flash']):>8}"
+        print(line)
+    for owner in base_parts:
+        if owner not in fp.owners:
+            print(f"  {owner:<40} {'gone':>8}")
+
+    for part in details:
+        syms = [(s, v) for (o, s), v in fp.symbols.items() if o == part]
+        if not syms:
+            print(f"  {part}: no sections in the map")
+            continue
+        syms.sort(key=lambda sv: -(sv[1][0] + sv[1][1]))
+        print(f"  {part} symbols (top {min(top, len(syms))} of {len(syms)})")
+        for s, (r, fl) in syms[:top]:
+            line = f"    {s:<38} {r:>8} {fl:>8}"
+            if baseline:
+                b = base_syms.get(f"{part}/{s}")
+                line += f" {delta(r, b and b['ram']):>8} {delta(fl, b and b['flash']):>8}"
+            print(line)
+
+
+def check_budget(fp: Footprint, budget: dict) -> bool:
+    """Print every exceeded limit, True when all are met."""
+    ok = True
+    ram, flash = fp.total()
+    for owner, limits in budget.items():
+        if owner == 'total':
+            used = {'ram': ram, 'flash': flash}
+        elif owner in fp.owners:
+            used = {'ram': fp.owners[owner][0], 'flash': fp.owners[owner][1]}
+        else:
+            continue
+        for kind in ('ram', 'flash'):
+            if kind in limits and used[kind] > int(str(limits[kind]), 0):
+                limit = int(str(limits[kind]), 0)
+                print(f"  OVER BUDGET: {owner} {kind} {used[kind]} B > {limit} B (+{used[kind] - limit})")
+                ok = False
+    if ok:
+        print(f"  budget met ({', '.join(budget.keys())})")
+    return ok
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Secure RAM/flash footprint per partition and symbol from a map file')
+    parser.add_argument('--map', '-m', required=True, help='GNU ld map file of the SPE (tfm_s.map)')
+    parser.add_argument('--detail', '-d', action='append', default=[],
+                        help='Partition whose symbols are listed (repeatable)')
+    parser.add_argument('--top', type=int, default=20, help='Symbols listed per --detail partition (default 20)')
+    parser.add_argument('--baseline', '-b', help='Baseline JSON to print deltas against')
+    parser.add_argument('--save-baseline', help='Write this report as baseline JSON')
+    parser.add_argument('--budget', help='JSON of {"<partition>|total": {"ram": N, "flash": N}} limits')
+    args = parser.parse_args()
+
+    try:
+        fp = parse_map(args.map)
+        baseline = None
+        if args.baseline and os.path.exists(args.baseline):
+            with open(args.baseline, 'r') as f:
+                baseline = json.load(f)
+        elif args.baseline:
+            print(f"Baseline {args.baseline} not found, no deltas")
+        budget = None
+        if args.budget:
+            with open(args.budget, 'r') as f:
+                budget = json.load(f)
+    except (OSError, ValueError) as e:
+        print(f"Error: {e}")
+        sys.exit(1)
+
+    report(fp, args.map, baseline, args.detail, args.top)
+    if args.save_baseline:
+        with open(args.save_baseline, 'w') as f:
+            json.dump(fp.to_json(), f, indent=2)
+            f.write('\n')
+        print(f"  baseline written to {args.save_baseline}")
+    if budget is not None and not check_budget(fp, budget):
+        sys.exit(1)
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,128 @@
+#!/usr/bin/env python3
+"""
+TinyMAIX Call Latency Comparison
+
+Joins the call latency lines of an IPC build and an SFN build of the
+inference partition (test_tinymaix_call_latency() in
+nspe/tinymaix_inference_test.c, build with ./build.sh and ./build.sh SFN)
+and prints them side by side:
+
+- null: one psa_call of an unknown message type on an open connection,
+  the dispatch round trip alone
+- run: psa_connect, an argmax inference of the builtin image and psa_close
+
+Times are NS RTOS ticks over the whole loop, converted with --tick-hz.
+
+--cold/--preload join the first-inference lines (test_tinymaix_first_inference())
+of a normal build and a TFM_TINYMAIX_PRELOAD build (./build.sh PRELOAD):
+the first LOAD and inference after boot, and a second warm inference. The
+boot-time cost of the preload comes from the "[TinyMaix Preload]" line of
+the secure log when the build had the cycle counter (TFM_TINYMAIX_PROFILE).
+
+Usage:
+    python tinymaix_latency_compare.py --ipc uart_ipc.log --sfn uart_sfn.log
+    python tinymaix_latency_compare.py --cold uart.log --preload uart_preload.log
+"""
+
+import argparse
+import re
+import sys
+from typing import Dict, Optional, Tuple
+
+LAT_RE = re.compile(r'\[TinyMaix Lat\] model (\w+) (\w+) (\d+) ticks (\d+)')
+FIRST_RE = re.compile(r'\[TinyMaix First\] mode (\w+) load (\d+) run (\d+) warm (\d+) ticks')
+PRELOAD_RE = re.compile(r'\[TinyMaix Preload\] load (\d+) ticks warmup (\d+) ticks class (-?\d+) tick_hz (\d+)')
+
+
+def parse_latency(path: str) -> Dict[str, Tuple[int, int]]:
+    """{kind: (count, ticks)} of the last latency lines in a log."""
+    lat = {}
+    with open(path, 'r', errors='replace') as f:
+        for line in f:
+            m = LAT_RE.search(line)
+            if m:
+                lat[m.group(2)] = (int(m.group(3)), int(m.group(4)))
+    if not lat:
+        raise ValueError(f"No [TinyMaix Lat] lines found in {path}")
+    return lat
+
+
+def parse_first(path: str) -> Tuple[Tuple[int, int, int], Optional[Tuple[int, int, int]]]:
+    """(load, run, warm) ticks of the first-inference line, and the secure
+    preload (load, warmup, tick_hz) cycles if the log has them."""
+    first, preload = None, None
+    with open(path, 'r', errors='replace') as f:
+        for line in f:
+            m = FIRST_RE.search(line)
+            if m:
+                first = (int(m.group(2)), int(m.group(3)), int(m.group(4)))
+                continue
+            m = PRELOAD_RE.search(line)
+            if m:
+                preload = (int(m.group(1)), int(m.group(2)), int(m.group(4)))
+    if first is None:
+        raise ValueError(f"No [TinyMaix First] line found in {path}")
+    return first, preload
+
+
+def compare_first(cold_path: str, preload_path: str, tick_hz: int):
+    cold, _ = parse_first(cold_path)
+    pre, boot = parse_first(preload_path)
+
+    def ms(ticks: int) -> float:
+        return ticks * 1e3 / tick_hz
+
+    print(f"TinyMAIX first inference after boot (ms, {tick_hz} Hz ticks)")
+    print(f"  {'step':<8} {'cold':>10} {'preload':>10} {'saved':>10}")
+    for i, step in enumerate(('load', 'run', 'warm')):
+        print(f"  {step:<8} {ms(cold[i]):>10.1f} {ms(pre[i]):>10.1f} {ms(cold[i] - pre[i]):>10.1f}")
+    saved = (cold[0] + cold[1]) - (pre[0] + pre[1])
+    print(f"  first request (load + run) saved {ms(saved):.1f} ms")
+    if boot and boot[2]:
+        boot_ms = (boot[0] + boot[1]) * 1e3 / boot[2]
+        print(f"  boot-time cost: load {boot[0] * 1e3 / boot[2]:.1f} ms + warm-up "
+              f"{boot[1] * 1e3 / boot[2]:.1f} ms = {boot_ms:.1f} ms ({boot[2]} Hz cycles)")
+    elif boot:
+        print("  boot-time cost: not timed (build with TFM_TINYMAIX_PROFILE for the cycle counter)")
+    else:
+        print(f"  boot-time cost: no [TinyMaix Preload] line in {preload_path}")
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Compare TinyMaix call latency of IPC and SFN builds, '
+                                                 'or first-inference latency with and without preload')
+    parser.add_argument('--ipc', help='Log of the IPC model build')
+    parser.add_argument('--sfn', help='Log of the SFN model build')
+    parser.add_argument('--cold', help='Log of a build without TFM_TINYMAIX_PRELOAD')
+    parser.add_argument('--preload', help='Log of a TFM_TINYMAIX_PRELOAD build')
+    parser.add_argument('--tick-hz', type=int, default=1000,
+                        help='NS RTOS tick rate for tick to time conversion (default 1000)')
+    args = parser.parse_args()
+
+    if not (args.ipc and args.sfn) and not (args.cold and args.preload):
+        parser.error('give --ipc and --sfn, or --cold and --preload')
+    try:
+        if args.cold and args.preload:
+            compare_first(args.cold, args.preload, args.tick_hz)
+        if not (args.ipc and args.sfn):
+            return
+        ipc = parse_latency(args.ipc)
+        sfn = parse_latency(args.sfn)
+    except (OSError, ValueError) as e:
+        print(f"Error: {e}")
+        sys.exit(1)
+
+    print(f"TinyMAIX call latency (us per call, {args.tick_hz} Hz ticks)")
+    print(f"  {'call':<6} {'IPC':>10} {'SFN':>10} {'saved':>10} {'speedup':>8}")
+    for kind in ('null', 'run'):
+        if kind not in ipc or kind not in sfn:
+            print(f"  {kind:<6} missing in {'IPC' if kind not in ipc else 'SFN'} log")
+            continue
+        us_ipc = ipc[kind][1] * 1e6 / args.tick_hz / ipc[kind][0]
+        us_sfn = sfn[kind][1] * 1e6 / args.tick_hz / sfn[kind][0]
+        speedup = f"{us_ipc / us_sfn:.2f}x" if us_sfn else "-"
+        print(f"  {kind:<6} {us_ipc:>10.1f} {us_sfn:>10.1f} {us_ipc - us_sfn:>10.1f} {speedup:>8}")
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,377 @@
+#!/usr/bin/env python3
+"""
+TinyMAIX Static Activation Memory Planner
+
+The TinyMAIX converter lays activations out in a fixed ping-pong scheme and
+records a single `buf_size` in the model. This tool re-plans that layout
+offline:
+
+- computes the lifetime of every activation tensor (model input, each layer
+  output, residual branches read through TML_ADD `in_oft1`)
+- packs them into one arena with greedy-by-size best-fit placement
+- rewrites every `in_oft`/`out_oft`/`in_oft1` and `buf_size` in the model
+- emits the planned model header plus a generated header with the exact
+  arena size, consumed by the secure partition
+
+Runtime constraints honoured by the plan:
+- the model input stays at offset 0 (tm_load returns buf as input data)
+- TML_RESHAPE does no copy, so its output aliases its input (tm_run
+  skips it; a reshape that does not alias would run as a copy)
+- a layer never writes over its own inputs (no in place kernels assumed)
+- with patch based execution (--patch), the first conv layers run row patch
+  by row patch (tm_mdlbin_t.patch_layers/patch_rows): only the patch of
+  their intermediate outputs is kept, the stack output is materialised
+- with layer fusion (--fuse), a conv/dwconv layer feeding a GAP runs row by
+  row (tm_mdlbin_t.fuse_mask): its output holds a single row
+- with delta execution (--delta N), the input and the outputs of the first
+  N conv layers (tm_mdlbin_t.delta_layers) stay live until the end of
+  tm_run, so tm_run_delta can recompute only the rows a new frame changed
+- softmax outputs reserve 4*c bytes (float scratch in INT8/INT16 mode)
+- output layers with out_deq keep room for the float dequant area at
+  TM_ALIGN(out + size), and stay live until the end of tm_run
+
+Usage:
+    python tinymaix_mem_planner.py --input models/mnist_valid_q.h \\
+        --output models/mnist_valid_q_planned.h --mem-header models/tinymaix_model_mem.h \
+        --patch auto --fuse auto
+"""
+
+import argparse
+import os
+import sys
+from typing import Dict, List, Tuple
+
+from tinymaix_model import (Model, align, dims_size, fuse_kind, fuse_scan, load_header, patch_bands,
+                            save_header, TML_ADD, TML_CONV2D, TML_RESHAPE, TML_SOFTMAX)
+
+INPUT_TENSOR = -1  # producer index of the model input
+PATCH_MAX_LAYERS = 4  # TM_PATCH_MAX_LAYERS
+DELTA_MAX_ROWS = 64   # TM_DELTA_MAX_ROWS
+MAX_CSIZE = 16        # TM_MAX_CSIZE of tm_port.h
+
+
+class Tensor:
+    """An activation buffer: produced once, read until `last`."""
+
+    def __init__(self, tid: int, producer: int, size: int):
+        self.tid = tid
+        self.producer = producer
+        self.first = producer
+        self.last = producer
+        self.size = size
+        self.offset = None
+        self.orig_offset = None
+        self.pinned = False
+
+    def overlaps_time(self, other: "Tensor") -> bool:
+        return self.first <= other.last and other.first <= self.last
+
+
+def patch_max_layers(model: Model) -> int:
+    """Longest stack of leading conv layers that tm_run can run patch by patch."""
+    n = 0
+    for layer in model.layers[:PATCH_MAX_LAYERS]:
+        if not layer.is_conv or layer.is_out or layer.dilation_h != 1:
+            break
+        if n > 0 and layer.in_oft != model.layers[n - 1].out_oft:
+            break
+        n += 1
+    return n
+
+
+def delta_max_layers(model: Model) -> int:
+    """Longest stack of leading conv layers that tm_run_delta can keep resident."""
+    n = 0
+    oft = 0     # input at offset 0
+    for layer in model.layers:
+        if not layer.is_conv or layer.is_out or layer.dilation_h != 1 or layer.in_oft != oft:
+            break
+        if layer.in_dims[1] > DELTA_MAX_ROWS or layer.out_dims[1] > DELTA_MAX_ROWS:
+            break
+        oft = layer.out_oft
+        n += 1
+    return n
+
+
+def patch_walk(model: Model, n: int, rows: int) -> Tuple[List[int], float]:
+    """
+    Replay tm_run_patch: per stack layer the max output rows held for one
+    patch, and the MAC overhead of recomputed halo rows (0.0 = none).
+    """
+    layers = model.layers[:n]
+    max_rows = [0] * n
+    macs_row = []
+    for l in layers:
+        chi = 1 if l.type != TML_CONV2D else l.in_dims[3]    # dwconv: one input channel per output
+        macs_row.append(l.out_dims[2] * l.out_dims[3] * l.kernel_w * l.kernel_h * chi)
+    full = sum(l.out_dims[1] * m for l, m in zip(layers, macs_row))
+    done = 0
+    for band in patch_bands(layers, rows):
+        for j, (_, _, ro0, ro1) in enumerate(band):
+            max_rows[j] = max(max_rows[j], ro1 - ro0)
+            done += (ro1 - ro0) * macs_row[j]
+    return max_rows, done / full - 1.0
+
+
+class MemPlanner:
+    """Lifetime analysis and greedy-by-size best-fit arena packing."""
+
+    def __init__(self, model: Model, patch_layers: int = 0, patch_rows: int = 0, fuse_max_c: int = 0,
+                 delta_layers: int = 0):
+        if patch_layers and delta_layers:
+            raise ValueError("Patch based and delta execution are exclusive")
+        self.model = model
+        self.patch_layers = patch_layers
+        self.patch_rows = patch_rows
+        self.fuse_max_c = fuse_max_c
+        self.delta_layers = delta_layers
+        self.fuse_mask = 0
+        self.patch_overhead = 0.0
+        self.tensors: List[Tensor] = []
+        self.layer_in: List[Tensor] = []
+        self.layer_in1: Dict[int, Tensor] = {}
+        self.layer_out: List[Tensor] = []
+
+    def _footprint(self, layer, size: int) -> int:
+        m = self.model
+        if layer.type == TML_SOFTMAX and m.elem_size < 4:
+            size = max(size, 4 * layer.out_dims[3])
+        if layer.is_out and m.out_deq and m.type_name != "FP32":
+            out_size = dims_size(layer.out_dims)
+            size = max(size, align(out_size * m.elem_size) + 4 * out_size)
+        return size
+
+    def analyze(self):
+        """Build tensors and lifetimes from the converter's offsets."""
+        m = self.model
+        inp = Tensor(0, INPUT_TENSOR, dims_size(m.in_dims) * m.elem_size)
+        inp.orig_offset = 0
+        inp.pinned = True
+        self.tensors.append(inp)
+        writer: Dict[int, Tensor] = {0: inp}    # buffer offset -> latest tensor written there
+
+        def reader(oft: int, i: int) -> Tensor:
+            if oft not in writer:
+                raise ValueError(f"Layer {i} reads offset {oft} that no earlier layer wrote")
+            t = writer[oft]
+            t.last = max(t.last, i)
+            return t
+
+        n = self.patch_layers
+        patch_rows = [0] * n
+        if n:
+            patch_rows, self.patch_overhead = patch_walk(m, n, self.patch_rows)
+            inp.last = n - 1    # whole stack reads input patches
+        d = self.delta_layers
+        if d > delta_max_layers(m):
+            raise ValueError(f"Delta stack of {d} layers, model allows {delta_max_layers(m)}")
+        if d:
+            inp.last = len(m.layers)    # previous frame, diffed by the next tm_run_delta
+        if self.fuse_max_c:     # only conv+gap changes buffer sizes, the other pairs are runtime only
+            mask = fuse_scan(m, max(n, d), self.fuse_max_c)
+            self.fuse_mask = sum(1 << i for i in range(len(m.layers)) if fuse_kind(m, mask, i) == 'conv_gap')
+
+        for layer in m.layers:
+            i = layer.index
+            if i == 0:
+                tin = inp       # tm_run feeds the caller's input mat to layer 0
+                tin.last = max(tin.last, 0)
+            else:
+                tin = reader(layer.in_oft, i)
+            self.layer_in.append(tin)
+            if layer.type == TML_ADD:
+                self.layer_in1[i] = reader(layer.in_oft1, i)
+            if layer.type == TML_RESHAPE:
+                tout = tin      # no copy: output is the input buffer
+                tout.size = max(tout.size, self._footprint(layer, dims_size(layer.out_dims) * m.elem_size))
+            else:
+                size = dims_size(layer.out_dims) * m.elem_size
+                if i < n - 1:   # patch stack: only one patch of rows is kept
+                    size = patch_rows[i] * layer.out_dims[2] * layer.out_dims[3] * m.elem_size
+                elif (self.fuse_mask >> i) & 1:     # conv+gap: one output row at a time
+                    size = layer.out_dims[2] * layer.out_dims[3] * m.elem_size
+                tout = Tensor(len(self.tensors), i, self._footprint(layer, size))
+                tout.orig_offset = layer.out_oft
+                self.tensors.append(tout)
+                if i < n:       # written patch by patch while the whole stack runs
+                    tout.first = 0
+                    tout.last = max(tout.last, n - 1)
+            self.layer_out.append(tout)
+            writer[layer.out_oft] = tout
+            if layer.is_out or i < d:
+                tout.last = len(m.layers)   # read by the caller after tm_run, or resident delta stack
+
+        for t in self.tensors:
+            t.size = align(t.size)
+            if 0 <= t.producer < n - 1 and t.last > n - 1:
+                raise ValueError(f"Patch layer {t.producer} output is read after the stack")
+
+    def plan(self) -> int:
+        """Place tensors, return arena size."""
+        placed: List[Tensor] = []
+        order = sorted(self.tensors, key=lambda t: (not t.pinned, -t.size, t.first))
+        for t in order:
+            if t.pinned:
+                t.offset = 0
+                placed.append(t)
+                continue
+            live = sorted((p for p in placed if p.overlaps_time(t)), key=lambda p: p.offset)
+            best_oft, best_gap = None, None
+            prev_end = 0
+            for p in live:
+                gap = p.offset - prev_end
+                if gap >= t.size and (best_gap is None or gap < best_gap):
+                    best_oft, best_gap = prev_end, gap
+                prev_end = max(prev_end, p.offset + p.size)
+            t.offset = best_oft if best_oft is not None else prev_end
+            placed.append(t)
+        return align(max(t.offset + t.size for t in self.tensors))
+
+    def peak_live(self) -> int:
+        """Lower bound: max over layers of the live tensor bytes."""
+        peak = 0
+        for i in range(INPUT_TENSOR, len(self.model.layers) + 1):
+            peak = max(peak, sum(t.size for t in self.tensors if t.first <= i <= t.last))
+        return peak
+
+    def apply(self, buf_size: int):
+        for layer in self.model.layers:
+            i = layer.index
+            in1 = self.layer_in1.get(i)
+            layer.set_offsets(self.layer_in[i].offset, self.layer_out[i].offset,
+                              in1.offset if in1 is not None else None)
+        self.model.set_buf_size(buf_size)
+        self.model.set_patch(self.patch_layers, self.patch_rows if self.patch_layers else 0)
+        self.model.set_fuse(self.fuse_mask)
+        self.model.set_delta(self.delta_layers)
+        if self.fuse_mask & ~fuse_scan(self.model, max(self.patch_layers, self.delta_layers), self.fuse_max_c):
+            raise AssertionError("planned fusion not found again on the planned offsets")
+
+    def verify(self):
+        """No two tensors live at the same time may share bytes."""
+        for a in self.tensors:
+            for b in self.tensors:
+                if a.tid < b.tid and a.overlaps_time(b) and \
+                        a.offset < b.offset + b.size and b.offset < a.offset + a.size:
+                    raise AssertionError(f"tensor {a.tid} and {b.tid} overlap")
+
+    def report(self, orig_buf_size: int, buf_size: int):
+        m = self.model
+        print(f"TinyMAIX memory plan ({m.type_name}, {len(m.layers)} layers)")
+        if self.patch_layers:
+            print(f"  patch based: first {self.patch_layers} layers, {self.patch_rows} output rows per patch, "
+                  f"{self.patch_overhead * 100:.1f}% halo recompute")
+        if self.delta_layers:
+            kept = sum(t.size for t in self.tensors if t.producer < self.delta_layers)
+            print(f"  delta stack: input and first {self.delta_layers} layers resident, {kept} bytes")
+        for i in range(len(m.layers)):
+            if (self.fuse_mask >> i) & 1:
+                print(f"  fused: layer {i} {m.layers[i].name} + layer {i + 1} {m.layers[i + 1].name}, row by row")
+        print(f"  {'id':>3} {'producer':>10} {'life':>9} {'bytes':>7} {'orig_oft':>9} {'new_oft':>8}")
+        for t in sorted(self.tensors, key=lambda t: t.tid):
+            producer = "input" if t.producer == INPUT_TENSOR else \
+                f"{t.producer}:{m.layers[t.producer].name}"
+            print(f"  {t.tid:>3} {producer:>10} {t.first:>4}-{t.last:<4} {t.size:>7} "
+                  f"{t.orig_offset:>9} {t.offset:>8}")
+        print(f"  peak live activations : {self.peak_live()} bytes")
+        print(f"  original buf_size     : {orig_buf_size} bytes")
+        print(f"  planned buf_size      : {buf_size} bytes ({buf_size - orig_buf_size:+d})")
+
+
+def search_patch(model: Model, max_overhead: float, fuse_max_c: int = 0) -> Tuple[int, int]:
+    """Pick the patch split point and patch height giving the smallest arena."""
+    def arena(n: int, rows: int) -> int:
+        planner = MemPlanner(Model(model.to_bytes()), n, rows, fuse_max_c)
+        planner.analyze()
+        return planner.plan()
+
+    best = (arena(0, 0), 0, 0)
+    for n in range(2, patch_max_layers(model) + 1):
+        oh = model.layers[n - 1].out_dims[1]
+        for rows in range(oh, 0, -1):   # taller patches first: same size, less recompute
+            if patch_walk(model, n, rows)[1] > max_overhead:
+                continue
+            size = arena(n, rows)
+            if size < best[0]:
+                best = (size, n, rows)
+    return best[1], best[2]
+
+
+def write_mem_header(path: str, model_name: str, buf_size: int, sub_size: int, peak: int, frame_size: int):
+    guard = "__TINYMAIX_MODEL_MEM_H__"
+    content = f"""/* Auto-generated TinyMAIX activation memory plan */
+/* Generated by tinymaix_mem_planner.py from {model_name} */
+
+#ifndef {guard}
+#define {guard}
+
+/* Exact main buffer (activation arena) size for tm_load() */
+#define TINYMAIX_MDL_BUF_LEN ({buf_size})
+/* Sub buffer size, tm_load() allocates it when non zero */
+#define TINYMAIX_MDL_SUB_LEN ({sub_size})
+/* Peak live activation bytes, lower bound for TINYMAIX_MDL_BUF_LEN */
+#define TINYMAIX_MDL_PEAK_LIVE ({peak})
+/* Stream frame staging for tm_run_delta(), non zero for a delta planned model */
+#define TINYMAIX_MDL_FRAME_LEN ({frame_size})
+
+#endif /* {guard} */
+"""
+    with open(path, 'w') as f:
+        f.write(content)
+    print(f"Memory header generated: {path}")
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Plan TinyMAIX activation buffers offline')
+    parser.add_argument('--input', '-i', required=True,
+                        help='Input TinyMAIX model header file (.h)')
+    parser.add_argument('--output', '-o', required=True,
+                        help='Output planned model header file (.h)')
+    parser.add_argument('--mem-header', '-m',
+                        help='Output generated header with the arena size')
+    parser.add_argument('--patch', choices=['off', 'auto'], default='off',
+                        help='Patch based execution of the first conv layers (auto: pick split point)')
+    parser.add_argument('--max-overhead', type=float, default=0.5,
+                        help='Max halo recompute MACs of the patch stack, as a fraction (default 0.5)')
+    parser.add_argument('--fuse', choices=['off', 'auto'], default='off',
+                        help='Plan conv+GAP layer fusion (needs TM_FUSE_LAYERS in the runtime)')
+    parser.add_argument('--delta', type=int, default=0, metavar='N',
+                        help='Keep the input and first N conv outputs resident for tm_run_delta (default 0: off)')
+    parser.add_argument('--max-csize', type=int, default=MAX_CSIZE,
+                        help=f'TM_MAX_CSIZE of the runtime, bounds fused channels (default {MAX_CSIZE})')
+    args = parser.parse_args()
+
+    if not os.path.exists(args.input):
+        print(f"Error: Input file not found: {args.input}")
+        sys.exit(1)
+
+    try:
+        model, array_name, defines = load_header(args.input)
+        orig_buf_size = model.buf_size
+        patch_layers, patch_rows = 0, 0
+        fuse_max_c = args.max_csize if args.fuse == 'auto' else 0
+        if args.patch == 'auto' and args.delta:
+            raise ValueError("--patch and --delta are exclusive")
+        if args.patch == 'auto':
+            patch_layers, patch_rows = search_patch(model, args.max_overhead, fuse_max_c)
+        planner = MemPlanner(model, patch_layers, patch_rows, fuse_max_c, args.delta)
+        planner.analyze()
+        buf_size = planner.plan()
+        planner.verify()
+        planner.apply(buf_size)
+        planner.report(orig_buf_size, buf_size)
+
+        defines["MDL_BUF_LEN"] = buf_size
+        save_header(args.output, model.to_bytes(), array_name, defines)
+        print(f"Planned model saved: {args.output}")
+        if args.mem_header:
+            frame_size = dims_size(model.in_dims) * model.elem_size if args.delta else 0
+            write_mem_header(args.mem_header, os.path.basename(args.input),
+                             buf_size, model.sub_size, planner.peak_live(), frame_size)
+    except Exception as e:
+        print(f"Error: {e}")
+        sys.exit(1)
+
+
+if __name__ == '__main__':
+    main()
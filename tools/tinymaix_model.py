@@ -0,0 +1,276 @@
+#!/usr/bin/env python3
+"""
+TinyMAIX Model Binary Helpers
+
+Shared parser/writer for TinyMAIX model headers (the `mdl_data[]` C arrays
+emitted by the TinyMAIX converter) and the binary layout they carry.
+Field layouts follow tinymaix/include/tinymaix.h:
+
+    tm_mdlbin_t  64 bytes  magic, mdl_type, out_deq, input_cnt, output_cnt,
+                           layer_cnt, buf_size, sub_size, in_dims[4],
+                           out_dims[4], patch_layers, patch_rows, fuse_mask,
+                           delta_layers, reserve[18]
+    tml_head_t   48 bytes  type, is_out, size, in_oft, out_oft, in_dims[4],
+                           out_dims[4], in_s, in_zp, out_s, out_zp
+
+Used by tinymaix_mem_planner.py and the other model tools.
+"""
+
+import re
+import struct
+from typing import Dict, List, Tuple
+
+MDL_MAGIC = 0x5849414D  # "MAIX"
+MDLBIN_HDR_SIZE = 64
+LAYER_HDR_SIZE = 48
+ALIGN_SIZE = 8          # TM_ALIGN_SIZE
+
+# tm_layer_type_t
+TML_CONV2D = 0
+TML_GAP = 1
+TML_FC = 2
+TML_SOFTMAX = 3
+TML_RESHAPE = 4
+TML_DWCONV2D = 5
+TML_ADD = 6
+LAYER_NAMES = {
+    TML_CONV2D: "CONV2D", TML_GAP: "GAP", TML_FC: "FC", TML_SOFTMAX: "SOFTMAX",
+    TML_RESHAPE: "RESHAPE", TML_DWCONV2D: "DWCONV2D", TML_ADD: "ADD",
+}
+
+# mdl_type -> activation element size in bytes (mtype_t)
+MDL_TYPE_NAMES = {0: "INT8", 1: "INT16", 2: "FP32", 3: "FP16", 4: "FP8_143", 5: "FP8_152"}
+MDL_TYPE_ELEM_SIZE = {0: 1, 1: 2, 2: 4, 3: 2, 4: 1, 5: 1}
+
+# tml_add_t: in_oft1 right after the layer head
+ADD_IN_OFT1 = LAYER_HDR_SIZE
+# tml_conv2d_dw_t: kernel/stride/dilation/act, pad[4], depth_mul, reserve, ws/w/b_oft after the layer head
+CONV_PARAMS = LAYER_HDR_SIZE
+FUSE_MAX_LAYERS = 32    # tm_mdlbin_t.fuse_mask bits
+# tml_fc_t: ws_oft, w_oft, b_oft, w_pack after the layer head
+FC_PARAMS = LAYER_HDR_SIZE
+
+
+def align(x: int, a: int = ALIGN_SIZE) -> int:
+    return (x + a - 1) // a * a
+
+
+def dims_size(dims) -> int:
+    """Element count of a [dims, d0, d1, d2] shape."""
+    return dims[1] * dims[2] * dims[3]
+
+
+def patch_bands(layers, rows: int):
+    """
+    Row bands of patch based execution, as tm_run_patch computes them.
+    Yields one list per band with (in_row0, in_row1, out_row0, out_row1)
+    for every stack layer.
+    """
+    oh = layers[-1].out_dims[1]
+    for r in range(0, oh, rows):
+        a, b = r, min(r + rows, oh)
+        band = [None] * len(layers)
+        for j in range(len(layers) - 1, -1, -1):
+            l = layers[j]
+            ro0, ro1 = a, b
+            a = max(0, a * l.stride_h - l.pad[0])
+            b = min(l.in_dims[1], (b - 1) * l.stride_h - l.pad[0] + l.kernel_h)
+            band[j] = (a, b, ro0, ro1)
+        yield band
+
+
+def fuse_scan(model, stack_layers: int, max_c: int) -> int:
+    """
+    Fusible layer pairs, as tm_fuse_scan finds them at tm_load. Bit i set:
+    layer i output is fused into layer i+1 (conv/dwconv+GAP run row by row,
+    GAP+FC and FC+SOFTMAX outputs of at most max_c elements kept off the
+    main buf). The first stack_layers layers (patch or delta stack) are
+    never fused. Only valid once the layer offsets are final.
+    """
+    layers = model.layers
+    mask = 0
+    for i in range(min(len(layers) - 1, FUSE_MAX_LAYERS)):
+        p, c = layers[i], layers[i + 1]
+        if p.is_out or i < stack_layers or c.in_oft != p.out_oft:
+            continue
+        if p.is_conv and c.type == TML_GAP:
+            ok = p.dilation_h == 1 and p.out_dims[3] <= max_c
+        elif (p.type, c.type) in ((TML_GAP, TML_FC), (TML_FC, TML_SOFTMAX)):
+            ok = dims_size(p.out_dims) <= max_c
+        else:
+            ok = False
+        if not ok:
+            continue
+        for l in layers[i + 2:]:    # no later reader before the tensor is overwritten
+            if l.in_oft == p.out_oft or l.in_oft1 == p.out_oft:
+                ok = False
+                break
+            if l.out_oft == p.out_oft:
+                break
+        if ok:
+            mask |= 1 << i
+    return mask
+
+
+def fuse_kind(model, mask: int, i: int):
+    """'conv_gap' or 'redirect' when layer i output is fused, else None."""
+    if i < 0 or not (mask >> i) & 1:
+        return None
+    return 'conv_gap' if model.layers[i].is_conv else 'redirect'
+
+
+class Layer:
+    """One layer of a TinyMAIX model, backed by the model byte array."""
+
+    def __init__(self, data: bytearray, index: int, offset: int):
+        self.data = data
+        self.index = index
+        self.offset = offset
+        (self.type, self.is_out, self.size, self.in_oft, self.out_oft) = \
+            struct.unpack_from('<HHIII', data, offset)
+        self.in_dims = struct.unpack_from('<4H', data, offset + 16)
+        self.out_dims = struct.unpack_from('<4H', data, offset + 24)
+        (self.in_s, self.in_zp, self.out_s, self.out_zp) = \
+            struct.unpack_from('<fifi', data, offset + 32)
+        self.in_oft1 = None
+        if self.type == TML_ADD:
+            (self.in_oft1, self.in_s1, self.in_zp1) = struct.unpack_from('<Ifi', data, offset + ADD_IN_OFT1)
+        if self.is_conv:
+            (self.kernel_w, self.kernel_h, self.stride_w, self.stride_h,
+             self.dilation_w, self.dilation_h, self.act) = \
+                struct.unpack_from('<BBBBBBH', data, offset + CONV_PARAMS)
+            self.pad = struct.unpack_from('<4B', data, offset + CONV_PARAMS + 8)  # top,bottom,left,right
+            self.depth_mul = struct.unpack_from('<I', data, offset + CONV_PARAMS + 12)[0]
+            (self.ws_oft, self.w_oft, self.b_oft) = struct.unpack_from('<III', data, offset + CONV_PARAMS + 20)
+        if self.type == TML_FC:
+            (self.ws_oft, self.w_oft, self.b_oft, self.w_pack) = \
+                struct.unpack_from('<IIII', data, offset + FC_PARAMS)
+
+    @property
+    def is_conv(self) -> bool:
+        return self.type in (TML_CONV2D, TML_DWCONV2D)
+
+    @property
+    def is_noop(self) -> bool:
+        """TML_IS_NOOP: aliases its input, skipped by tm_run (no kernel, no callback)."""
+        return self.type == TML_RESHAPE and not self.is_out and self.in_oft == self.out_oft
+
+    @property
+    def name(self) -> str:
+        return LAYER_NAMES.get(self.type, f"TYPE{self.type}")
+
+    def set_offsets(self, in_oft: int, out_oft: int, in_oft1: int = None):
+        self.in_oft, self.out_oft = in_oft, out_oft
+        struct.pack_into('<II', self.data, self.offset + 8, in_oft, out_oft)
+        if self.type == TML_ADD and in_oft1 is not None:
+            self.in_oft1 = in_oft1
+            struct.pack_into('<I', self.data, self.offset + ADD_IN_OFT1, in_oft1)
+
+    def floats(self, start: int, count: int) -> Tuple[float, ...]:
+        """float32 values at `start` from the layer start (weight scales)."""
+        return struct.unpack_from(f'<{count}f', self.data, self.offset + start)
+
+    def body(self, start: int, length: int) -> bytes:
+        """Bytes of this layer at [start, start+length) from the layer start."""
+        return bytes(self.data[self.offset + start:self.offset + start + length])
+
+
+class Model:
+    """Parsed TinyMAIX model binary (mutable, offsets can be rewritten)."""
+
+    def __init__(self, data: bytes):
+        self.data = bytearray(data)
+        (self.magic, self.mdl_type, self.out_deq, self.input_cnt, self.output_cnt,
+         self.layer_cnt, self.buf_size, self.sub_size) = \
+            struct.unpack_from('<IBBHHHII', self.data, 0)
+        if self.magic != MDL_MAGIC:
+            raise ValueError(f"Bad model magic 0x{self.magic:08x}")
+        if self.mdl_type not in MDL_TYPE_ELEM_SIZE:
+            raise ValueError(f"Unknown model type {self.mdl_type}")
+        self.in_dims = struct.unpack_from('<4H', self.data, 20)
+        self.out_dims = struct.unpack_from('<4H', self.data, 28)
+        self.patch_layers, self.patch_rows = struct.unpack_from('<HH', self.data, 36)
+        self.fuse_mask = struct.unpack_from('<I', self.data, 40)[0]
+        self.delta_layers = struct.unpack_from('<H', self.data, 44)[0]
+        self.layers: List[Layer] = []
+        offset = MDLBIN_HDR_SIZE
+        for i in range(self.layer_cnt):
+            layer = Layer(self.data, i, offset)
+            if layer.size == 0 or offset + layer.size > len(self.data):
+                raise ValueError(f"Layer {i} has bad size {layer.size}")
+            self.layers.append(layer)
+            offset += layer.size
+
+    @property
+    def elem_size(self) -> int:
+        return MDL_TYPE_ELEM_SIZE[self.mdl_type]
+
+    @property
+    def type_name(self) -> str:
+        return MDL_TYPE_NAMES[self.mdl_type]
+
+    def set_patch(self, patch_layers: int, patch_rows: int):
+        """tm_mdlbin_t.patch_layers/patch_rows, 0 layers: whole tensor execution."""
+        self.patch_layers, self.patch_rows = patch_layers, patch_rows
+        struct.pack_into('<HH', self.data, 36, patch_layers, patch_rows)
+
+    def set_fuse(self, fuse_mask: int):
+        """tm_mdlbin_t.fuse_mask, bit i: layer i output fused into layer i+1."""
+        self.fuse_mask = fuse_mask
+        struct.pack_into('<I', self.data, 40, fuse_mask)
+
+    def set_delta(self, delta_layers: int):
+        """tm_mdlbin_t.delta_layers, first layers kept resident for tm_run_delta, 0: off."""
+        self.delta_layers = delta_layers
+        struct.pack_into('<H', self.data, 44, delta_layers)
+
+    def set_buf_size(self, buf_size: int):
+        self.buf_size = buf_size
+        struct.pack_into('<I', self.data, 12, buf_size)
+
+    def to_bytes(self) -> bytes:
+        return bytes(self.data)
+
+
+def parse_header(content: str) -> Tuple[bytes, str, Dict[str, int]]:
+    """
+    Parse a TinyMAIX model header file.
+
+    Returns:
+        tuple: (model_data, array_name, defines) where defines holds the
+               integer `#define NAME (value)` lines (MDL_BUF_LEN, LBUF_LEN)
+    """
+    array_match = re.search(r'const\s+uint8_t\s+(\w+)\[\d*\]\s*=\s*\{([^}]+)\}', content, re.DOTALL)
+    if not array_match:
+        raise ValueError("Could not find model data array in header file")
+    array_name = array_match.group(1)
+    hex_values = re.findall(r'0x([0-9a-fA-F]{2})', array_match.group(2))
+    if not hex_values:
+        raise ValueError("No hex values found in array data")
+    defines = {m.group(1): int(m.group(2))
+               for m in re.finditer(r'#define\s+(\w+)\s+\((\d+)\)', content)}
+    return bytes(int(h, 16) for h in hex_values), array_name, defines
+
+
+def load_header(path: str) -> Tuple[Model, str, Dict[str, int]]:
+    with open(path, 'r') as f:
+        data, array_name, defines = parse_header(f.read())
+    return Model(data), array_name, defines
+
+
+def format_header(data: bytes, array_name: str, defines: Dict[str, int]) -> str:
+    """Emit a header in the same layout as the TinyMAIX converter."""
+    out = ["#ifndef __MODEL_FILE__H", "#define __MODEL_FILE__H", "", "#include <stdint.h>"]
+    for name, value in defines.items():
+        out.append(f"#define {name} ({value})")
+    out.append(f"const uint8_t {array_name}[{len(data)}]={{\\")
+    for i in range(0, len(data), 16):
+        out.append("\t" + "".join(f"0x{b:02x}, " for b in data[i:i + 16]))
+    out[-1] = out[-1] + "};"
+    out += ["", "#endif", ""]
+    return "\n".join(out)
+
+
+def save_header(path: str, data: bytes, array_name: str, defines: Dict[str, int]):
+    with open(path, 'w') as f:
+        f.write(format_header(data, array_name, defines))
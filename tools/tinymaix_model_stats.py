@@ -0,0 +1,261 @@
+#!/usr/bin/env python3
+"""
+TinyMAIX Model Statistics
+
+tinymaix.h declares tm_stat() under TM_ENABLE_STAT, but the library does not
+implement it. This host tool reports the same kind of data for a model
+header (or a plain, unencrypted model binary), and extends it:
+
+- per layer: output shape, MACs, weight bytes (weights + bias), activation
+  bytes (inputs + output) and arithmetic intensity (MACs per byte moved)
+- MACs of a patch based stack include the recomputed halo rows
+- with --cycles-per-mac, a roofline latency estimate per layer, bounded by
+  --bytes-per-cycle when given
+- with --profile, a capture of the on-target profile dump (see
+  test_tinymaix_profile() in nspe/tinymaix_inference_test.c, built with
+  -DTFM_TINYMAIX_PROFILE=ON) is joined per layer, and layers running far
+  below the expected throughput are flagged
+
+Profiled layer ticks run from one layer callback to the next, so the
+join follows tm_run(): a patch based stack is reported on its first layer.
+A conv fused with its GAP is reported on the GAP. Layers that never
+report (skipped reshapes, a softmax skipped by argmax) are not compared.
+Without --cycles-per-mac, the expected cycles per MAC are the median of
+the profiled MAC layers.
+
+Usage:
+    python tinymaix_model_stats.py --input models/mnist_valid_q_planned.h
+    python tinymaix_model_stats.py --input models/mnist_valid_q_planned.h \\
+        --profile uart.log --flag 2.0
+"""
+
+import argparse
+import os
+import re
+import statistics
+import sys
+from typing import Dict, List, Optional, Tuple
+
+from tinymaix_model import (Model, dims_size, fuse_kind, load_header, patch_bands,
+                            TML_ADD, TML_CONV2D, TML_DWCONV2D, TML_FC, TML_GAP)
+
+# btype_t bytes per mdl_type (tinymaix.h)
+BIAS_ELEM_SIZE = {0: 4, 1: 4, 2: 4, 3: 2, 4: 1, 5: 1}
+DEFAULT_CPU_HZ = 150000000  # TFM_TINYMAIX_PROFILE_CPU_HZ
+
+PROF_HDR_RE = re.compile(r'\[TinyMaix Prof\] tick_hz (\d+) runs (\d+) total (\d+)')
+PROF_LAYER_RE = re.compile(r'\[TinyMaix Prof\] layer (\d+) (\d+) (\d+)')
+
+
+class LayerStats:
+    def __init__(self, index: int, name: str, shape: Tuple[int, int, int]):
+        self.index = index
+        self.name = name
+        self.shape = shape
+        self.macs = 0
+        self.weight_bytes = 0
+        self.act_bytes = 0
+        self.group = index      # layer the profile reports this layer's time on
+        self.note = ""
+
+    @property
+    def intensity(self) -> float:
+        moved = self.weight_bytes + self.act_bytes
+        return self.macs / moved if moved else 0.0
+
+
+def layer_macs(layer) -> int:
+    """MACs of one layer over its whole output (GAP: one accumulate per input)."""
+    if layer.type == TML_CONV2D:
+        return dims_size(layer.out_dims) * layer.kernel_h * layer.kernel_w * layer.in_dims[3]
+    if layer.type == TML_DWCONV2D:
+        return dims_size(layer.out_dims) * layer.kernel_h * layer.kernel_w
+    if layer.type == TML_FC:
+        return dims_size(layer.in_dims) * dims_size(layer.out_dims)
+    if layer.type == TML_GAP:
+        return dims_size(layer.in_dims)
+    return 0
+
+
+def layer_weights(model: Model, layer) -> int:
+    """Weight and bias bytes read by one layer (weight scales not counted)."""
+    w = model.elem_size
+    b = BIAS_ELEM_SIZE[model.mdl_type]
+    oc = layer.out_dims[3]
+    if layer.type == TML_CONV2D:
+        return layer.kernel_h * layer.kernel_w * layer.in_dims[3] * oc * w + oc * b
+    if layer.type == TML_DWCONV2D:
+        return layer.kernel_h * layer.kernel_w * oc * w + oc * b
+    if layer.type == TML_FC:
+        return dims_size(layer.in_dims) * oc * w + oc * b
+    return 0
+
+
+def collect(model: Model) -> List[LayerStats]:
+    stats = []
+    for l in model.layers:
+        s = LayerStats(l.index, l.name, tuple(l.out_dims[1:]))
+        s.macs = layer_macs(l)
+        s.weight_bytes = layer_weights(model, l)
+        if not l.is_noop:
+            inputs = dims_size(l.in_dims) * (2 if l.type == TML_ADD else 1)
+            s.act_bytes = (inputs + dims_size(l.out_dims)) * model.elem_size
+        else:
+            s.note = "no-op"
+        stats.append(s)
+
+    n = model.patch_layers
+    if n:
+        stack = model.layers[:n]
+        done = [0] * n
+        for band in patch_bands(stack, model.patch_rows):
+            for j, (_, _, ro0, ro1) in enumerate(band):
+                done[j] += ro1 - ro0
+        for j, l in enumerate(stack):
+            s = stats[j]
+            s.macs = s.macs * done[j] // l.out_dims[1]
+            s.group = 0
+            s.note = f"patch {done[j] - l.out_dims[1]:+d} rows"
+    for i in range(len(model.layers) - 1):
+        if fuse_kind(model, model.fuse_mask, i) == 'conv_gap':
+            stats[i].group = i + 1
+            stats[i].note = f"fused into {i + 1}"
+        elif fuse_kind(model, model.fuse_mask, i) == 'redirect':
+            stats[i].note = f"fused into {i + 1}"
+    return stats
+
+
+def parse_profile(path: str) -> Tuple[int, int, Dict[int, int]]:
+    """(tick_hz, total_ticks, {layer: ticks}) of the last profile dump in a log."""
+    tick_hz, total, layers = None, 0, {}
+    with open(path, 'r', errors='replace') as f:
+        for line in f:
+            m = PROF_HDR_RE.search(line)
+            if m:
+                tick_hz, total, layers = int(m.group(1)), int(m.group(3)), {}
+                continue
+            m = PROF_LAYER_RE.search(line)
+            if m and tick_hz is not None:
+                layers[int(m.group(1))] = int(m.group(3))
+    if tick_hz is None:
+        raise ValueError(f"No profile dump found in {path}")
+    return tick_hz, total, layers
+
+
+def predict(macs: int, moved: int, cpm: float, bpc: Optional[float]) -> float:
+    """Roofline cycles: compute bound by cpm, memory bound by bpc."""
+    cycles = macs * cpm
+    if bpc:
+        cycles = max(cycles, moved / bpc)
+    return cycles
+
+
+def report(model: Model, stats: List[LayerStats], cpm: Optional[float], bpc: Optional[float],
+           cpu_hz: int, measured: Optional[Dict[int, float]], flag: float):
+    print(f"TinyMAIX model stats ({model.type_name}, {len(model.layers)} layers)")
+    if model.patch_layers:
+        print(f"  patch based: first {model.patch_layers} layers, {model.patch_rows} output rows per patch")
+    hdr = f"  {'id':>3} {'layer':<9} {'out (h,w,c)':<14} {'MACs':>9} {'w bytes':>8} {'act bytes':>9} {'MAC/B':>6}"
+    if cpm is not None:
+        hdr += f" {'pred us':>8}"
+    if measured is not None:
+        hdr += f" {'meas us':>8} {'cyc/MAC':>7}"
+    print(hdr)
+
+    groups: Dict[int, List[LayerStats]] = {}
+    for s in stats:
+        groups.setdefault(s.group, []).append(s)
+    flagged = []
+    for s in stats:
+        shape = "x".join(str(d) for d in s.shape)
+        line = (f"  {s.index:>3} {s.name:<9} {shape:<14} {s.macs:>9} {s.weight_bytes:>8} "
+                f"{s.act_bytes:>9} {s.intensity:>6.2f}")
+        if cpm is not None:
+            us = predict(s.macs, s.weight_bytes + s.act_bytes, cpm, bpc) * 1e6 / cpu_hz
+            line += f" {us:>8.1f}"
+        if measured is not None:
+            if s.index in measured and s.group == s.index:
+                members = groups[s.index]
+                macs = sum(m.macs for m in members)
+                cyc = measured[s.index]
+                line += f" {cyc * 1e6 / cpu_hz:>8.1f}"
+                line += f" {cyc / macs:>7.2f}" if macs else f" {'-':>7}"
+                if cpm is not None and macs:
+                    exp = sum(predict(m.macs, m.weight_bytes + m.act_bytes, cpm, bpc) for m in members)
+                    if cyc > flag * exp:
+                        flagged.append((s.index, members, cyc / exp))
+            else:
+                line += f" {'-':>8} {'-':>7}"
+        if s.note:
+            line += f"  ({s.note})"
+        print(line)
+
+    total_macs = sum(s.macs for s in stats)
+    print(f"  total MACs            : {total_macs}")
+    print(f"  weight bytes          : {sum(s.weight_bytes for s in stats)}")
+    print(f"  activation bytes moved: {sum(s.act_bytes for s in stats)}")
+    if cpm is not None:
+        pred = sum(predict(s.macs, s.weight_bytes + s.act_bytes, cpm, bpc) for s in stats)
+        print(f"  cycles per MAC        : {cpm:.2f}")
+        if bpc:
+            print(f"  ridge point           : {1.0 / (cpm * bpc):.2f} MAC/B (below: memory bound)")
+        print(f"  predicted latency     : {pred * 1e6 / cpu_hz:.1f} us at {cpu_hz / 1e6:.0f} MHz")
+    if measured is not None:
+        for i, members, ratio in flagged:
+            names = "+".join(f"{m.index}:{m.name}" for m in members)
+            print(f"  SLOW: {names} runs {ratio:.1f}x its expected cycles")
+        if cpm is not None and not flagged:
+            print(f"  no layer above {flag:.1f}x its expected cycles")
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Per-layer statistics and latency estimate of a TinyMAIX model')
+    parser.add_argument('--input', '-i', required=True,
+                        help='TinyMAIX model header (.h) or plain model binary (.bin)')
+    parser.add_argument('--cycles-per-mac', type=float,
+                        help='Compute cost of one MAC in CPU cycles (default: median of the profile)')
+    parser.add_argument('--bytes-per-cycle', type=float,
+                        help='Memory bandwidth for the roofline bound (default: compute only)')
+    parser.add_argument('--cpu-hz', type=int, default=DEFAULT_CPU_HZ,
+                        help=f'CPU clock for cycle to time conversion (default {DEFAULT_CPU_HZ})')
+    parser.add_argument('--profile', '-p',
+                        help='Log with the on-target profile dump ([TinyMaix Prof] lines)')
+    parser.add_argument('--flag', type=float, default=2.0,
+                        help='Flag layers slower than this factor of their expected cycles (default 2.0)')
+    args = parser.parse_args()
+
+    if not os.path.exists(args.input):
+        print(f"Error: Input file not found: {args.input}")
+        sys.exit(1)
+
+    try:
+        if args.input.endswith('.h'):
+            model, _, _ = load_header(args.input)
+        else:
+            with open(args.input, 'rb') as f:
+                model = Model(f.read())
+        stats = collect(model)
+
+        measured = None
+        cpm = args.cycles_per_mac
+        if args.profile:
+            tick_hz, total, ticks = parse_profile(args.profile)
+            # layer ticks to CPU cycles
+            measured = {i: t * args.cpu_hz / tick_hz for i, t in ticks.items() if t}
+            if cpm is None:
+                ratios = []
+                for i, cyc in measured.items():
+                    macs = sum(s.macs for s in stats if s.group == i)
+                    if macs:
+                        ratios.append(cyc / macs)
+                if ratios:
+                    cpm = statistics.median(ratios)
+            print(f"Profile: {args.profile}, total {total * 1e6 / tick_hz:.1f} us")
+        report(model, stats, cpm, args.bytes_per_cycle, args.cpu_hz, measured, args.flag)
+    except Exception as e:
+        print(f"Error: {e}")
+        sys.exit(1)
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,233 @@
+#!/usr/bin/env python3
+"""
+TinyMAIX Partition Stack Usage
+
+Worst-case stack of the secure partitions from a build with
+-DTFM_TINYML_STACK_USAGE=ON. That build compiles the partitions with
+-fstack-usage -fcallgraph-info=su,da. GCC then writes one .ci call graph
+per object, with the frame size of every function in it. This tool:
+
+- reads the .ci files below --dir
+- walks the call graph from each manifest's entry (entry_point for IPC
+  partitions, entry_init and the <service>_sfn functions for SFN ones)
+- reports the worst-case stack and the deepest call path
+- flags recursion, unbounded dynamic frames (VLAs, alloca) and indirect
+  calls with no --indirect target
+- prints a suggested manifest "stack_size" next to the current one
+
+Functions outside the analysed objects (PSA client calls, libc) are
+charged --extern bytes. Indirect calls are charged the deepest
+--indirect target, or --extern when none is given.
+
+Usage:
+    python tinymaix_stack_usage.py --dir build/spe/build-spe \\
+        --manifest partitions/tinymaix_inference/tinymaix_inference_manifest.yaml \\
+        --manifest partitions/echo_service/echo_service_manifest.yaml --indirect layer_cb
+"""
+
+import argparse
+import json
+import os
+import re
+import sys
+from typing import Dict, List, Optional, Set, Tuple
+
+INDIRECT = "__indirect_call"
+
+NODE_RE = re.compile(r'node: \{ title: "([^"]+)" label: "([^"]*)"')
+EDGE_RE = re.compile(r'edge: \{ sourcename: "([^"]+)" targetname: "([^"]+)"')
+FRAME_RE = re.compile(r'\\n(\d+) bytes \(([^)]*)\)')
+DYNAMIC_RE = re.compile(r'\\n(\d+) dynamic objects')
+
+
+class Func:
+    def __init__(self, title: str, frame: int, qualifier: str, dynamic: int):
+        self.title = title
+        self.name = title.rsplit(':', 1)[-1]
+        self.frame = frame
+        self.qualifier = qualifier
+        self.dynamic = dynamic  # VLAs and alloca blocks
+        self.callees: List[str] = []
+
+    @property
+    def unbounded(self) -> bool:
+        """Dynamic objects, or a 'dynamic' frame GCC could not bound."""
+        return self.dynamic > 0 or ('dynamic' in self.qualifier and 'bounded' not in self.qualifier)
+
+
+class CallGraph:
+    def __init__(self):
+        self.funcs: Dict[str, Func] = {}
+        self.by_name: Dict[str, List[Func]] = {}
+
+    def load(self, path: str):
+        edges = []
+        with open(path, 'r', errors='replace') as f:
+            for line in f:
+                m = NODE_RE.search(line)
+                if m:
+                    frame = FRAME_RE.search(m.group(2))
+                    if frame:   # defined here, declaration-only nodes carry no frame
+                        dynamic = DYNAMIC_RE.search(m.group(2))
+                        fn = Func(m.group(1), int(frame.group(1)), frame.group(2),
+                                  int(dynamic.group(1)) if dynamic else 0)
+                        self.funcs[fn.title] = fn
+                        self.by_name.setdefault(fn.name, []).append(fn)
+                    continue
+                m = EDGE_RE.search(line)
+                if m:
+                    edges.append((m.group(1), m.group(2)))
+        for src, dst in edges:
+            if src in self.funcs:
+                self.funcs[src].callees.append(dst)
+
+    def resolve(self, target: str) -> List[Func]:
+        """Definitions a call target may bind to (the deepest one counts)."""
+        if target in self.funcs:
+            return [self.funcs[target]]
+        return self.by_name.get(target.rsplit(':', 1)[-1], [])
+
+
+class Walker:
+    def __init__(self, graph: CallGraph, extern: int, indirect: List[str]):
+        self.graph = graph
+        self.extern = extern
+        self.indirect = indirect
+        self.memo: Dict[str, Tuple[int, List[Func]]] = {}
+        self.active: Set[str] = set()
+        self.recursion: Set[str] = set()
+        self.unbounded: Set[str] = set()
+        self.externs: Set[str] = set()
+        self.open_indirect: Set[str] = set()
+
+    def depth(self, fn: Func) -> Tuple[int, List[Func]]:
+        """(worst-case bytes, deepest path) from fn down."""
+        if fn.title in self.memo:
+            return self.memo[fn.title]
+        if fn.title in self.active:
+            self.recursion.add(fn.name)
+            return 0, []
+        self.active.add(fn.title)
+        if fn.unbounded:
+            self.unbounded.add(fn.name)
+
+        best, best_path = 0, []
+        for target in fn.callees:
+            if target == INDIRECT:
+                callees = [c for name in self.indirect for c in self.graph.resolve(name)]
+                if not callees:
+                    self.open_indirect.add(fn.name)
+            else:
+                callees = self.graph.resolve(target)
+                if not callees:
+                    self.externs.add(target)
+            if not callees and self.extern > best:
+                best, best_path = self.extern, []
+            for callee in callees:
+                d, path = self.depth(callee)
+                if d > best:
+                    best, best_path = d, path
+
+        self.active.discard(fn.title)
+        result = (fn.frame + best, [fn] + best_path)
+        self.memo[fn.title] = result
+        return result
+
+
+def load_manifest(path: str) -> dict:
+    """Partition manifests are JSON behind a '#' licence header."""
+    with open(path, 'r') as f:
+        text = ''.join(l for l in f if not l.lstrip().startswith('#'))
+    return json.loads(text)
+
+
+def manifest_entries(manifest: dict) -> List[str]:
+    if manifest.get('model') == 'SFN':
+        entries = [s['name'].lower() + '_sfn' for s in manifest.get('services', [])]
+        if 'entry_init' in manifest:
+            entries.insert(0, manifest['entry_init'])
+        return entries
+    return [manifest['entry_point']]
+
+
+def suggest(worst: int, margin: int, reserve: int) -> int:
+    """Manifest stack size: worst case plus margin and reserve, 256 byte aligned."""
+    size = worst * (100 + margin) // 100 + reserve
+    return (size + 0xFF) & ~0xFF
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Worst-case stack of secure partitions from GCC call graph info')
+    parser.add_argument('--dir', '-d', action='append', required=True,
+                        help='Build directory searched for .ci files (repeatable)')
+    parser.add_argument('--manifest', '-m', action='append', default=[],
+                        help='Partition manifest whose entries are analysed (repeatable)')
+    parser.add_argument('--entry', '-e', action='append', default=[],
+                        help='Extra root function (repeatable)')
+    parser.add_argument('--indirect', action='append', default=[],
+                        help='Possible target of indirect calls, e.g. a layer callback (repeatable)')
+    parser.add_argument('--extern', type=int, default=256,
+                        help='Bytes charged for calls outside the analysed objects (default 256)')
+    parser.add_argument('--margin', type=int, default=25,
+                        help='Suggested size margin over the worst case in percent (default 25)')
+    parser.add_argument('--reserve', type=int, default=256,
+                        help='Bytes added for exception stacking and SVC entry (default 256)')
+    args = parser.parse_args()
+
+    graph = CallGraph()
+    ci_files = 0
+    for d in args.dir:
+        for root, _, files in os.walk(d):
+            for name in files:
+                if name.endswith('.ci'):
+                    graph.load(os.path.join(root, name))
+                    ci_files += 1
+    if not ci_files:
+        print(f"Error: No .ci files below {', '.join(args.dir)} (build with -DTFM_TINYML_STACK_USAGE=ON)")
+        sys.exit(1)
+
+    roots: List[Tuple[Optional[str], Optional[dict], List[str]]] = []
+    for path in args.manifest:
+        try:
+            manifest = load_manifest(path)
+        except (OSError, ValueError, KeyError) as e:
+            print(f"Error: {path}: {e}")
+            sys.exit(1)
+        roots.append((path, manifest, manifest_entries(manifest)))
+    if args.entry:
+        roots.append((None, None, args.entry))
+
+    print(f"Stack usage ({ci_files} call graphs, {len(graph.funcs)} functions, "
+          f"extern {args.extern} B, margin {args.margin}%, reserve {args.reserve} B)")
+    walker = Walker(graph, args.extern, args.indirect)
+    for path, manifest, entries in roots:
+        title = manifest['name'] if manifest else "extra entries"
+        print(f"  {title}" + (f" ({manifest.get('model', 'IPC')} model)" if manifest else ""))
+        worst = 0
+        for entry in entries:
+            fns = graph.resolve(entry)
+            if not fns:
+                print(f"    {entry}: not found in the call graphs")
+                continue
+            depth, chain = max((walker.depth(fn) for fn in fns), key=lambda r: r[0])
+            worst = max(worst, depth)
+            print(f"    {entry}: {depth} bytes")
+            print("      " + " -> ".join(f"{fn.name}({fn.frame})" for fn in chain))
+        if manifest and worst:
+            current = int(str(manifest.get('stack_size', '0')), 0)
+            size = suggest(worst, args.margin, args.reserve)
+            print(f"    manifest stack_size: {hex(current)} ({current} bytes), "
+                  f"suggested \"stack_size\": \"{size:#x}\" ({size} bytes)")
+
+    for name in sorted(walker.recursion):
+        print(f"  RECURSION: {name} (depth not bounded, counted once)")
+    for name in sorted(walker.unbounded):
+        print(f"  UNBOUNDED: {name} has a dynamic frame (VLA or alloca)")
+    for name in sorted(walker.open_indirect):
+        print(f"  INDIRECT: {name} calls through a pointer, charged {args.extern} B (add --indirect)")
+    if walker.externs:
+        print(f"  extern: {', '.join(sorted(walker.externs))}")
+
+
+if __name__ == '__main__':
+    main()